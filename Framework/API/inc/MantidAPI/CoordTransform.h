@@ -37,6 +37,8 @@ public:
   /// Pure abstract methods to be implemented
   virtual std::string toXMLString() const = 0;
   virtual void apply(const coord_t *inputVector, coord_t *outVector) const = 0;
+  virtual void applyBatch(const coord_t *inputs, coord_t *outputs,
+                          const size_t nPoints) const;
   virtual CoordTransform *clone() const = 0;
   virtual std::string id() const = 0;
 
@@ -58,5 +58,30 @@ CoordTransform::applyVMD(const Mantid::Kernel::VMD &inputVector) const {
   return out;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Apply the transformation to many points at once.
+ *
+ * The coordinates are held one dimension after the other: coordinate d of
+ * point i is at [d * nPoints + i]. This default applies the transformation
+ * to each point in turn; subclasses override it to transform the whole block
+ * with loops the compiler can vectorise.
+ *
+ * @param inputs :: inD * nPoints input coordinates
+ * @param outputs :: outD * nPoints output coordinates
+ * @param nPoints :: number of points to transform
+ */
+void CoordTransform::applyBatch(const coord_t *inputs, coord_t *outputs,
+                                const size_t nPoints) const {
+  std::vector<coord_t> in(inD);
+  std::vector<coord_t> out(outD);
+  for (size_t i = 0; i < nPoints; ++i) {
+    for (size_t d = 0; d < inD; ++d)
+      in[d] = inputs[d * nPoints + i];
+    this->apply(in.data(), out.data());
+    for (size_t d = 0; d < outD; ++d)
+      outputs[d * nPoints + i] = out[d];
+  }
+}
+
 } // namespace API
 } // namespace Mantid
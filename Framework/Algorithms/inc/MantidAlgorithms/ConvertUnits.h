@@ -37,6 +37,12 @@ namespace Algorithms {
    </LI>
     </UL>
 
+    Optional property for event workspaces:
+    <UL>
+    <LI> RebinParams - If set, the events are histogrammed straight into these
+   bins of the target unit, without converting the events. </LI>
+    </UL>
+
     Optional, deprecated property (see http://www.mantidproject.org/ConvertUnits
    for details):
     <UL>
@@ -103,6 +109,11 @@ protected:
   convertQuickly(const API::MatrixWorkspace_const_sptr &inputWS,
                  const double &factor, const double &power);
 
+  /// Get the energy mode, fixed energy and angle convention for conversions
+  /// via TOF
+  void getConversionParameters(const API::MatrixWorkspace &inputWS, int &emode,
+                               double &efixed, bool &signedTheta);
+
   /// Internal function to gather detector specific L2, theta and efixed values
   bool getDetectorValues(const API::SpectrumInfo &spectrumInfo,
                          const Kernel::Unit &outputUnit, int emode,
@@ -116,6 +127,11 @@ protected:
   convertViaTOF(Kernel::Unit_const_sptr fromUnit,
                 API::MatrixWorkspace_const_sptr inputWS);
 
+  /// Histogram the events straight into bins of the target unit
+  API::MatrixWorkspace_sptr
+  convertAndRebinEvents(const DataObjects::EventWorkspace &inputWS,
+                        const std::vector<double> &params);
+
   // Calls Rebin as a Child Algorithm to align the bins of the output workspace
   API::MatrixWorkspace_sptr
   alignBins(const API::MatrixWorkspace_sptr &workspace);
@@ -15,10 +15,13 @@
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidHistogramData/Histogram.h"
+#include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/UnitFactory.h"
+#include "MantidKernel/VectorHelper.h"
 #include "MantidParallel/Communicator.h"
 
 #include <numeric>
@@ -76,6 +79,15 @@ void ConvertUnits::init() {
       "When checked, if the Input Workspace contains Points\n"
       "the algorithm ConvertToHistogram will be run to convert\n"
       "the Points to Bins. The Output Workspace will contains Bins.");
+
+  declareProperty(
+      std::make_unique<ArrayProperty<double>>(
+          "RebinParams", std::make_shared<RebinParamsValidator>(true)),
+      "Only for an EventWorkspace: if set, the events are histogrammed "
+      "straight into these bins of the target unit, given as first bin "
+      "boundary, width, last bin boundary, optionally followed by more widths "
+      "and boundaries as for Rebin. The events are not converted and the "
+      "output is a Workspace2D, as from Rebin with PreserveEvents=False.");
 }
 
 /** Executes the algorithm
@@ -98,6 +110,20 @@ void ConvertUnits::exec() {
   // setup any blocksize, which is the one that changes with conversion
   this->setupMemberVariables(inputWS);
 
+  const std::vector<double> rebinParams = getProperty("RebinParams");
+  if (!rebinParams.empty()) {
+    auto eventWS = std::dynamic_pointer_cast<const EventWorkspace>(inputWS);
+    if (!eventWS)
+      throw std::invalid_argument(
+          "RebinParams can only be used with an EventWorkspace");
+    if (rebinParams.size() < 3)
+      throw std::invalid_argument("RebinParams must give at least the first "
+                                  "bin boundary, width and last bin boundary");
+    setProperty("OutputWorkspace",
+                convertAndRebinEvents(*eventWS, rebinParams));
+    return;
+  }
+
   // Check that the input workspace doesn't already have the desired unit.
   if (m_inputUnit->unitID() == m_outputUnit->unitID()) {
     const std::string outputWSName = getPropertyValue("OutputWorkspace");
@@ -441,55 +467,40 @@ bool ConvertUnits::getDetectorValues(const API::SpectrumInfo &spectrumInfo,
   return true;
 }
 
-/** Convert the workspace units using TOF as an intermediate step in the
- * conversion
- * @param fromUnit :: The unit of the input workspace
+/** Get the parameters, other than the detector positions, needed to convert
+ * the workspace units using TOF as an intermediate step
  * @param inputWS :: The input workspace
- * @returns A shared pointer to the output workspace
+ * @param emode :: The returned energy mode (0=elastic, 1=direct geometry,
+ * 2=indirect geometry)
+ * @param efixed :: The returned fixed energy, or EMPTY_DBL() if it is to be
+ * found for each detector (indirect geometry)
+ * @param signedTheta :: Returns whether to use signed scattering angles
  */
-MatrixWorkspace_sptr
-ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
-                            API::MatrixWorkspace_const_sptr inputWS) {
-  using namespace Geometry;
-
-  Progress prog(this, 0.2, 1.0, m_numberOfSpectra);
-  auto numberOfSpectra_i =
-      static_cast<int64_t>(m_numberOfSpectra); // cast to make openmp happy
-
-  Kernel::Unit_const_sptr outputUnit = m_outputUnit;
-
-  const auto &spectrumInfo = inputWS->spectrumInfo();
-  double l1 = spectrumInfo.l1();
-  g_log.debug() << "Source-sample distance: " << l1 << '\n';
-
-  int failedDetectorCount = 0;
-
+void ConvertUnits::getConversionParameters(const MatrixWorkspace &inputWS,
+                                           int &emode, double &efixed,
+                                           bool &signedTheta) {
   /// @todo No implementation for any of these in the geometry yet so using
   /// properties
   const std::string emodeStr = getProperty("EMode");
   // Convert back to an integer representation
-  int emode = 0;
+  emode = 0;
   if (emodeStr == "Direct")
     emode = 1;
   else if (emodeStr == "Indirect")
     emode = 2;
 
-  // Not doing anything with the Y vector in to/fromTOF yet, so just pass
-  // empty
-  // vector
-  std::vector<double> emptyVec;
   const bool needEfixed =
-      (outputUnit->unitID().find("DeltaE") != std::string::npos ||
-       outputUnit->unitID().find("Wave") != std::string::npos);
-  double efixedProp = getProperty("Efixed");
+      (m_outputUnit->unitID().find("DeltaE") != std::string::npos ||
+       m_outputUnit->unitID().find("Wave") != std::string::npos);
+  efixed = getProperty("Efixed");
   if (emode == 1) {
     //... direct efixed gather
-    if (efixedProp == EMPTY_DBL()) {
+    if (efixed == EMPTY_DBL()) {
       // try and get the value from the run parameters
-      const API::Run &run = inputWS->run();
+      const API::Run &run = inputWS.run();
       if (run.hasProperty("Ei")) {
         try {
-          efixedProp = run.getPropertyValueAsType<double>("Ei");
+          efixed = run.getPropertyValueAsType<double>("Ei");
         } catch (Kernel::Exception::NotFoundError &) {
           throw std::runtime_error("Cannot retrieve Ei value from the logs");
         }
@@ -498,20 +509,54 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
           throw std::invalid_argument(
               "Could not retrieve incident energy from run object");
         } else {
-          efixedProp = 0.0;
+          efixed = 0.0;
         }
       }
     }
-  } else if (emode == 0 && efixedProp == EMPTY_DBL()) // Elastic
+  } else if (emode == 0 && efixed == EMPTY_DBL()) // Elastic
   {
-    efixedProp = 0.0;
+    efixed = 0.0;
   }
 
   std::vector<std::string> parameters =
-      inputWS->getInstrument()->getStringParameter("show-signed-theta");
-  bool signedTheta =
+      inputWS.getInstrument()->getStringParameter("show-signed-theta");
+  signedTheta =
       (!parameters.empty()) &&
       find(parameters.begin(), parameters.end(), "Always") != parameters.end();
+}
+
+/** Convert the workspace units using TOF as an intermediate step in the
+ * conversion
+ * @param fromUnit :: The unit of the input workspace
+ * @param inputWS :: The input workspace
+ * @returns A shared pointer to the output workspace
+ */
+MatrixWorkspace_sptr
+ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
+                            API::MatrixWorkspace_const_sptr inputWS) {
+  using namespace Geometry;
+
+  Progress prog(this, 0.2, 1.0, m_numberOfSpectra);
+  auto numberOfSpectra_i =
+      static_cast<int64_t>(m_numberOfSpectra); // cast to make openmp happy
+
+  Kernel::Unit_const_sptr outputUnit = m_outputUnit;
+
+  const auto &spectrumInfo = inputWS->spectrumInfo();
+  double l1 = spectrumInfo.l1();
+  g_log.debug() << "Source-sample distance: " << l1 << '\n';
+
+  int failedDetectorCount = 0;
+
+  int emode;
+  double efixedProp;
+  bool signedTheta;
+  getConversionParameters(*inputWS, emode, efixedProp, signedTheta);
+
+  // Not doing anything with the Y vector in to/fromTOF yet, so just pass
+  // empty
+  // vector
+  std::vector<double> emptyVec;
 
   auto localFromUnit = std::unique_ptr<Unit>(fromUnit->clone());
   auto localOutputUnit = std::unique_ptr<Unit>(outputUnit->clone());
@@ -601,6 +646,130 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   return outputWS;
 }
 
+/** Histogram the events of an EventWorkspace straight into bins of the
+ * target unit. Rather than converting every event and then rebinning, the
+ * bin boundaries are converted to the unit of the events, once for all the
+ * spectra if there is a quick conversion or else for each spectrum, and the
+ * events are histogrammed against them. The events are not modified.
+ * @param inputWS :: The input event workspace
+ * @param params :: The rebin parameters, in the target unit
+ * @returns A Workspace2D holding the histograms
+ */
+MatrixWorkspace_sptr
+ConvertUnits::convertAndRebinEvents(const EventWorkspace &inputWS,
+                                    const std::vector<double> &params) {
+  BinEdges edges(0);
+  static_cast<void>(
+      VectorHelper::createAxisFromRebinParams(params, edges.mutableRawData()));
+  MatrixWorkspace_sptr outputWS =
+      create<Workspace2D>(inputWS, m_numberOfSpectra, edges);
+  outputWS->getAxis(0)->unit() = m_outputUnit;
+  storeEModeOnWorkspace(outputWS);
+  const auto numberOfSpectra_i =
+      static_cast<int64_t>(m_numberOfSpectra); // cast to make openmp happy
+
+  // Bin boundaries in the unit of the events. A quick conversion gives the
+  // same boundaries for all the spectra; otherwise each spectrum converts its
+  // own copy while it is histogrammed.
+  double factor, power;
+  const bool quickConversion =
+      m_outputUnit->quickConversion(*m_inputUnit, factor, power);
+  std::vector<double> commonEdges;
+  bool commonReversed = false;
+  int emode = 0;
+  double efixedProp = 0.;
+  bool signedTheta = false;
+  // The units are initialized for each detector, so each thread needs its own
+  std::vector<std::unique_ptr<Unit>> fromUnits, toUnits;
+  if (quickConversion) {
+    commonEdges = edges.rawData();
+    for (auto &x : commonEdges)
+      x = factor * std::pow(x, power);
+    // The conversion may have reversed the order of the boundaries
+    commonReversed = commonEdges.front() > commonEdges.back();
+    if (commonReversed)
+      std::reverse(commonEdges.begin(), commonEdges.end());
+  } else {
+    getConversionParameters(inputWS, emode, efixedProp, signedTheta);
+    for (int thread = 0; thread < PARALLEL_GET_MAX_THREADS; ++thread) {
+      fromUnits.emplace_back(m_outputUnit->clone());
+      toUnits.emplace_back(m_inputUnit->clone());
+    }
+    if (emode == 1 && efixedProp != EMPTY_DBL()) {
+      // set the Ei value in the run parameters
+      outputWS->mutableRun().addProperty<double>("Ei", efixedProp, true);
+    }
+  }
+
+  const auto &spectrumInfo = inputWS.spectrumInfo();
+  const double l1 = quickConversion ? 0. : spectrumInfo.l1();
+  // Spectra without detector values are left empty, and masked after the loop
+  std::vector<char> failed(m_numberOfSpectra, false);
+  Progress prog(this, 0.2, 1.0, m_numberOfSpectra);
+  PARALLEL_FOR_IF(Kernel::threadSafe(inputWS, *outputWS))
+  for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    std::vector<double> spectrumEdges;
+    const std::vector<double> *x = &commonEdges;
+    bool reversed = commonReversed;
+    if (!quickConversion) {
+      double efixed = efixedProp;
+      double l2;
+      double twoTheta;
+      if (getDetectorValues(spectrumInfo, *m_outputUnit, emode, inputWS,
+                            signedTheta, i, efixed, l2, twoTheta)) {
+        /// @todo Don't yet consider hold-off (delta)
+        const double delta = 0.0;
+        auto &fromUnit = *fromUnits[PARALLEL_THREAD_NUMBER];
+        auto &toUnit = *toUnits[PARALLEL_THREAD_NUMBER];
+        fromUnit.initialize(l1, l2, twoTheta, emode, efixed, delta);
+        toUnit.initialize(l1, l2, twoTheta, emode, efixed, delta);
+        spectrumEdges = edges.rawData();
+        fromUnit.convertViaTOF(toUnit, spectrumEdges.data(),
+                               spectrumEdges.data() + spectrumEdges.size());
+        reversed = spectrumEdges.front() > spectrumEdges.back();
+        if (reversed)
+          std::reverse(spectrumEdges.begin(), spectrumEdges.end());
+        x = &spectrumEdges;
+      } else {
+        failed[i] = true;
+        x = nullptr;
+      }
+    }
+    if (x) {
+      MantidVec y, e;
+      inputWS.getSpectrum(i).generateHistogram(*x, y, e);
+      if (reversed) {
+        std::reverse(y.begin(), y.end());
+        std::reverse(e.begin(), e.end());
+      }
+      outputWS->mutableY(i) = std::move(y);
+      outputWS->mutableE(i) = std::move(e);
+    }
+    prog.report("Convert to " + m_outputUnit->unitID());
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  // Mask the spectra that failed, as for the events
+  auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
+  int failedDetectorCount = 0;
+  for (size_t i = 0; i < m_numberOfSpectra; ++i) {
+    if (!failed[i])
+      continue;
+    failedDetectorCount++;
+    if (outSpectrumInfo.hasDetectors(i))
+      outSpectrumInfo.setMasked(i, true);
+  }
+  if (failedDetectorCount != 0) {
+    g_log.information() << "Unable to calculate sample-detector distance for "
+                        << failedDetectorCount
+                        << " spectra. Masking spectrum.\n";
+  }
+
+  return outputWS;
+}
+
 /// Calls Rebin as a Child Algorithm to align the bins
 API::MatrixWorkspace_sptr
 ConvertUnits::alignBins(const API::MatrixWorkspace_sptr &workspace) {
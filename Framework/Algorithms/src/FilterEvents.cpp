@@ -1024,6 +1024,10 @@ void FilterEvents::processTableSplittersWorkspace() {
     throw std::runtime_error(
         "Splitters given in TableWorkspace must have 3 columns.");
   }
+  if (m_splitterTableWorkspace->rowCount() == 0) {
+    throw std::runtime_error(
+        "Splitters given in TableWorkspace must have at least 1 row.");
+  }
 
   // clear vector splitterTime and vector of splitter group
   m_vecSplitterTime.clear();
@@ -1769,43 +1773,54 @@ void FilterEvents::filterEventsByVectorSplitters(double progressamount) {
                     "by pulse time.");
   }
 
+  // Output workspace of every target, indexed by target
+  std::vector<DataObjects::EventWorkspace *> targetWorkspaces;
+  for (auto &ws : m_outputWorkspacesMap) {
+    const auto target = static_cast<size_t>(ws.first);
+    if (target >= targetWorkspaces.size())
+      targetWorkspaces.resize(target + 1, nullptr);
+    targetWorkspaces[target] = ws.second.get();
+  }
+
   PARALLEL_FOR_NO_WSP_CHECK()
   for (int64_t iws = 0; iws < int64_t(numberOfSpectra); ++iws) {
     PARALLEL_START_INTERUPT_REGION
 
     // Filter the non-skipped spectrum
     if (!m_vecSkip[iws]) {
-      // Get the output event lists (should be empty) to be a map
-      map<int, DataObjects::EventList *> outputs;
-      PARALLEL_CRITICAL(build_elist) {
-        for (auto &ws : m_outputWorkspacesMap) {
-          int index = ws.first;
-          auto &output_el = ws.second->getSpectrum(iws);
-          outputs.emplace(index, &output_el);
-        }
+      // Get the output event lists (should be empty), indexed by target
+      std::vector<DataObjects::EventList *> outputs(targetWorkspaces.size(),
+                                                    nullptr);
+      for (size_t target = 0; target < targetWorkspaces.size(); ++target) {
+        if (targetWorkspaces[target])
+          outputs[target] = &targetWorkspaces[target]->getSpectrum(iws);
       }
 
       // Get a holder on input workspace's event list of this spectrum
       const DataObjects::EventList &input_el = m_eventWS->getSpectrum(iws);
 
-      bool printdetail = false;
-      if (m_useDBSpectrum)
-        printdetail = (iws == static_cast<int64_t>(m_dbWSIndex));
-
-      // Perform the filtering (using the splitting function and just one
-      // output)
-      std::string logmessage;
+      // Perform the filtering. The events are counted per target first so
+      // every output list is allocated once.
       if (m_tofCorrType != NoneCorrect) {
-        logmessage = input_el.splitByFullTimeMatrixSplitter(
+        input_el.splitByFullTimeToTargets(
             m_vecSplitterTime, m_vecSplitterGroup, outputs, true,
             m_detTofFactors[iws], m_detTofOffsets[iws]);
       } else {
-        logmessage = input_el.splitByFullTimeMatrixSplitter(
-            m_vecSplitterTime, m_vecSplitterGroup, outputs, false, 1.0, 0.0);
+        input_el.splitByFullTimeToTargets(m_vecSplitterTime,
+                                          m_vecSplitterGroup, outputs, false,
+                                          1.0, 0.0);
       }
 
-      if (printdetail)
-        g_log.notice(logmessage);
+      if (m_useDBSpectrum && iws == static_cast<int64_t>(m_dbWSIndex)) {
+        std::stringstream msg;
+        msg << "Workspace index " << iws << ": " << input_el.getNumberEvents()
+            << " events split into";
+        for (size_t target = 0; target < outputs.size(); ++target) {
+          if (outputs[target])
+            msg << " " << target << ":" << outputs[target]->getNumberEvents();
+        }
+        g_log.notice() << msg.str() << "\n";
+      }
     }
 
     PARALLEL_END_INTERUPT_REGION
@@ -41,6 +41,15 @@ void SortEvents::init() {
                   "(typically Time of Flight).\n"
                   "  Pulse Time: the wall-clock time of the pulse that "
                   "produced the event.");
+
+  std::vector<std::string> algorithmOptions{"Comparison", "Radix"};
+  declareProperty(
+      "SortingAlgorithm", "Comparison",
+      std::make_shared<StringListValidator>(algorithmOptions),
+      "Algorithm used to sort the events of each spectrum:\n"
+      "  Comparison: a parallel comparison sort.\n"
+      "  Radix: a parallel, stable radix sort. Usually faster for large "
+      "event lists; not used for Pulse Time.");
 }
 
 /** Executes the rebin algorithm
@@ -66,8 +75,13 @@ void SortEvents::exec() {
   else if (sortoption == "Pulse Time + TOF")
     sortType = DataObjects::PULSETIMETOF_SORT;
 
+  const DataObjects::EventSortAlgorithm algorithm =
+      getPropertyValue("SortingAlgorithm") == "Radix"
+          ? DataObjects::RADIX_SORT
+          : DataObjects::COMPARISON_SORT;
+
   // This runs the SortEvents algorithm in parallel
-  eventW->sortAll(sortType, &prog);
+  eventW->sortAll(sortType, &prog, algorithm);
 }
 
 } // namespace Algorithms
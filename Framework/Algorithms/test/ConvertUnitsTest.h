@@ -15,6 +15,7 @@
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAlgorithms/ConvertToDistribution.h"
 #include "MantidAlgorithms/ConvertUnits.h"
+#include "MantidAlgorithms/Rebin.h"
 #include "MantidDataHandling/LoadInstrument.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
@@ -779,6 +780,87 @@ public:
     do_testExecEvent_RemainsSorted(PULSETIME_SORT, "Energy");
   }
 
+  void do_testExecEvent_RebinParams(const std::string &targetUnit,
+                                    const std::string &rebinParams) {
+    EventWorkspace_sptr ws =
+        WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(1, 10,
+                                                                        false);
+    ws->getAxis(0)->setUnit("TOF");
+    const auto numEvents = ws->getNumberEvents();
+
+    ConvertUnits conv;
+    conv.initialize();
+    conv.setChild(true);
+    conv.setProperty("InputWorkspace",
+                     std::dynamic_pointer_cast<MatrixWorkspace>(ws));
+    conv.setPropertyValue("OutputWorkspace", "unused");
+    conv.setPropertyValue("Target", targetUnit);
+    conv.setPropertyValue("RebinParams", rebinParams);
+    TS_ASSERT_THROWS_NOTHING(conv.execute());
+    MatrixWorkspace_sptr out = conv.getProperty("OutputWorkspace");
+    TS_ASSERT(!std::dynamic_pointer_cast<EventWorkspace>(out));
+    TS_ASSERT_EQUALS(out->getAxis(0)->unit()->unitID(), targetUnit);
+    // The events have not been touched
+    TS_ASSERT_EQUALS(ws->getNumberEvents(), numEvents);
+    TS_ASSERT_EQUALS(ws->getAxis(0)->unit()->unitID(), "TOF");
+
+    // Same as converting the events then rebinning
+    ConvertUnits convEvents;
+    convEvents.initialize();
+    convEvents.setChild(true);
+    convEvents.setProperty("InputWorkspace",
+                           std::dynamic_pointer_cast<MatrixWorkspace>(ws));
+    convEvents.setPropertyValue("OutputWorkspace", "unused");
+    convEvents.setPropertyValue("Target", targetUnit);
+    convEvents.execute();
+    MatrixWorkspace_sptr converted = convEvents.getProperty("OutputWorkspace");
+    Rebin rebin;
+    rebin.initialize();
+    rebin.setChild(true);
+    rebin.setProperty("InputWorkspace", converted);
+    rebin.setPropertyValue("OutputWorkspace", "unused");
+    rebin.setPropertyValue("Params", rebinParams);
+    rebin.setProperty("PreserveEvents", false);
+    rebin.execute();
+    MatrixWorkspace_sptr expected = rebin.getProperty("OutputWorkspace");
+
+    TS_ASSERT_EQUALS(out->getNumberHistograms(),
+                     expected->getNumberHistograms());
+    double total = 0.;
+    for (size_t i = 0; i < out->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(out->x(i).rawData(), expected->x(i).rawData());
+      const auto &y = out->y(i);
+      const auto &expectedY = expected->y(i);
+      TS_ASSERT_EQUALS(y.size(), expectedY.size());
+      for (size_t j = 0; j < y.size(); ++j) {
+        TS_ASSERT_DELTA(y[j], expectedY[j], 1e-10);
+        total += y[j];
+      }
+    }
+    TS_ASSERT_LESS_THAN(0., total);
+  }
+
+  void testExecEvent_RebinParams_dSpacing() {
+    do_testExecEvent_RebinParams("dSpacing", "0.1,0.01,1");
+  }
+
+  void testExecEvent_RebinParams_Wavelength_Logarithmic() {
+    do_testExecEvent_RebinParams("Wavelength", "0.001,-0.01,0.03");
+  }
+
+  void testExecEvent_RebinParams_needs_an_EventWorkspace() {
+    ConvertUnits conv;
+    conv.initialize();
+    conv.setChild(true);
+    conv.setRethrows(true);
+    conv.setProperty("InputWorkspace",
+                     WorkspaceCreationHelper::create2DWorkspace123(1, 10));
+    conv.setPropertyValue("OutputWorkspace", "unused");
+    conv.setPropertyValue("Target", "Wavelength");
+    conv.setPropertyValue("RebinParams", "0.1,0.01,1");
+    TS_ASSERT_THROWS(conv.execute(), const std::invalid_argument &);
+  }
+
   void testDeltaEFailDoesNotAlterInPlaceWorkspace() {
 
     std::string wsName =
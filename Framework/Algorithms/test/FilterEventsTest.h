@@ -991,6 +991,89 @@ public:
     return;
   }
 
+  /** Events exactly at the start of a splitter belong to it, and events
+   * exactly at its stop time do not
+   */
+  void test_tableSplitter_boundaries() {
+    // Times that are exact in seconds: 2^-6 s between events, 2^-2 s between
+    // pulses
+    int64_t runstart_i64 = 20000000000;
+    int64_t pulsedt = 250 * 1000 * 1000;
+    int64_t tofdt = 15625 * 1000;
+    size_t numpulses = 2;
+
+    EventWorkspace_sptr inpWS =
+        createEventWorkspace(runstart_i64, pulsedt, tofdt, numpulses);
+    AnalysisDataService::Instance().addOrReplace("TestBoundaries", inpWS);
+
+    // A: [event 0, event 3) of the first pulse, B: from there to event 3 of
+    // the second pulse
+    auto splws = std::make_shared<DataObjects::TableWorkspace>();
+    splws->addColumn("double", "start");
+    splws->addColumn("double", "stop");
+    splws->addColumn("str", "target");
+    const double split = static_cast<double>(3 * tofdt) * 1.E-9;
+    TableRow rowA = splws->appendRow();
+    rowA << 0. << split << "A";
+    TableRow rowB = splws->appendRow();
+    rowB << split << static_cast<double>(pulsedt) * 1.E-9 + split << "B";
+
+    FilterEvents filter;
+    filter.initialize();
+    filter.setProperty("InputWorkspace", "TestBoundaries");
+    filter.setProperty("OutputWorkspaceBaseName", "FilteredBoundaries");
+    filter.setProperty<TableWorkspace_sptr>("SplitterWorkspace", splws);
+    filter.setProperty("RelativeTime", true);
+    TS_ASSERT_THROWS_NOTHING(filter.execute());
+    TS_ASSERT(filter.isExecuted());
+
+    int numsplittedws = filter.getProperty("NumberOutputWS");
+    TS_ASSERT_EQUALS(numsplittedws, 2);
+    auto &ads = AnalysisDataService::Instance();
+    auto wsA = ads.retrieveWS<EventWorkspace>("FilteredBoundaries_A");
+    auto wsB = ads.retrieveWS<EventWorkspace>("FilteredBoundaries_B");
+    TS_ASSERT(wsA);
+    TS_ASSERT(wsB);
+    if (wsA && wsB) {
+      for (size_t i = 0; i < inpWS->getNumberHistograms(); ++i) {
+        TS_ASSERT_EQUALS(wsA->getSpectrum(i).getNumberEvents(), 3);
+        // Events 3 to 9 of the first pulse and 0 to 2 of the second
+        TS_ASSERT_EQUALS(wsB->getSpectrum(i).getNumberEvents(), 10);
+      }
+      const auto &eventsB = wsB->getSpectrum(0).getEvents();
+      TS_ASSERT_DELTA(eventsB.front().tof(), 3 * tofdt / 1000., 1.E-4);
+      TS_ASSERT_EQUALS(eventsB.front().pulseTime().totalNanoseconds(),
+                       runstart_i64);
+      TS_ASSERT_DELTA(eventsB.back().tof(), 2 * tofdt / 1000., 1.E-4);
+      TS_ASSERT_EQUALS(eventsB.back().pulseTime().totalNanoseconds(),
+                       runstart_i64 + pulsedt);
+    }
+
+    ads.remove("TestBoundaries");
+    std::vector<std::string> outputwsnames =
+        filter.getProperty("OutputWorkspaceNames");
+    for (const auto &outputwsname : outputwsnames)
+      ads.remove(outputwsname);
+  }
+
+  void test_emptyTableSplitter() {
+    EventWorkspace_sptr inpWS = createEventWorkspace(
+        20000000000, 100 * 1000 * 1000, 10 * 1000 * 1000, 5);
+    auto splws = std::make_shared<DataObjects::TableWorkspace>();
+    splws->addColumn("double", "start");
+    splws->addColumn("double", "stop");
+    splws->addColumn("str", "target");
+
+    FilterEvents filter;
+    filter.initialize();
+    filter.setRethrows(true);
+    filter.setProperty<EventWorkspace_sptr>("InputWorkspace", inpWS);
+    filter.setProperty("OutputWorkspaceBaseName", "FilteredEmpty");
+    filter.setProperty<TableWorkspace_sptr>("SplitterWorkspace", splws);
+    filter.setProperty("RelativeTime", true);
+    TS_ASSERT_THROWS(filter.execute(), const std::runtime_error &);
+  }
+
   /** Test the feature to exclude some sample logs to be split and add to child
    * workspaces
    * @brief Utest_excludeSampleLogs
@@ -133,4 +133,30 @@ public:
 
     AnalysisDataService::Instance().remove(wsName);
   }
+
+  void testRadixSortByTof() {
+    std::string wsName("test_inEvent5");
+    EventWorkspace_sptr test_in =
+        WorkspaceCreationHelper::createRandomEventWorkspace(NUMBINS, NUMPIXELS);
+    AnalysisDataService::Instance().add(wsName, test_in);
+
+    SortEvents sort;
+    sort.initialize();
+    sort.setPropertyValue("InputWorkspace", wsName);
+    sort.setPropertyValue("SortBy", "X Value");
+    sort.setPropertyValue("SortingAlgorithm", "Radix");
+    TS_ASSERT(sort.execute());
+    TS_ASSERT(sort.isExecuted());
+
+    EventWorkspace_const_sptr outWS =
+        AnalysisDataService::Instance().retrieveWS<const EventWorkspace>(
+            wsName);
+    TS_ASSERT_EQUALS(outWS->getSortType(), TOF_SORT);
+    std::vector<TofEvent> ve = outWS->getSpectrum(0).getEvents();
+    TS_ASSERT_EQUALS(ve.size(), NUMBINS);
+    for (size_t i = 0; i < ve.size() - 1; i++)
+      TS_ASSERT_LESS_THAN_EQUALS(ve[i].tof(), ve[i + 1].tof());
+
+    AnalysisDataService::Instance().remove(wsName);
+  }
 };
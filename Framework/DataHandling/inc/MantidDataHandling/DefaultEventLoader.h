@@ -10,6 +10,10 @@
 #include "MantidDataHandling/DllConfig.h"
 #include "MantidDataHandling/EventWorkspaceCollection.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 class BankPulseTimes;
 
 namespace Mantid {
@@ -69,6 +73,19 @@ public:
   std::vector<std::vector<std::vector<Mantid::DataObjects::WeightedEvent> *>>
       weightedEventVectors;
 
+  /// Vector where index = event_id; value = ptr to
+  /// std::vector<WeightedEventNoTime> in the event list. Only used when
+  /// compressing events while loading.
+  std::vector<
+      std::vector<std::vector<Mantid::DataObjects::WeightedEventNoTime> *>>
+      weightedNoTimeEventVectors;
+
+  /// Do we compress the events while loading them?
+  bool compress;
+  /// Number of events a processing task may add to the event lists before
+  /// compressing them, when compressing while loading
+  size_t compressBufferEvents{0};
+
   /// Vector where (index = pixel ID+pixelID_to_wi_offset), value = workspace
   /// index)
   std::vector<size_t> pixelID_to_wi_vector;
@@ -76,6 +93,34 @@ public:
   /// One entry of pulse times for each preprocessor
   std::vector<std::shared_ptr<BankPulseTimes>> m_bankPulseTimes;
 
+  /// Default number of events read from disk at a time for each bank
+  static constexpr size_t EVENTS_PER_READ = 8 * 1024 * 1024;
+  /// Number of events read from disk at a time for each bank. The
+  /// loadeventnexus.eventsperread configuration property overrides the
+  /// default, EVENTS_PER_READ.
+  size_t eventsPerRead;
+  /// Limit on processing tasks that have been read but not run. When it is
+  /// reached the reading thread waits for the other threads to catch up. The
+  /// loadeventnexus.maxqueuedtasks configuration property overrides it.
+  size_t maxQueuedTasks;
+  /// Processing tasks that have been read but not run yet
+  std::atomic<size_t> queuedTasks{0};
+  /// Are there other threads to run the processing tasks while one reads?
+  bool multiThreaded;
+  /// Largest number of queued processing tasks
+  std::atomic<size_t> maxQueueDepth{0};
+  /// Bytes of event data read from disk
+  std::atomic<size_t> bytesRead{0};
+  /// Time spent reading event data, in microseconds
+  std::atomic<size_t> readMicroseconds{0};
+  /// Events processed into the event lists
+  std::atomic<size_t> eventsProcessed{0};
+  /// Time spent processing events summed over all threads, in microseconds
+  std::atomic<size_t> processMicroseconds{0};
+
+  void waitForQueuedTasks();
+  void finishedQueuedTask();
+
 private:
   DefaultEventLoader(LoadEventNexus *alg, EventWorkspaceCollection &ws,
                      bool haveWeights, bool event_id_is_spec,
@@ -84,6 +129,12 @@ private:
   std::pair<size_t, size_t>
   setupChunking(std::vector<std::string> &bankNames,
                 std::vector<std::size_t> &bankNumEvents);
+  void logStatistics(const double seconds) const;
+  void checkPulseTimeOrder();
+  /// Protects the wait for queuedTasks to go down
+  std::mutex m_queueMutex;
+  /// Notified whenever a queued processing task finishes
+  std::condition_variable m_queueDrained;
   /// Map detector IDs to event lists.
   template <class T>
   void makeMapToEventLists(std::vector<std::vector<T>> &vectors);
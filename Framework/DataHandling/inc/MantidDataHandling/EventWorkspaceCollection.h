@@ -88,6 +88,10 @@ public:
   setMonitorWorkspace(const std::shared_ptr<API::MatrixWorkspace> &monitorWS);
   void updateSpectraUsing(const API::SpectrumDetectorMapping &map);
   void setTitle(const std::string &title);
+  void setStorageLayout(const DataObjects::EventStorageLayout layout);
+  void setStorageLayout(
+      const DataObjects::EventStorageLayout layout,
+      std::shared_ptr<const DataObjects::CompactEvents::PulseTable> pulseTimes);
   void
   applyFilter(const boost::function<void(API::MatrixWorkspace_sptr)> &func);
   virtual bool threadSafe() const;
@@ -45,6 +45,17 @@ private:
   std::unique_ptr<std::vector<uint32_t>> loadEventId(::NeXus::File &file);
   std::unique_ptr<std::vector<float>> loadTof(::NeXus::File &file);
   std::unique_ptr<std::vector<float>> loadEventWeights(::NeXus::File &file);
+  void
+  loadAndQueueEvents(::NeXus::File &file, const int64_t start_event,
+                     const int64_t stop_event,
+                     const std::shared_ptr<std::vector<uint64_t>> &event_index);
+  void
+  queueProcessing(const std::shared_ptr<std::vector<uint32_t>> &event_id,
+                  const std::shared_ptr<std::vector<float>> &event_time_of_flight,
+                  const std::shared_ptr<std::vector<float>> &event_weight,
+                  const std::shared_ptr<std::vector<uint64_t>> &event_index);
+  void queueTask(std::shared_ptr<Kernel::Task> task,
+                 std::shared_ptr<std::mutex> mutex);
   int64_t recalculateDataSize(const int64_t &size);
 
   /// Algorithm being run
@@ -75,6 +86,14 @@ private:
   bool m_have_weight;
   /// Frame period numbers
   const std::vector<int> m_framePeriodNumbers;
+  /// Has the pixel ID splitting the processing tasks been chosen?
+  bool m_splitIdSet;
+  /// Largest pixel ID handled by the first processing task of each piece
+  uint32_t m_splitId;
+  /// Serialises the processing of pixel IDs up to m_splitId
+  std::shared_ptr<std::mutex> m_lowIdMutex;
+  /// Serialises the processing of pixel IDs above m_splitId
+  std::shared_ptr<std::mutex> m_highIdMutex;
 }; // END-DEF-CLASS LoadBankFromDiskTask
 
 } // namespace DataHandling
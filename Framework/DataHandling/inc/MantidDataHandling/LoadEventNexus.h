@@ -193,9 +193,15 @@ public:
   /// Tolerance for CompressEvents; use -1 to mean don't compress.
   double compressTolerance;
 
+  /// Memory in MB for events waiting to be compressed while loading
+  int compressMemoryBudget;
+
   /// Pulse times for ALL banks, taken from proton_charge log.
   std::shared_ptr<BankPulseTimes> m_allBanksPulseTimes;
 
+  /// Pulse times of all banks read by the DefaultEventLoader
+  std::vector<std::shared_ptr<BankPulseTimes>> m_bankPulseTimes;
+
   /// name of top level NXentry to use
   std::string m_top_entry_name;
   std::unique_ptr<::NeXus::File> m_file;
@@ -236,6 +242,8 @@ private:
   loadISISVMSSpectraMapping(const std::string &entry_name);
 
   template <typename T> void filterDuringPause(T workspace);
+  /// Pack the loaded events with the pulse times read from the file
+  void compactLoadedEvents();
 
   /// Set the top entry field name
   void setTopEntryName();
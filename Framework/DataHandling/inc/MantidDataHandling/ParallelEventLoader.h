@@ -37,7 +37,8 @@ public:
                                const std::string &groupName,
                                const std::vector<std::string> &bankNames,
                                const bool eventIDIsSpectrumNumber,
-                               const bool precalcEvents);
+                               const bool precalcEvents,
+                               const bool balanced = false);
 };
 
 } // namespace DataHandling
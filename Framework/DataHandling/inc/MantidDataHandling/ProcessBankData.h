@@ -13,6 +13,8 @@
 #include "MantidKernel/Timer.h"
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace Mantid {
 namespace API {
@@ -57,6 +59,10 @@ public:
   void run() override;
 
 private:
+  void preallocateEvents();
+  void addUncompressed(const int periodIndex, const detid_t detId,
+                       const size_t numCompressed);
+  void compressEvents();
   size_t getWorkspaceIndexFromPixelID(const detid_t pixID);
   size_t getFirstEventIndex(const size_t pulseIndex) const;
   size_t getLastEventIndex(const size_t pulseIndex,
@@ -93,6 +99,14 @@ private:
   detid_t m_min_id;
   /// Maximum pixel id
   detid_t m_max_id;
+  /// Pixels (index = period * number of pixels + pixel ID - m_min_id) with
+  /// events that have not been compressed yet, and the number of compressed
+  /// events at the start of their lists
+  std::vector<std::pair<size_t, size_t>> m_uncompressedPixels;
+  /// Flags for the pixels in m_uncompressedPixels
+  std::vector<bool> m_hasUncompressed;
+  /// Number of events added since the last compression
+  size_t m_numUncompressed{0};
   /// timer for performance
   Mantid::Kernel::Timer m_timer;
 }; // ENDDEF-CLASS ProcessBankData
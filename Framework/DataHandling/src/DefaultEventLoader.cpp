@@ -8,8 +8,11 @@
 #include "MantidAPI/Progress.h"
 #include "MantidDataHandling/LoadBankFromDiskTask.h"
 #include "MantidDataHandling/LoadEventNexus.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/Timer.h"
 
 using namespace Mantid::Kernel;
 
@@ -34,10 +37,15 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
   ThreadPool pool(scheduler);
   auto diskIOMutex = std::make_shared<std::mutex>();
 
-  // set up progress bar for the rest of the (multi-threaded) process
-  size_t numProg = bankNames.size() * (1 + 3); // 1 = disktask, 3 = proc task
-  if (loader.splitProcessing)
-    numProg += bankNames.size() * 3; // 3 = second proc task
+  // set up progress bar for the rest of the (multi-threaded) process. Each
+  // bank is read in pieces of at most eventsPerRead events.
+  size_t numProg = bankNames.size(); // 1 = disktask
+  for (size_t i = bankRange.first; i < bankRange.second; i++) {
+    const size_t numReads =
+        std::max(size_t(1), (bankNumEvents[i] + loader.eventsPerRead - 1) /
+                                loader.eventsPerRead);
+    numProg += numReads * (loader.splitProcessing ? 6 : 3); // 3 = proc task
+  }
   auto prog = std::make_unique<API::Progress>(loader.alg, 0.3, 1.0, numProg);
 
   for (size_t i = bankRange.first; i < bankRange.second; i++) {
@@ -47,8 +55,17 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
           prog.get(), diskIOMutex, *scheduler, periodLog));
   }
   // Start and end all threads
+  Timer timer;
   pool.joinAll();
   diskIOMutex.reset();
+  loader.checkPulseTimeOrder();
+  // Kept for packing the events with the pulse times of the file
+  if (alg->m_allBanksPulseTimes)
+    alg->m_bankPulseTimes.emplace_back(alg->m_allBanksPulseTimes);
+  alg->m_bankPulseTimes.insert(alg->m_bankPulseTimes.end(),
+                               loader.m_bankPulseTimes.cbegin(),
+                               loader.m_bankPulseTimes.cend());
+  loader.logStatistics(timer.elapsed());
 }
 
 DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
@@ -69,7 +86,16 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
         m_ws.getDetectorIDToWorkspaceIndexVector(pixelID_to_wi_offset, true);
 
   // Cache a map for speed.
-  if (!haveWeights) {
+  compress = (alg->compressTolerance >= 0);
+  if (compress) {
+    // Events are compressed into the event lists as they are loaded
+    for (size_t period = 0; period < m_ws.nPeriods(); ++period) {
+      for (size_t i = 0; i < m_ws.getNumberHistograms(); i++) {
+        m_ws.getSpectrum(i, period).switchTo(API::WEIGHTED_NOTIME);
+      }
+    }
+    makeMapToEventLists(weightedNoTimeEventVectors);
+  } else if (!haveWeights) {
     makeMapToEventLists(eventVectors);
   } else {
     // Convert to weighted events
@@ -82,6 +108,103 @@ DefaultEventLoader::DefaultEventLoader(LoadEventNexus *alg,
   // split banks up if the number of cores is more than twice the number of
   // banks
   splitProcessing = bool(numBanks * 2 < ThreadPool::getNumPhysicalCores());
+
+  auto &config = ConfigService::Instance();
+  eventsPerRead = std::max(
+      1, config.getValue<int>("loadeventnexus.eventsperread")
+             .get_value_or(static_cast<int>(EVENTS_PER_READ)));
+  // Keep up to two pieces of every bank per core in memory while they wait to
+  // be processed, so reading from disk stays ahead of the processing
+  maxQueuedTasks = std::max(
+      1, config.getValue<int>("loadeventnexus.maxqueuedtasks")
+             .get_value_or(
+                 static_cast<int>(2 * ThreadPool::getNumPhysicalCores())));
+  multiThreaded = ThreadPool::getNumPhysicalCores() > 1;
+
+  // Share the memory budget for uncompressed events between the threads
+  if (compress) {
+    const size_t budgetBytes =
+        static_cast<size_t>(alg->compressMemoryBudget) * 1024 * 1024;
+    compressBufferEvents = std::max(
+        size_t(1024), budgetBytes / (sizeof(DataObjects::WeightedEventNoTime) *
+                                     ThreadPool::getNumPhysicalCores()));
+  }
+}
+
+/** Wait until fewer than maxQueuedTasks processing tasks are queued. With a
+ * single thread nothing would run them, so there is no wait.
+ */
+void DefaultEventLoader::waitForQueuedTasks() {
+  if (!multiThreaded)
+    return;
+  std::unique_lock<std::mutex> lock(m_queueMutex);
+  m_queueDrained.wait(lock, [this] { return queuedTasks < maxQueuedTasks; });
+}
+
+/// Record that a queued processing task has finished
+void DefaultEventLoader::finishedQueuedTask() {
+  {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    --queuedTasks;
+  }
+  m_queueDrained.notify_one();
+}
+
+/** Log how fast the event data was read and processed
+ * @param seconds :: wall-clock time taken to read and process all banks
+ */
+void DefaultEventLoader::logStatistics(const double seconds) const {
+  const double readSeconds = static_cast<double>(readMicroseconds) * 1e-6;
+  const double processSeconds =
+      static_cast<double>(processMicroseconds) * 1e-6;
+  auto &log = alg->getLogger().information();
+  log << "Read " << static_cast<double>(bytesRead) / (1024. * 1024.)
+      << " MB of event data in " << readSeconds << " s";
+  if (readSeconds > 0.)
+    log << " (" << static_cast<double>(bytesRead) / (1024. * 1024.) / readSeconds
+        << " MB/s)";
+  log << ". Processed " << eventsProcessed << " events in " << processSeconds
+      << " s of CPU time";
+  if (processSeconds > 0.)
+    log << " (" << static_cast<double>(eventsProcessed) / processSeconds
+        << " events/s per thread)";
+  log << ", " << seconds << " s in total. At most " << maxQueueDepth
+      << " processing tasks were waiting for a thread.\n";
+}
+
+/** The event lists are marked as sorted by pulse time before loading. Pieces
+ * of a bank may be processed in any order and the pulse times in a file need
+ * not increase, so clear the mark from lists whose events did not arrive in
+ * order. Filtering by time relies on it to search the lists.
+ */
+void DefaultEventLoader::checkPulseTimeOrder() {
+  const auto isBefore = [](const auto &lhs, const auto &rhs) {
+    return lhs.pulseTime() < rhs.pulseTime();
+  };
+  const auto numHistograms = static_cast<int64_t>(m_ws.getNumberHistograms());
+  for (size_t period = 0; period < m_ws.nPeriods(); ++period) {
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < numHistograms; ++i) {
+      auto &el = m_ws.getSpectrum(static_cast<size_t>(i), period);
+      if (el.getSortType() != DataObjects::PULSETIME_SORT)
+        continue;
+      bool sorted = true;
+      switch (el.getEventType()) {
+      case API::TOF:
+        sorted = std::is_sorted(el.getEvents().cbegin(), el.getEvents().cend(),
+                                isBefore);
+        break;
+      case API::WEIGHTED:
+        sorted = std::is_sorted(el.getWeightedEvents().cbegin(),
+                                el.getWeightedEvents().cend(), isBefore);
+        break;
+      case API::WEIGHTED_NOTIME:
+        break;
+      }
+      if (!sorted)
+        el.setSortOrder(DataObjects::UNSORTED);
+    }
+  }
 }
 
 std::pair<size_t, size_t>
@@ -285,6 +285,21 @@ void EventWorkspaceCollection::setTitle(const std::string &title) {
   }
 }
 
+void EventWorkspaceCollection::setStorageLayout(
+    const DataObjects::EventStorageLayout layout) {
+  for (auto &ws : m_WsVec) {
+    ws->setStorageLayout(layout);
+  }
+}
+
+void EventWorkspaceCollection::setStorageLayout(
+    const DataObjects::EventStorageLayout layout,
+    std::shared_ptr<const DataObjects::CompactEvents::PulseTable> pulseTimes) {
+  for (auto &ws : m_WsVec) {
+    ws->setStorageLayout(layout, pulseTimes);
+  }
+}
+
 void EventWorkspaceCollection::applyFilter(
     const boost::function<void(MatrixWorkspace_sptr)> &func) {
   for (auto &ws : m_WsVec) {
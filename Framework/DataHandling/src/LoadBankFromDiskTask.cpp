@@ -9,6 +9,7 @@
 #include "MantidDataHandling/DefaultEventLoader.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataHandling/ProcessBankData.h"
+#include "MantidKernel/Timer.h"
 #include "MantidKernel/Unit.h"
 #include <algorithm>
 
@@ -38,7 +39,9 @@ LoadBankFromDiskTask::LoadBankFromDiskTask(
     : m_loader(loader), entry_name(entry_name), entry_type(entry_type),
       prog(prog), scheduler(scheduler), m_loadError(false),
       m_oldNexusFileNames(oldNeXusFileNames), m_have_weight(false),
-      m_framePeriodNumbers(framePeriodNumbers) {
+      m_framePeriodNumbers(framePeriodNumbers), m_splitIdSet(false),
+      m_lowIdMutex(std::make_shared<std::mutex>()),
+      m_highIdMutex(std::make_shared<std::mutex>()) {
   setMutex(ioMutex);
   m_cost = static_cast<double>(numEvents);
   m_min_id = std::numeric_limits<uint32_t>::max();
@@ -250,10 +253,6 @@ LoadBankFromDiskTask::loadEventId(::NeXus::File &file) {
  */
 std::unique_ptr<std::vector<float>>
 LoadBankFromDiskTask::loadTof(::NeXus::File &file) {
-  // Allocate the array
-  auto event_time_of_flight =
-      std::make_unique<std::vector<float>>(m_loadSize[0]);
-
   // Get the list of event_time_of_flight's
   std::string key, tof_unit;
   if (!m_oldNexusFileNames)
@@ -283,9 +282,9 @@ LoadBankFromDiskTask::loadTof(::NeXus::File &file) {
   file.closeData();
   // Convert Tof to microseconds
   Kernel::Units::timeConversionVector(vec, tof_unit, "microseconds");
-  std::copy(vec.begin(), vec.end(), event_time_of_flight->data());
 
-  return event_time_of_flight;
+  // Hand over the buffer read from the file rather than copying it
+  return std::make_unique<std::vector<float>>(std::move(vec));
 }
 
 /** Load weight of weigthed events if they exist
@@ -345,12 +344,6 @@ void LoadBankFromDiskTask::run() {
 
   prog->report(entry_name + ": load from disk");
 
-  // arrays to load into
-  std::unique_ptr<std::vector<uint32_t>> event_id;
-  std::unique_ptr<std::vector<float>> event_time_of_flight;
-  std::unique_ptr<std::vector<float>> event_weight;
-  std::vector<uint64_t> event_index;
-
   // Open the file
   ::NeXus::File file(m_loader.alg->m_filename);
   try {
@@ -360,7 +353,7 @@ void LoadBankFromDiskTask::run() {
     file.openGroup(entry_name, entry_type);
 
     // Load the event_index field.
-    event_index = this->loadEventIndex(file);
+    auto event_index = this->loadEventIndex(file);
 
     if (!m_loadError) {
       // Load and validate the pulse times
@@ -379,34 +372,18 @@ void LoadBankFromDiskTask::run() {
       int64_t stop_event = 0;
       this->prepareEventId(file, start_event, stop_event, event_index);
 
-      // These are the arguments to getSlab()
-      m_loadStart[0] = start_event;
-      m_loadSize[0] = stop_event - start_event;
-
-      if ((m_loadSize[0] > 0) && (m_loadStart[0] >= 0)) {
-        // Load pixel IDs
-        event_id = this->loadEventId(file);
-        if (m_loader.alg->getCancel()) {
-          m_loader.alg->getLogger().error()
-              << "Loading bank " << entry_name << " is cancelled.\n";
-          m_loadError = true; // To allow cancelling the algorithm
-        }
-
-        // And TOF.
-        if (!m_loadError) {
-          event_time_of_flight = this->loadTof(file);
-          if (m_have_weight) {
-            event_weight = this->loadEventWeights(file);
-          }
-        }
+      if ((stop_event > start_event) && (start_event >= 0)) {
+        this->loadAndQueueEvents(
+            file, start_event, stop_event,
+            std::make_shared<std::vector<uint64_t>>(std::move(event_index)));
       } // Size is at least 1
       else {
         // Found a size that was 0 or less; stop processing
         m_loader.alg->getLogger().error()
             << "Loading bank " << entry_name
             << " is stopped due to either zero/negative loading size ("
-            << m_loadStart[0] << ") or negative load start index ("
-            << m_loadStart[0] << ")\n";
+            << stop_event - start_event << ") or negative load start index ("
+            << start_event << ")\n";
         m_loadError = true;
       }
 
@@ -427,12 +404,72 @@ void LoadBankFromDiskTask::run() {
   // Close up the file even if errors occured.
   file.closeGroup();
   file.close();
+}
 
-  // Abort if anything failed
-  if (m_loadError) {
-    return;
+/** Read the events of the bank in pieces of at most
+ * DefaultEventLoader::eventsPerRead events. Each piece is handed to
+ * ProcessBankData tasks as soon as it has been read, so the other threads
+ * process it while this one reads the next piece.
+ * @param file :: File handle, with the event_id field open
+ * @param start_event :: index of the first event to load
+ * @param stop_event :: index of the last event to load + 1
+ * @param event_index :: index of the first event of each pulse
+ */
+void LoadBankFromDiskTask::loadAndQueueEvents(
+    ::NeXus::File &file, const int64_t start_event, const int64_t stop_event,
+    const std::shared_ptr<std::vector<uint64_t>> &event_index) {
+  const auto eventsPerRead = static_cast<int64_t>(m_loader.eventsPerRead);
+
+  for (int64_t readStart = start_event; readStart < stop_event;
+       readStart += eventsPerRead) {
+    // These are the arguments to getSlab()
+    m_loadStart[0] = readStart;
+    m_loadSize[0] = std::min(eventsPerRead, stop_event - readStart);
+    if (readStart != start_event)
+      file.openData(m_oldNexusFileNames ? "event_pixel_id" : "event_id");
+
+    Kernel::Timer timer;
+    // Load pixel IDs
+    std::shared_ptr<std::vector<uint32_t>> event_id = this->loadEventId(file);
+    if (m_loader.alg->getCancel()) {
+      m_loader.alg->getLogger().error()
+          << "Loading bank " << entry_name << " is cancelled.\n";
+      m_loadError = true; // To allow cancelling the algorithm
+    }
+    if (m_loadError)
+      return;
+
+    // And TOF.
+    std::shared_ptr<std::vector<float>> event_time_of_flight =
+        this->loadTof(file);
+    std::shared_ptr<std::vector<float>> event_weight;
+    if (m_have_weight)
+      event_weight = this->loadEventWeights(file);
+    if (m_loadError)
+      return;
+
+    const auto numEvents = static_cast<size_t>(m_loadSize[0]);
+    m_loader.bytesRead += numEvents * (sizeof(uint32_t) + sizeof(float) +
+                                       (m_have_weight ? sizeof(float) : 0));
+    m_loader.readMicroseconds +=
+        static_cast<size_t>(timer.elapsed_no_reset() * 1e6);
+
+    this->queueProcessing(event_id, event_time_of_flight, event_weight,
+                          event_index);
   }
+}
 
+/** Create the ProcessBankData tasks for the piece of the bank just read
+ * @param event_id :: pixel IDs of the events
+ * @param event_time_of_flight :: times-of-flight of the events
+ * @param event_weight :: weights of the events, if any
+ * @param event_index :: index of the first event of each pulse
+ */
+void LoadBankFromDiskTask::queueProcessing(
+    const std::shared_ptr<std::vector<uint32_t>> &event_id,
+    const std::shared_ptr<std::vector<float>> &event_time_of_flight,
+    const std::shared_ptr<std::vector<float>> &event_weight,
+    const std::shared_ptr<std::vector<uint64_t>> &event_index) {
   const auto bank_size = m_max_id - m_min_id;
   const auto minSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMin);
   const auto maxSpectraToLoad = static_cast<uint32_t>(m_loader.alg->m_specMax);
@@ -461,37 +498,59 @@ void LoadBankFromDiskTask::run() {
     return;
   }
 
-  // schedule the job to generate the event lists
-  auto mid_id = m_max_id;
-  if (m_loader.splitProcessing && m_max_id > (m_min_id + (bank_size / 4)))
-    // only split if told to and the section to load is at least 1/4 the size
-    // of the whole bank
-    mid_id = (m_max_id + m_min_id) / 2;
-
-  // No error? Launch a new task to process that data.
-  auto numEvents = static_cast<size_t>(m_loadSize[0]);
-  auto startAt = static_cast<size_t>(m_loadStart[0]);
-
-  // convert things to shared_arrays to share between tasks
-  std::shared_ptr<std::vector<uint32_t>> event_id_shrd(event_id.release());
-  std::shared_ptr<std::vector<float>> event_time_of_flight_shrd(
-      event_time_of_flight.release());
-  std::shared_ptr<std::vector<float>> event_weight_shrd(event_weight.release());
-  auto event_index_shrd =
-      std::make_shared<std::vector<uint64_t>>(std::move(event_index));
-
-  std::shared_ptr<Task> newTask1 = std::make_shared<ProcessBankData>(
-      m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-      numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
-      event_weight_shrd, m_min_id, mid_id);
-  scheduler.push(newTask1);
-  if (m_loader.splitProcessing && (mid_id < m_max_id)) {
-    std::shared_ptr<Task> newTask2 = std::make_shared<ProcessBankData>(
-        m_loader, entry_name, prog, event_id_shrd, event_time_of_flight_shrd,
-        numEvents, startAt, event_index_shrd, thisBankPulseTimes, m_have_weight,
-        event_weight_shrd, (mid_id + 1), m_max_id);
-    scheduler.push(newTask2);
+  // Pixel ID splitting the two processing jobs of the bank. It is fixed by the
+  // first piece read so that the jobs of different pieces that may run at the
+  // same time never touch the same pixel with different mutexes.
+  if (!m_splitIdSet) {
+    m_splitId = std::numeric_limits<uint32_t>::max();
+    if (m_loader.splitProcessing && m_max_id > (m_min_id + (bank_size / 4)))
+      // only split if told to and the section to load is at least 1/4 the
+      // size of the whole bank
+      m_splitId = (m_max_id + m_min_id) / 2;
+    m_splitIdSet = true;
+  }
+
+  // No error? Launch new tasks to process that data.
+  const auto numEvents = static_cast<size_t>(m_loadSize[0]);
+  const auto startAt = static_cast<size_t>(m_loadStart[0]);
+  const uint32_t lowMaxId = std::min(m_max_id, m_splitId);
+  if (m_min_id <= lowMaxId)
+    queueTask(std::make_shared<ProcessBankData>(
+                  m_loader, entry_name, prog, event_id, event_time_of_flight,
+                  numEvents, startAt, event_index, thisBankPulseTimes,
+                  m_have_weight, event_weight, m_min_id, lowMaxId),
+              m_lowIdMutex);
+  if (m_splitId < m_max_id)
+    queueTask(std::make_shared<ProcessBankData>(
+                  m_loader, entry_name, prog, event_id, event_time_of_flight,
+                  numEvents, startAt, event_index, thisBankPulseTimes,
+                  m_have_weight, event_weight,
+                  std::max(m_min_id, m_splitId + 1), m_max_id),
+              m_highIdMutex);
+}
+
+/** Schedule a processing task. If enough processing is already waiting, wait
+ * for the other threads to catch up first. The disk I/O mutex stays locked
+ * meanwhile, so no bank is read further ahead, but the processing goes on.
+ * With a single thread the task is run here, as nothing else would run it.
+ * @param task :: the ProcessBankData task
+ * @param mutex :: mutex shared by the tasks for the same pixels of this bank
+ */
+void LoadBankFromDiskTask::queueTask(std::shared_ptr<Kernel::Task> task,
+                                     std::shared_ptr<std::mutex> mutex) {
+  task->setMutex(mutex);
+  m_loader.waitForQueuedTasks();
+  const size_t depth = ++m_loader.queuedTasks;
+  if (!m_loader.multiThreaded && depth > m_loader.maxQueuedTasks) {
+    std::lock_guard<std::mutex> lock(*mutex);
+    task->run();
+    return;
+  }
+  size_t maxDepth = m_loader.maxQueueDepth;
+  while (depth > maxDepth &&
+         !m_loader.maxQueueDepth.compare_exchange_weak(maxDepth, depth)) {
   }
+  scheduler.push(std::move(task));
 }
 
 /**
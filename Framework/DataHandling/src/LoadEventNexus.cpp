@@ -78,7 +78,8 @@ bool exists(const std::map<std::string, std::string> &entries,
 LoadEventNexus::LoadEventNexus()
     : filter_tof_min(0), filter_tof_max(0), m_specMin(0), m_specMax(0),
       longest_tof(0), shortest_tof(0), bad_tofs(0), discarded_events(0),
-      compressTolerance(0), m_instrument_loaded_correctly(false),
+      compressTolerance(0), compressMemoryBudget(0),
+      m_instrument_loaded_correctly(false),
       loadlogs(false), event_id_is_spec(false) {}
 
 //----------------------------------------------------------------------------------------------
@@ -191,6 +192,32 @@ void LoadEventNexus::init() {
                   "This specified the tolerance to use (in microseconds) when "
                   "compressing.");
 
+  auto mustBePositiveBudget = std::make_shared<BoundedValidator<int>>();
+  mustBePositiveBudget->setLower(1);
+  declareProperty("CompressMemoryBudget", 1024, mustBePositiveBudget,
+                  "Memory (in MB) that may be used to hold events that have "
+                  "not been compressed yet when CompressTolerance is set. "
+                  "Events are compressed into the event lists whenever this "
+                  "is exceeded, so the uncompressed run never has to fit in "
+                  "memory. When this takes more than one pass, the new events "
+                  "are merged into the compressed ones, so a TOF may differ "
+                  "from compressing all events at once by up to the "
+                  "tolerance.");
+  setPropertySettings("CompressMemoryBudget",
+                      std::make_unique<VisibleWhenProperty>(
+                          "CompressTolerance", IS_NOT_DEFAULT));
+
+  declareProperty(std::make_unique<PropertyWithValue<bool>>(
+                      "CompactEvents", false, Direction::Input),
+                  "Hold the events in 8 bytes each instead of 16, with "
+                  "single precision time-of-flight and pulse times indexed "
+                  "in a table shared by all spectra (optional, default "
+                  "False). The events are packed once loading is finished, "
+                  "so only the memory held after the load is reduced, not "
+                  "the peak memory of the load. Spectra whose events cannot "
+                  "be held exactly this way, or have pulse times that are "
+                  "not in the file, are left as they are.");
+
   auto mustBePositive = std::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
   declareProperty("ChunkNumber", EMPTY_INT(), mustBePositive,
@@ -208,6 +235,7 @@ void LoadEventNexus::init() {
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("CompactEvents", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -285,6 +313,7 @@ void LoadEventNexus::init() {
 
 #ifndef _WIN32
   loadType.emplace_back("Multiprocess (experimental)");
+  loadType.emplace_back("Multiprocess balanced (experimental)");
 #endif // _WIN32
 
 #ifdef MPI_EXPERIMENTAL
@@ -295,7 +324,10 @@ void LoadEventNexus::init() {
   declareProperty("LoadType", "Default", loadTypeValidator,
                   "Set type of loader. 2 options {Default, Multiproceess},"
                   "'Multiprocess' should work faster for big files and it is "
-                  "experimental, available only in Linux");
+                  "experimental, available only in Linux. 'Multiprocess "
+                  "balanced' shares the banks out by size and lets processes "
+                  "that finish early help the others, for files whose banks "
+                  "differ a lot in size");
 
   declareProperty(std::make_unique<PropertyWithValue<bool>>(
                       "LoadNexusInstrumentXML", true, Direction::Input),
@@ -375,6 +407,28 @@ void LoadEventNexus::filterDuringPause<EventWorkspaceCollection_sptr>(
   workspace->applyFilter(func);
 }
 
+//------------------------------------------------------------------------------------------------
+/** Pack the loaded events into the COMPACT layout. The pulse time table is
+ * made from the pulse times read from the banks, if the DefaultEventLoader
+ * kept them, so that the events need not be scanned for their pulse times.
+ * Spectra with an event pulse time missing from the table stay unpacked.
+ */
+void LoadEventNexus::compactLoadedEvents() {
+  if (m_bankPulseTimes.empty()) {
+    m_ws->setStorageLayout(DataObjects::EventStorageLayout::COMPACT);
+    return;
+  }
+  std::vector<int64_t> pulseTimes;
+  for (const auto &bankPulseTimes : m_bankPulseTimes) {
+    for (size_t i = 0; i < bankPulseTimes->numPulses; ++i)
+      pulseTimes.emplace_back(bankPulseTimes->pulseTimes[i].totalNanoseconds());
+  }
+  m_bankPulseTimes.clear();
+  m_ws->setStorageLayout(
+      DataObjects::EventStorageLayout::COMPACT,
+      DataObjects::CompactEvents::makePulseTable(std::move(pulseTimes)));
+}
+
 //------------------------------------------------------------------------------------------------
 /** Executes the algorithm. Reading in the file and creating and populating
  *  the output workspace
@@ -384,6 +438,8 @@ void LoadEventNexus::execLoader() {
   m_filename = getPropertyValue("Filename");
 
   compressTolerance = getProperty("CompressTolerance");
+  compressMemoryBudget = getProperty("CompressMemoryBudget");
+  m_bankPulseTimes.clear();
 
   loadlogs = getProperty("LoadLogs");
 
@@ -419,6 +475,10 @@ void LoadEventNexus::execLoader() {
   // think)
   filterDuringPause(m_ws->getSingleHeldWorkspace());
 
+  const bool compactEvents = getProperty("CompactEvents");
+  if (compactEvents)
+    compactLoadedEvents();
+
   // add filename
   m_ws->mutableRun().addProperty("Filename", m_filename);
   // Save output
@@ -1037,9 +1097,11 @@ void LoadEventNexus::loadEvents(API::Progress *const prog,
       };
 
       try {
-        ParallelEventLoader::loadMultiProcess(*ws, m_filename, m_top_entry_name,
-                                              bankNames, event_id_is_spec,
-                                              getProperty("Precount"));
+        ParallelEventLoader::loadMultiProcess(
+            *ws, m_filename, m_top_entry_name, bankNames, event_id_is_spec,
+            getProperty("Precount"),
+            getPropertyValue("LoadType") ==
+                "Multiprocess balanced (experimental)");
         g_log.information() << "Used Multiprocess ParallelEventLoader.\n";
         loaded = true;
         shortest_tof = 0.0;
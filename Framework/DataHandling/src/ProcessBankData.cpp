@@ -62,12 +62,111 @@ getPulseIndex(const size_t event_index, const size_t last_pulse_index,
   }
   return std::distance(event_index_vec->cbegin(), event_index_iter);
 }
+
+/** Make room for more events in a vector. An empty vector is sized exactly;
+ * one that already holds events from an earlier piece of the bank grows by at
+ * least half its capacity, so loading a bank in many pieces does not copy the
+ * events over and over.
+ * @param events :: the vector of events
+ * @param count :: number of events that will be added
+ */
+template <class T>
+void reserveAdditional(std::vector<T> &events, const size_t count) {
+  const size_t required = events.size() + count;
+  if (required <= events.capacity())
+    return;
+  if (events.empty())
+    events.reserve(required);
+  else
+    events.reserve(std::max(required, events.capacity() * 3 / 2));
+}
+
+/// Records a finished processing task in the loader statistics when it goes
+/// out of scope, whichever way run() returns
+class ProcessingRecorder {
+public:
+  ProcessingRecorder(DefaultEventLoader &loader, const size_t numEvents)
+      : m_loader(loader), m_numEvents(numEvents) {}
+  ~ProcessingRecorder() {
+    m_loader.processMicroseconds +=
+        static_cast<size_t>(m_timer.elapsed_no_reset() * 1e6);
+    m_loader.eventsProcessed += m_numEvents;
+    m_loader.finishedQueuedTask();
+  }
+
+private:
+  DefaultEventLoader &m_loader;
+  const size_t m_numEvents;
+  Kernel::Timer m_timer;
+};
 } // namespace
 
+/** Count the events that will be added to each pixel in each period and make
+ * room for them in the event vectors, so that filling them never reallocates.
+ * Only events passing the pixel ID and time-of-flight filters are counted.
+ */
+void ProcessBankData::preallocateEvents() {
+  const auto *alg = m_loader.alg;
+  const double TOF_MIN = alg->filter_tof_min;
+  const double TOF_MAX = alg->filter_tof_max;
+  const auto NUM_PULSES = thisBankPulseTimes->numPulses;
+  const size_t numPixels = m_max_id - m_min_id + 1;
+
+  // One vector of counts for each period that has events in this bank
+  std::vector<std::vector<size_t>> counts(m_loader.m_ws.nPeriods());
+  for (std::size_t pulseIndex = getPulseIndex(startAt, 0, event_index);
+       pulseIndex < NUM_PULSES; pulseIndex++) {
+    const auto firstEventIndex = getFirstEventIndex(pulseIndex);
+    if (firstEventIndex > numEvents)
+      break;
+    const auto lastEventIndex = getLastEventIndex(pulseIndex, NUM_PULSES);
+    if (firstEventIndex >= lastEventIndex)
+      continue;
+
+    auto &periodCounts =
+        counts[thisBankPulseTimes->periodNumbers[pulseIndex] - 1];
+    if (periodCounts.empty())
+      periodCounts.resize(numPixels, 0);
+    for (std::size_t eventIndex = firstEventIndex; eventIndex < lastEventIndex;
+         ++eventIndex) {
+      const detid_t detId = (*event_id)[eventIndex];
+      if (detId >= m_min_id && detId <= m_max_id) {
+        const auto tof =
+            static_cast<double>((*event_time_of_flight)[eventIndex]);
+        if ((tof - TOF_MIN) * (tof - TOF_MAX) <= 0.)
+          ++periodCounts[detId - m_min_id];
+      }
+    }
+  }
+
+  // Make room on top of any events already in the lists
+  for (size_t periodIndex = 0; periodIndex < counts.size(); ++periodIndex) {
+    const auto &periodCounts = counts[periodIndex];
+    for (size_t pixel = 0; pixel < periodCounts.size(); ++pixel) {
+      const size_t count = periodCounts[pixel];
+      if (count == 0)
+        continue;
+      const detid_t detId = m_min_id + static_cast<detid_t>(pixel);
+      if (have_weight) {
+        auto *eventVector = m_loader.weightedEventVectors[periodIndex][detId];
+        if (eventVector)
+          reserveAdditional(*eventVector, count);
+      } else {
+        auto *eventVector = m_loader.eventVectors[periodIndex][detId];
+        if (eventVector)
+          reserveAdditional(*eventVector, count);
+      }
+    }
+    if (alg->getCancel())
+      break; // User cancellation
+  }
+}
+
 /** Run the data processing
  * FIXME/TODO - split run() into readable methods
  */
 void ProcessBankData::run() { // override {
+  ProcessingRecorder recorder(m_loader, numEvents);
   // Local tof limits
   double my_shortest_tof =
       static_cast<double>(std::numeric_limits<uint32_t>::max()) * 0.1;
@@ -80,31 +179,9 @@ void ProcessBankData::run() { // override {
   // ---- Pre-counting events per pixel ID ----
   auto &outputWS = m_loader.m_ws;
   auto *alg = m_loader.alg;
-  if (m_loader.precount) {
-
-    std::vector<size_t> counts(m_max_id - m_min_id + 1, 0);
-    for (size_t i = 0; i < numEvents; i++) {
-      const auto thisId = detid_t((*event_id)[i]);
-      if (thisId >= m_min_id && thisId <= m_max_id)
-        counts[thisId - m_min_id]++;
-    }
-
-    // Now we pre-allocate (reserve) the vectors of events in each pixel
-    // counted
-    const size_t numEventLists = outputWS.getNumberHistograms();
-    for (detid_t pixID = m_min_id; pixID <= m_max_id; ++pixID) {
-      if (counts[pixID - m_min_id] > 0) {
-        size_t wi = getWorkspaceIndexFromPixelID(pixID);
-        // Find the the workspace index corresponding to that pixel ID
-        // Allocate it
-        if (wi < numEventLists) {
-          outputWS.reserveEventListAt(wi, counts[pixID - m_min_id]);
-        }
-        if (alg->getCancel())
-          break; // User cancellation
-      }
-    }
-  }
+  // Compressed event lists only ever hold a fraction of the events
+  if (m_loader.precount && !m_loader.compress)
+    preallocateEvents();
 
   // Check for canceled algorithm
   if (alg->getCancel()) {
@@ -123,12 +200,11 @@ void ProcessBankData::run() { // override {
   prog->report(entry_name + ": filling events");
 
   // Will we need to compress?
-  const bool compress = (alg->compressTolerance >= 0);
-
-  // Which detector IDs were touched? - only matters if compress is on
-  std::vector<bool> usedDetIds;
+  const bool compress = m_loader.compress;
   if (compress)
-    usedDetIds.assign(m_max_id - m_min_id + 1, false);
+    m_hasUncompressed.assign(
+        outputWS.nPeriods() * static_cast<size_t>(m_max_id - m_min_id + 1),
+        false);
 
   const double TOF_MIN = alg->filter_tof_min;
   const double TOF_MAX = alg->filter_tof_max;
@@ -168,8 +244,26 @@ void ProcessBankData::run() { // override {
             static_cast<double>((*event_time_of_flight)[eventIndex]);
         // this is fancy for check if value is in range
         if ((tof - TOF_MIN) * (tof - TOF_MAX) <= 0.) {
-          // Handle simulated data if present
-          if (have_weight) {
+          if (compress) {
+            // Events are added without their pulse time and compressed
+            // whenever enough of them have been collected
+            auto *eventVector =
+                m_loader.weightedNoTimeEventVectors[periodIndex][detId];
+            // NULL eventVector indicates a bad spectrum lookup
+            if (eventVector) {
+              if (have_weight) {
+                const auto weight =
+                    static_cast<double>((*event_weight)[eventIndex]);
+                eventVector->emplace_back(tof, weight, weight * weight);
+              } else {
+                eventVector->emplace_back(tof, 1.0, 1.0);
+              }
+              addUncompressed(periodIndex, detId, eventVector->size() - 1);
+            } else {
+              ++my_discarded_events;
+            }
+          } else if (have_weight) {
+            // Handle simulated data if present
             auto *eventVector =
                 m_loader.weightedEventVectors[periodIndex][detId];
             // NULL eventVector indicates a bad spectrum lookup
@@ -205,10 +299,6 @@ void ProcessBankData::run() { // override {
           } else
             badTofs++;
 
-          // Track all the touched wi (only necessary when compressing events,
-          // for thread safety)
-          if (compress)
-            usedDetIds[detId - m_min_id] = true;
         } // valid time-of-flight
 
       } // valid detector IDs
@@ -223,25 +313,9 @@ void ProcessBankData::run() { // override {
     return;
   }
 
-  //------------ Compress Events (or set sort order) ------------------
-  // Do it on all the detector IDs we touched
-  if (compress) {
-    for (detid_t pixID = m_min_id; pixID <= m_max_id; ++pixID) {
-      if (usedDetIds[pixID - m_min_id]) {
-        // Find the the workspace index corresponding to that pixel ID
-        size_t wi = getWorkspaceIndexFromPixelID(pixID);
-        auto &el = outputWS.getSpectrum(wi);
-        if (compress)
-          el.compressEvents(alg->compressTolerance, &el);
-        else {
-          if (pulsetimesincreasing)
-            el.setSortOrder(DataObjects::PULSETIME_SORT);
-          else
-            el.setSortOrder(DataObjects::UNSORTED);
-        }
-      }
-    }
-  }
+  //------------ Compress the remaining events ------------------
+  if (compress)
+    compressEvents();
   prog->report(entry_name + ": filled events");
 
   alg->getLogger().debug() << entry_name
@@ -269,6 +343,49 @@ void ProcessBankData::run() { // override {
 #endif
 } // END-OF-RUN()
 
+/** Note that a pixel has been given an uncompressed event. The events of all
+ * such pixels are compressed once the memory budget of the task is used up.
+ * @param periodIndex :: index of the period of the event
+ * @param detId :: pixel ID (or spectrum number) of the event
+ * @param numCompressed :: number of events in the list before this one
+ */
+void ProcessBankData::addUncompressed(const int periodIndex,
+                                      const detid_t detId,
+                                      const size_t numCompressed) {
+  const size_t numPixels = m_max_id - m_min_id + 1;
+  const size_t pixel =
+      static_cast<size_t>(periodIndex) * numPixels + (detId - m_min_id);
+  if (!m_hasUncompressed[pixel]) {
+    m_hasUncompressed[pixel] = true;
+    m_uncompressedPixels.emplace_back(pixel, numCompressed);
+  }
+  if (++m_numUncompressed >= m_loader.compressBufferEvents)
+    compressEvents();
+}
+
+/** Compress the events of every pixel that was given events since the last
+ * compression. Only the new events are sorted and compressed, and then merged
+ * into the already compressed ones (see EventList::compressAppendedEvents).
+ * The TOFs may therefore differ slightly from compressing all events at once,
+ * by less than the tolerance, whenever more than one pass is needed.
+ */
+void ProcessBankData::compressEvents() {
+  const size_t numPixels = m_max_id - m_min_id + 1;
+  const double tolerance = m_loader.alg->compressTolerance;
+  for (const auto &uncompressed : m_uncompressedPixels) {
+    const size_t pixel = uncompressed.first;
+    const auto periodNumber = pixel / numPixels;
+    const auto pixID = m_min_id + static_cast<detid_t>(pixel % numPixels);
+    // Find the the workspace index corresponding to that pixel ID
+    const size_t wi = getWorkspaceIndexFromPixelID(pixID);
+    auto &el = m_loader.m_ws.getSpectrum(wi, periodNumber);
+    el.compressAppendedEvents(tolerance, uncompressed.second);
+    m_hasUncompressed[pixel] = false;
+  }
+  m_uncompressedPixels.clear();
+  m_numUncompressed = 0;
+}
+
 size_t ProcessBankData::getFirstEventIndex(const size_t pulseIndex) const {
   const auto firstEventIndex = event_index->operator[](pulseIndex);
   if (firstEventIndex >= startAt)
@@ -18,6 +18,7 @@
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidIndexing/SpectrumIndexSet.h"
 #include "MantidIndexing/SpectrumNumber.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Property.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidNexusGeometry/Hdf5Version.h"
@@ -456,6 +457,51 @@ public:
     }
   }
 
+  void test_loading_banks_in_pieces_gives_the_same_events() {
+    const auto loadCNCS = [](const std::string &wsName) {
+      LoadEventNexus ld;
+      ld.initialize();
+      ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+      ld.setPropertyValue("OutputWorkspace", wsName);
+      ld.setProperty<bool>("LoadLogs", false); // Time-saver
+      TS_ASSERT_THROWS_NOTHING(ld.execute());
+      TS_ASSERT(ld.isExecuted());
+      return AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+          wsName);
+    };
+    const auto whole = loadCNCS("cncs_whole_banks");
+
+    // Read every bank in many small pieces and let only one piece wait for
+    // processing at a time, so that reading and processing interleave
+    auto &config = ConfigService::Instance();
+    config.setString("loadeventnexus.eventsperread", "500");
+    config.setString("loadeventnexus.maxqueuedtasks", "1");
+    const auto pieces = loadCNCS("cncs_bank_pieces");
+    config.remove("loadeventnexus.eventsperread");
+    config.remove("loadeventnexus.maxqueuedtasks");
+
+    TS_ASSERT_EQUALS(pieces->getNumberEvents(), whole->getNumberEvents());
+    TS_ASSERT_EQUALS(pieces->getNumberHistograms(),
+                     whole->getNumberHistograms());
+    const auto byTofAndPulseTime = [](const TofEvent &a, const TofEvent &b) {
+      return std::make_pair(a.tof(), a.pulseTime()) <
+             std::make_pair(b.tof(), b.pulseTime());
+    };
+    size_t mismatches = 0;
+    for (size_t i = 0; i < whole->getNumberHistograms(); ++i) {
+      auto expected = whole->getSpectrum(i).getEvents();
+      auto events = pieces->getSpectrum(i).getEvents();
+      std::sort(expected.begin(), expected.end(), byTofAndPulseTime);
+      std::sort(events.begin(), events.end(), byTofAndPulseTime);
+      if (events != expected)
+        ++mismatches;
+    }
+    TS_ASSERT_EQUALS(mismatches, 0);
+
+    AnalysisDataService::Instance().remove("cncs_whole_banks");
+    AnalysisDataService::Instance().remove("cncs_bank_pieces");
+  }
+
   void test_TOF_filtered_loading() {
     const std::string wsName = "test_filtering";
     const double filterStart = 45000;
@@ -670,6 +716,111 @@ public:
                    ->monitorWorkspace());
   }
 
+  void test_Load_And_CompressEvents_with_small_memory_budget() {
+    LoadEventNexus ld;
+    std::string outws_name = "cncs_compressed_small_budget";
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", outws_name);
+    ld.setPropertyValue("CompressTolerance", "0.05");
+    // Forces the events to be compressed many times while loading
+    ld.setPropertyValue("CompressMemoryBudget", "1");
+    ld.setProperty<bool>("LoadLogs", false);
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    auto WS = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+        outws_name);
+    TS_ASSERT(WS);
+    TS_ASSERT_LESS_THAN(WS->getNumberEvents(), 112266);
+    double totalWeight = 0.;
+    for (size_t wi = 0; wi < WS->getNumberHistograms(); wi++) {
+      const auto &el = WS->getSpectrum(wi);
+      TS_ASSERT_EQUALS(el.getEventType(), WEIGHTED_NOTIME);
+      const auto &events = el.getWeightedEventsNoTime();
+      TS_ASSERT(std::is_sorted(events.cbegin(), events.cend()));
+      for (const auto &event : events)
+        totalWeight += event.weight();
+    }
+    // No events are lost by compressing
+    TS_ASSERT_DELTA(totalWeight, 112266., 1e-6);
+    AnalysisDataService::Instance().remove(outws_name);
+  }
+
+  void test_compressing_in_many_passes_matches_compressing_at_the_end() {
+    // With a zero tolerance only events of equal TOF are combined, so the
+    // passes cannot shift any TOF
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "cncs_compressed_passes");
+    ld.setPropertyValue("CompressTolerance", "0");
+    ld.setPropertyValue("CompressMemoryBudget", "1");
+    ld.setProperty<bool>("LoadLogs", false);
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+    LoadEventNexus ldRef;
+    ldRef.initialize();
+    ldRef.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ldRef.setPropertyValue("OutputWorkspace", "cncs_compressed_at_end");
+    ldRef.setProperty<bool>("LoadLogs", false);
+    ldRef.execute();
+    TS_ASSERT(ldRef.isExecuted());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto WS = ads.retrieveWS<EventWorkspace>("cncs_compressed_passes");
+    auto refWS = ads.retrieveWS<EventWorkspace>("cncs_compressed_at_end");
+    TS_ASSERT_EQUALS(WS->getNumberHistograms(), refWS->getNumberHistograms());
+    for (size_t wi = 0; wi < refWS->getNumberHistograms(); wi++) {
+      auto &ref = refWS->getSpectrum(wi);
+      ref.compressEvents(0., &ref);
+      const auto &expected = ref.getWeightedEventsNoTime();
+      const auto &events = WS->getSpectrum(wi).getWeightedEventsNoTime();
+      TS_ASSERT_EQUALS(events.size(), expected.size());
+      if (events.size() != expected.size())
+        break;
+      for (size_t i = 0; i < events.size(); ++i) {
+        TS_ASSERT_DELTA(events[i].tof(), expected[i].tof(), 1e-6);
+        TS_ASSERT_EQUALS(events[i].weight(), expected[i].weight());
+      }
+    }
+    ads.remove("cncs_compressed_passes");
+    ads.remove("cncs_compressed_at_end");
+  }
+
+  void test_compact_events_use_the_pulse_times_of_the_file() {
+    LoadEventNexus ld;
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", "cncs_compact");
+    ld.setProperty<bool>("CompactEvents", true);
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+    LoadEventNexus ldRef;
+    ldRef.initialize();
+    ldRef.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ldRef.setPropertyValue("OutputWorkspace", "cncs_not_compact");
+    ldRef.execute();
+    TS_ASSERT(ldRef.isExecuted());
+
+    auto &ads = AnalysisDataService::Instance();
+    auto WS = ads.retrieveWS<EventWorkspace>("cncs_compact");
+    auto refWS = ads.retrieveWS<EventWorkspace>("cncs_not_compact");
+    TS_ASSERT_EQUALS(WS->getStorageLayout(), EventStorageLayout::COMPACT);
+    TS_ASSERT_EQUALS(WS->getNumberEvents(), refWS->getNumberEvents());
+    // All events have a pulse time from the file, so all lists are packed
+    TS_ASSERT_LESS_THAN(WS->getMemorySize(), refWS->getMemorySize());
+    for (size_t wi = 0; wi < refWS->getNumberHistograms(); wi += 97) {
+      auto expected = refWS->getSpectrum(wi).getPulseTimes();
+      auto pulseTimes = WS->getSpectrum(wi).getPulseTimes();
+      std::sort(expected.begin(), expected.end());
+      std::sort(pulseTimes.begin(), pulseTimes.end());
+      TS_ASSERT_EQUALS(pulseTimes, expected);
+    }
+    ads.remove("cncs_compact");
+    ads.remove("cncs_not_compact");
+  }
+
   void test_Load_And_CompressEvents() {
     Mantid::API::FrameworkManager::Instance();
     LoadEventNexus ld;
@@ -0,0 +1,131 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/BoxController.h"
+#include "MantidAPI/IBoxControllerIO.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <memory>
+#include <shared_mutex>
+
+namespace Mantid {
+namespace DataObjects {
+
+//===============================================================================================
+/** IBoxControllerIO keeping the events of an MDEventWorkspace in a raw,
+  memory-mapped event file next to the NeXus file.
+
+  The NeXus file holds the box structure as usual. Its event_data group holds
+  the name of the event file instead of the events. The event file is a
+  header followed by the events, one row of coordinates per event, in the
+  same layout as the event_data array written by BoxControllerNeXusIO.
+
+  A file opened for reading is mapped once and never changes, so any number
+  of threads can load blocks at the same time without taking a lock. A file
+  opened for writing grows as blocks are saved; loads then share a lock with
+  the remapping done when the file grows.
+*/
+class DLLExport BoxControllerMappedIO : public API::IBoxControllerIO {
+public:
+  BoxControllerMappedIO(API::BoxController *const bc);
+
+  ///@return true if the file to write events is opened and false otherwise
+  bool isOpened() const override { return m_region != nullptr; }
+  /// get the full file name of the NeXus file used for IO operations
+  const std::string &getFileName() const override { return m_fileName; }
+  /// @return the full name of the file holding the events
+  const std::string &getEventFileName() const { return m_eventFileName; }
+  /**Return the number of events the event file grows by at least*/
+  size_t getDataChunk() const override { return m_dataChunk; }
+
+  bool openFile(const std::string &fileName, const std::string &mode) override;
+
+  void saveBlock(const std::vector<float> & /* DataBlock */,
+                 const uint64_t /*blockPosition*/) const override;
+  void loadBlock(std::vector<float> & /* Block */,
+                 const uint64_t /*blockPosition*/,
+                 const size_t /*BlockSize*/) const override;
+  void saveBlock(const std::vector<double> & /* DataBlock */,
+                 const uint64_t /*blockPosition*/) const override;
+  void loadBlock(std::vector<double> & /* Block */,
+                 const uint64_t /*blockPosition*/,
+                 const size_t /*BlockSize*/) const override;
+
+  void flushData() const override;
+  void closeFile() override;
+
+  ~BoxControllerMappedIO() override;
+  void setDataType(const size_t blockSize,
+                   const std::string &typeName) override;
+  void getDataType(size_t &CoordSize, std::string &typeName) const override;
+  /// @return the number of values held for each event
+  int64_t getNDataColums() const { return m_nColumns; }
+
+  static bool hasEventFile(const std::string &fileName, int nDims,
+                           const std::string &typeName);
+
+private:
+  /// Smallest number of events the event file grows by
+  enum { DATA_CHUNK = 10000 };
+
+  struct Header;
+
+  bool readNeXusPointer();
+  void writeFreeSpaceBlocks();
+  void openEventFile(const bool create);
+  void map();
+  void reserve(const uint64_t nEvents) const;
+  size_t rowBytes() const { return m_nColumns * m_fileCoordSize; }
+  char *eventData() const;
+
+  template <typename Type>
+  void saveGenericBlock(const std::vector<Type> &DataBlock,
+                        const uint64_t blockPosition) const;
+  template <typename Type>
+  void loadGenericBlock(std::vector<Type> &Block, const uint64_t blockPosition,
+                        const size_t nPoints) const;
+
+  /// full name of the NeXus file holding the box structure
+  std::string m_fileName;
+  /// full name of the file holding the events
+  std::string m_eventFileName;
+  /// identifier if the file open only for reading or is  in read/write
+  bool m_ReadOnly;
+  /// the smallest number of events the event file grows by
+  size_t m_dataChunk;
+  /// the box controller using this IO
+  API::BoxController *const m_bc;
+  /// number of bytes in the event coordinates requested by the client
+  size_t m_CoordSize;
+  /// number of bytes in the event coordinates in the event file
+  size_t m_fileCoordSize;
+  /// the name of the event type
+  std::string m_typeName;
+  /// number of values held for each event
+  int64_t m_nColumns;
+
+  /// the event file
+  mutable boost::interprocess::file_mapping m_mapping;
+  /// the mapped event file
+  mutable std::unique_ptr<boost::interprocess::mapped_region> m_region;
+  /// number of events the mapped event file has room for
+  mutable uint64_t m_capacity;
+  /// guards the mapping against remapping while writing
+  mutable std::shared_mutex m_mapMutex;
+
+  /// the name of the Nexus data group for the events
+  static std::string g_EventGroupName;
+  /// the attribute of the event group holding the name of the event file
+  static std::string g_EventFileAttr;
+  /// the group name to save disk buffer data
+  static std::string g_DBDataName;
+};
+} // namespace DataObjects
+} // namespace Mantid
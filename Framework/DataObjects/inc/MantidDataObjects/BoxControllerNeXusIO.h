@@ -56,6 +56,9 @@ public:
   void setDataType(const size_t blockSize,
                    const std::string &typeName) override;
   void getDataType(size_t &CoordSize, std::string &typeName) const override;
+  /// Compress the event data created by openFile. Existing data keep the
+  /// format they were written with.
+  void setCompressed(const bool compressed) { m_compressed = compressed; }
   //------------------------------------------------------------------------------------------------------------------------
   // Auxiliary functions (non-virtual, used for testing)
   int64_t getNDataColums() const { return m_BlockSize[1]; }
@@ -75,6 +78,8 @@ private:
   std::unique_ptr<::NeXus::File> m_File;
   /// identifier if the file open only for reading or is  in read/write
   bool m_ReadOnly;
+  /// if true, new event data are compressed chunk by chunk
+  bool m_compressed;
   /// The size of the events block which can be written in the neXus array at
   /// once (continious part of the data block)
   size_t m_dataChunk;
@@ -0,0 +1,77 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/Events.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/// An event in 8 bytes: a single precision time-of-flight and the index of
+/// its pulse time in a pulse table
+struct CompactEvent {
+  float m_tof;
+  uint32_t m_pulseIndex;
+
+  /// @return the time-of-flight of the event
+  double tof() const { return static_cast<double>(m_tof); }
+};
+
+/** CompactEvents : 8 bytes per event storage for the TofEvent's of one
+  EventList.
+
+  Detector electronics deliver single precision times-of-flight and many
+  consecutive events share a pulse. The time-of-flight is therefore held as a
+  float and the pulse time as a 32 bit index into a sorted table of pulse
+  times, which is normally shared by all the event lists of a workspace. This
+  halves the memory of TofEvent's. Events are only packed when it is lossless,
+  i.e. when every time-of-flight is exactly representable as a float and every
+  pulse time is in the table, so unpacking gives back the original events.
+*/
+class MANTID_DATAOBJECTS_DLL CompactEvents {
+public:
+  /// Sorted pulse times in nanoseconds since the GPS epoch
+  using PulseTable = std::vector<int64_t>;
+
+  static std::shared_ptr<const PulseTable>
+  makePulseTable(std::vector<int64_t> pulseTimes);
+
+  bool pack(std::vector<Types::Event::TofEvent> &events,
+            std::shared_ptr<const PulseTable> pulseTimes);
+  void unpack(std::vector<Types::Event::TofEvent> &events);
+
+  /// Number of events held
+  size_t size() const { return m_events.size(); }
+  /// True if there are no events
+  bool empty() const { return m_events.empty(); }
+  /// @return the events
+  const std::vector<CompactEvent> &events() const { return m_events; }
+
+  void clear();
+  size_t getMemorySize() const;
+
+  void sortTof();
+  void getTofs(std::vector<double> &tofs) const;
+  void generateCountsHistogram(const MantidVec &X, MantidVec &Y) const;
+  void integrate(const double minX, const double maxX, const bool entireRange,
+                 double &sum, double &error) const;
+
+private:
+  /// The events
+  std::vector<CompactEvent> m_events;
+  /// Pulse times the events index into
+  std::shared_ptr<const PulseTable> m_pulseTimes;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
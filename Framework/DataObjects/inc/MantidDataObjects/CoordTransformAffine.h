@@ -53,6 +53,8 @@ public:
                           const Mantid::Kernel::VMD &scaling);
 
   void apply(const coord_t *inputVector, coord_t *outVector) const override;
+  void applyBatch(const coord_t *inputs, coord_t *outputs,
+                  const size_t nPoints) const override;
 
   static CoordTransformAffine *combineTransformations(CoordTransform *first,
                                                       CoordTransform *second);
@@ -49,6 +49,8 @@ public:
   std::string toXMLString() const override;
   std::string id() const override;
   void apply(const coord_t *inputVector, coord_t *outVector) const override;
+  void applyBatch(const coord_t *inputs, coord_t *outputs,
+                  const size_t nPoints) const override;
   Mantid::Kernel::Matrix<coord_t> makeAffineMatrix() const override;
 
 protected:
@@ -0,0 +1,115 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/Events.h"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** EventColumns : structure-of-arrays storage for the events of one
+  EventList.
+
+  The time-of-flight, pulse time, weight and squared error of the events are
+  kept in separate contiguous columns so that kernels that only need the
+  time-of-flight (histogramming, TOF conversion, integration) stream 8 bytes
+  per event instead of the full event structure. Pulse times are only held for
+  TofEvent/WeightedEvent data and weights only for WeightedEvent/
+  WeightedEventNoTime data, so the columns store exactly the information of the
+  corresponding row-wise event vector.
+*/
+class MANTID_DATAOBJECTS_DLL EventColumns {
+public:
+  EventColumns() = default;
+
+  /// Move the events of a row-wise vector into the columns
+  void pack(std::vector<Types::Event::TofEvent> &events);
+  void pack(std::vector<WeightedEvent> &events);
+  void pack(std::vector<WeightedEventNoTime> &events);
+
+  /// Move the content of the columns back into a row-wise vector
+  void unpack(std::vector<Types::Event::TofEvent> &events);
+  void unpack(std::vector<WeightedEvent> &events);
+  void unpack(std::vector<WeightedEventNoTime> &events);
+
+  /// Append a single event
+  inline void push_back(const Types::Event::TofEvent &event) {
+    m_tof.emplace_back(event.tof());
+    m_pulseTime.emplace_back(event.pulseTime().totalNanoseconds());
+  }
+  /// Append a single weighted event
+  inline void push_back(const WeightedEvent &event) {
+    m_tof.emplace_back(event.tof());
+    m_pulseTime.emplace_back(event.pulseTime().totalNanoseconds());
+    m_weight.emplace_back(event.m_weight);
+    m_errorSquared.emplace_back(event.m_errorSquared);
+  }
+  /// Append a single weighted event without pulse time
+  inline void push_back(const WeightedEventNoTime &event) {
+    m_tof.emplace_back(event.tof());
+    m_weight.emplace_back(event.m_weight);
+    m_errorSquared.emplace_back(event.m_errorSquared);
+  }
+
+  /// Number of events held
+  size_t size() const { return m_tof.size(); }
+  /// True if there are no events
+  bool empty() const { return m_tof.empty(); }
+
+  void clear();
+  void reserve(size_t num, bool withPulseTimes, bool withWeights);
+  size_t getMemorySize() const;
+
+  void addUnitWeights();
+  void dropPulseTimes();
+
+  /// @return the time-of-flight column
+  std::vector<double> &tofs() { return m_tof; }
+  /// @return the time-of-flight column
+  const std::vector<double> &tofs() const { return m_tof; }
+  /// @return the pulse time column, in nanoseconds since the GPS epoch
+  const std::vector<int64_t> &pulseTimes() const { return m_pulseTime; }
+  /// @return the weight column
+  const std::vector<float> &weights() const { return m_weight; }
+  /// @return the squared error column
+  const std::vector<float> &errorSquareds() const { return m_errorSquared; }
+
+  void sortTof();
+  void reverse();
+
+  void generateCountsHistogram(const MantidVec &X, MantidVec &Y) const;
+  void generateWeightedHistogram(const MantidVec &X, MantidVec &Y,
+                                 MantidVec &E) const;
+  void integrate(const double minX, const double maxX, const bool entireRange,
+                 double &sum, double &error) const;
+
+  void convertTof(const double factor, const double offset);
+  void convertTof(const std::function<double(double)> &func);
+  void convertUnitsQuickly(const double factor, const double power);
+
+private:
+  template <class T>
+  static void permute(std::vector<T> &column, const std::vector<size_t> &order);
+
+  /// Time-of-flight (or any X unit) of each event
+  std::vector<double> m_tof;
+  /// Pulse time of each event in nanoseconds. Empty for WEIGHTED_NOTIME
+  std::vector<int64_t> m_pulseTime;
+  /// Weight of each event. Empty for TOF
+  std::vector<float> m_weight;
+  /// Squared error of each event. Empty for TOF
+  std::vector<float> m_errorSquared;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -0,0 +1,114 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidKernel/cow_ptr.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** EventHistogramKernel : binning of sorted events.
+
+  Instead of walking every event and testing it against the current bin, the
+  kernel locates the position of each bin edge in the sorted events with an
+  exponential (galloping) search that starts from the previous edge. A bin's
+  count is then the distance between two edge positions and a bin's weight is
+  the sum over a contiguous block of events. The cost therefore scales with the
+  number of bins rather than the number of events, and the same code serves
+  linear, logarithmic and arbitrary bin edges. Vectors of events can be binned
+  by another key than the time-of-flight, e.g. the pulse time, as long as they
+  are sorted by it.
+
+  Searches over a contiguous time-of-flight array finish with a block-wise
+  comparison and the block sums over weight columns are vectorised. Both use
+  AVX2 when the CPU supports it, chosen at runtime, and a scalar fallback
+  otherwise.
+*/
+namespace EventHistogramKernel {
+
+/// True if the vectorised AVX2 code path is used on this machine
+MANTID_DATAOBJECTS_DLL bool usesAVX2();
+
+/** Find the index of the first event with a time-of-flight of at least each
+ * bin edge.
+ * @param tofs :: contiguous times-of-flight, sorted in increasing order
+ * @param numEvents :: number of values in tofs
+ * @param X :: the bin edges
+ * @param positions :: filled with one index per bin edge
+ */
+MANTID_DATAOBJECTS_DLL void findEdges(const double *tofs, size_t numEvents,
+                                      const MantidVec &X,
+                                      std::vector<size_t> &positions);
+
+/** Find the index of the first event with a key of at least each bin edge,
+ * for a vector of event structures.
+ * @param events :: events sorted by key
+ * @param X :: the bin edges
+ * @param positions :: filled with one index per bin edge
+ * @param key :: returns the value of an event to bin by, as a double
+ */
+template <class T, class Key>
+void findEdges(const std::vector<T> &events, const MantidVec &X,
+               std::vector<size_t> &positions, Key key) {
+  const size_t numEvents = events.size();
+  positions.resize(X.size());
+  size_t pos = 0;
+  for (size_t i = 0; i < X.size(); ++i) {
+    const double edge = X[i];
+    // Gallop forward from the previous edge to bracket the new position
+    size_t low = pos;
+    size_t high = pos;
+    size_t step = 1;
+    while (high < numEvents && key(events[high]) < edge) {
+      low = high + 1;
+      high = low + step;
+      step *= 2;
+    }
+    high = std::min(high, numEvents);
+    pos = std::partition_point(
+              events.begin() + low, events.begin() + high,
+              [edge, &key](const T &event) { return key(event) < edge; }) -
+          events.begin();
+    positions[i] = pos;
+  }
+}
+
+/** Find the index of the first event with a time-of-flight of at least each
+ * bin edge, for a vector of event structures.
+ * @param events :: events sorted by time-of-flight
+ * @param X :: the bin edges
+ * @param positions :: filled with one index per bin edge
+ */
+template <class T>
+void findEdges(const std::vector<T> &events, const MantidVec &X,
+               std::vector<size_t> &positions) {
+  findEdges(events, X, positions, [](const T &event) { return event.tof(); });
+}
+
+/** Fill a counts histogram from the edge positions
+ * @param positions :: edge positions from findEdges
+ * @param Y :: the generated counts histogram
+ */
+MANTID_DATAOBJECTS_DLL void countsFromEdges(const std::vector<size_t> &positions,
+                                            MantidVec &Y);
+
+/** Sum a block of a contiguous float column in double precision
+ * @param values :: the column
+ * @param begin :: index of the first value to add
+ * @param end :: one past the index of the last value to add
+ * @return the sum
+ */
+MANTID_DATAOBJECTS_DLL double sum(const float *values, size_t begin,
+                                  size_t end);
+
+} // namespace EventHistogramKernel
+} // namespace DataObjects
+} // namespace Mantid
@@ -7,10 +7,13 @@
 #pragma once
 
 #include "MantidAPI/IEventList.h"
+#include "MantidDataObjects/CompactEvents.h"
+#include "MantidDataObjects/EventColumns.h"
 #include "MantidDataObjects/Events.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/cow_ptr.h"
+#include <atomic>
 #include <iosfwd>
 #include <vector>
 
@@ -38,6 +41,25 @@ enum EventSortType {
   TIMEATSAMPLE_SORT
 };
 
+/// Which algorithm is used to sort the events of an event list.
+enum EventSortAlgorithm {
+  /// Parallel comparison sort
+  COMPARISON_SORT,
+  /// Parallel, stable radix sort on the integer representation of the keys
+  RADIX_SORT
+};
+
+/// How the events of an event list are laid out in memory.
+enum EventStorageLayout {
+  /// One vector of TofEvent, WeightedEvent or WeightedEventNoTime
+  ARRAY_OF_STRUCTS,
+  /// Separate columns for tof, pulse time, weight and error (EventColumns)
+  STRUCT_OF_ARRAYS,
+  /// 8 bytes per TofEvent: float tof and an index into a table of pulse
+  /// times (CompactEvents)
+  COMPACT
+};
+
 //==========================================================================================
 /** @class Mantid::DataObjects::EventList
 
@@ -50,6 +72,18 @@ enum EventSortType {
     or WeightedEvent (where each neutron can have a non-1 weight).
     This is done transparently.
 
+    The events are normally held as a vector of event structures. With the
+    STRUCT_OF_ARRAYS storage layout they are instead held in EventColumns, so
+    that time-of-flight only operations (histogramming, integration, TOF
+    conversion and sorting by TOF) do not need to read pulse times or weights.
+    All other operations, including the event vector accessors, transparently
+    move the events back into a vector first.
+
+    With the COMPACT storage layout, TofEvent's are held in CompactEvents at
+    half their size when that is lossless. Counting, histogramming and sorting
+    by TOF work on the compact events; any other operation moves them back
+    into the event vector for good, until the layout is set again.
+
     @author Janik Zikovsky, SNS ORNL
     @date 4/02/2010
 */
@@ -104,7 +138,12 @@ public:
    * @param event :: TofEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const Types::Event::TofEvent &event) {
-    this->events.emplace_back(event);
+    if (m_compact)
+      unpackCompact();
+    if (m_columnar)
+      m_columns.push_back(event);
+    else
+      this->events.emplace_back(event);
     this->order = UNSORTED;
   }
 
@@ -114,7 +153,12 @@ public:
    * @param event :: WeightedEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEvent &event) {
-    this->weightedEvents.emplace_back(event);
+    if (m_compact)
+      unpackCompact();
+    if (m_columnar)
+      m_columns.push_back(event);
+    else
+      this->weightedEvents.emplace_back(event);
     this->order = UNSORTED;
   }
 
@@ -124,7 +168,12 @@ public:
    * @param event :: WeightedEventNoTime to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEventNoTime &event) {
-    this->weightedEventsNoTime.emplace_back(event);
+    if (m_compact)
+      unpackCompact();
+    if (m_columnar)
+      m_columns.push_back(event);
+    else
+      this->weightedEventsNoTime.emplace_back(event);
     this->order = UNSORTED;
   }
 
@@ -132,6 +181,13 @@ public:
 
   void switchTo(Mantid::API::EventType newType) override;
 
+  void setStorageLayout(const EventStorageLayout layout);
+  void setStorageLayout(
+      const EventStorageLayout layout,
+      const std::shared_ptr<const CompactEvents::PulseTable> &pulseTimes);
+  EventStorageLayout getStorageLayout() const;
+  const EventColumns &getEventColumns();
+
   WeightedEvent getEvent(size_t event_number);
 
   std::vector<Types::Event::TofEvent> &getEvents();
@@ -152,14 +208,16 @@ public:
 
   void reserve(size_t num) override;
 
-  void sort(const EventSortType order) const;
+  void sort(const EventSortType order,
+            const EventSortAlgorithm algorithm = COMPARISON_SORT) const;
 
   void setSortOrder(const EventSortType order) const;
 
-  void sortTof() const;
+  void sortTof(const EventSortAlgorithm algorithm = COMPARISON_SORT) const;
 
   void sortPulseTime() const;
-  void sortPulseTimeTOF() const;
+  void
+  sortPulseTimeTOF(const EventSortAlgorithm algorithm = COMPARISON_SORT) const;
   void sortTimeAtSample(const double &tofFactor, const double &tofShift,
                         bool forceResort = false) const;
 
@@ -210,6 +268,8 @@ public:
   virtual size_t histogram_size() const;
 
   void compressEvents(double tolerance, EventList *destination);
+  void compressAppendedEvents(const double tolerance,
+                              const size_t numCompressed);
   void compressFatEvents(const double tolerance,
                          const Types::Core::DateAndTime &timeStart,
                          const double seconds, EventList *destination);
@@ -296,11 +356,10 @@ public:
                        std::map<int, EventList *> outputs, bool docorrection,
                        double toffactor, double tofshift) const;
 
-  /// Split ...
-  std::string
-  splitByFullTimeMatrixSplitter(const std::vector<int64_t> &vec_splitters_time,
-                                const std::vector<int> &vecgroups,
-                                std::map<int, EventList *> vec_outputEventList,
+  /// Split events by full time to outputs indexed by target
+  void splitByFullTimeToTargets(const std::vector<int64_t> &splitterTimes,
+                                const std::vector<int> &splitterTargets,
+                                const std::vector<EventList *> &outputs,
                                 bool docorrection, double toffactor,
                                 double tofshift) const;
 
@@ -377,9 +436,27 @@ private:
   /// List of WeightedEvent's
   mutable std::vector<WeightedEventNoTime> weightedEventsNoTime;
 
+  /// Events held column-wise, used with the STRUCT_OF_ARRAYS layout
+  mutable EventColumns m_columns;
+
   /// What type of event is in our list.
   Mantid::API::EventType eventType;
 
+  /// Requested memory layout of the events
+  EventStorageLayout m_layout;
+
+  /// True if the events currently live in m_columns rather than the vectors.
+  /// Const methods may unpack the columns, so it is read and written
+  /// atomically.
+  mutable std::atomic<bool> m_columnar;
+
+  /// TofEvent's held in 8 bytes each, used with the COMPACT layout
+  mutable CompactEvents m_compactEvents;
+
+  /// True if the events currently live in m_compactEvents, read and written
+  /// atomically like m_columnar
+  mutable std::atomic<bool> m_compact;
+
   /// Last sorting order
   mutable EventSortType order;
 
@@ -412,6 +489,11 @@ private:
 
   void switchToWeightedEvents();
   void switchToWeightedEventsNoTime();
+  void packColumns();
+  void unpackColumns() const;
+  void packCompact(
+      const std::shared_ptr<const CompactEvents::PulseTable> &pulseTimes);
+  void unpackCompact() const;
   // should not be called externally
   void sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
                              const double seconds) const;
@@ -516,18 +598,19 @@ private:
                                    const std::vector<int> &vec_split_target,
                                    std::map<int, EventList *> outputs,
                                    typename std::vector<T> &events) const;
-
+  /// Append a range of events of the same type to another list
   template <class T>
-  std::string splitByFullTimeVectorSplitterHelper(
-      const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-      std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-      bool docorrection, double toffactor, double tofshift) const;
+  static void
+  appendEventsHelper(EventList &output,
+                     typename std::vector<T>::const_iterator first,
+                     typename std::vector<T>::const_iterator last);
 
   template <class T>
-  std::string splitByFullTimeSparseVectorSplitterHelper(
-      const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-      std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-      bool docorrection, double toffactor, double tofshift) const;
+  void scatterByFullTimeHelper(const std::vector<int64_t> &splitterTimes,
+                               const std::vector<int> &splitterTargets,
+                               const std::vector<EventList *> &outputs,
+                               const std::vector<T> &events, bool docorrection,
+                               double toffactor, double tofshift) const;
 
   template <class T>
   static void multiplyHelper(std::vector<T> &events, const double value,
@@ -135,6 +135,13 @@ public:
   // Change the event type
   void switchEventType(const Mantid::API::EventType type);
 
+  // Change how the events of all event lists are laid out in memory
+  void setStorageLayout(const EventStorageLayout layout);
+  void
+  setStorageLayout(const EventStorageLayout layout,
+                   std::shared_ptr<const CompactEvents::PulseTable> pulseTimes);
+  EventStorageLayout getStorageLayout() const;
+
   // Returns true always - an EventWorkspace always represents histogramm-able
   // data
   bool isHistogramData() const override;
@@ -146,7 +153,8 @@ public:
   EventSortType getSortType() const;
 
   // Sort all event lists. Uses a parallelized algorithm
-  void sortAll(EventSortType sortType, Mantid::API::Progress *prog) const;
+  void sortAll(EventSortType sortType, Mantid::API::Progress *prog,
+               EventSortAlgorithm algorithm = COMPARISON_SORT) const;
   void sortAllOld(EventSortType sortType, Mantid::API::Progress *prog) const;
 
   void getIntegratedSpectra(std::vector<double> &out, const double minX,
@@ -166,6 +174,8 @@ private:
 
   EventList &getSpectrumWithoutInvalidation(const size_t index) override;
 
+  std::shared_ptr<const CompactEvents::PulseTable> makePulseTable() const;
+
   /** A vector that holds the event list for each spectrum; the key is
    * the workspace index, which is not necessarily the pixelid.
    */
@@ -173,6 +183,9 @@ private:
 
   /// Container for the MRU lists of the event lists contained.
   mutable std::unique_ptr<EventWorkspaceMRU> mru;
+
+  /// Memory layout used for the events of all event lists
+  EventStorageLayout m_storageLayout;
 };
 
 /// shared pointer to the EventWorkspace class
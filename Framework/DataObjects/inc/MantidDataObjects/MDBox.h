@@ -189,6 +189,9 @@ public:
       signal_t &signal, signal_t &errorSquared,
       const coord_t innerRadiusSquared = 0.0,
       const bool useOnePercentBackgroundCorrection = true) const override;
+  void integrateSpheres(
+      const std::vector<IntegrationSphere *> &spheres,
+      const bool useOnePercentBackgroundCorrection = true) const override;
   void centroidSphere(Mantid::API::CoordTransform &radiusTransform,
                       const coord_t radiusSquared, coord_t *centroid,
                       signal_t &signal) const override;
@@ -239,6 +242,12 @@ private:
   MDBox(const MDBox &);
   /// common part of mdBox constructor
   void initMDBox(const size_t nBoxEvents);
+  /// integrate the given events within a sphere
+  static void integrateSphereEvents(
+      const std::vector<MDE> &events, API::CoordTransform &radiusTransform,
+      const coord_t radiusSquared, signal_t &signal, signal_t &errorSquared,
+      const coord_t innerRadiusSquared,
+      const bool useOnePercentBackgroundCorrection);
 
 public:
   /// Typedef for a shared pointer to a MDBox
@@ -602,6 +602,58 @@ TMDE(void MDBox)::integrateSphere(
     const bool useOnePercentBackgroundCorrection) const {
   // If the box is cached to disk, you need to retrieve it
   const std::vector<MDE> &events = this->getConstEvents();
+  integrateSphereEvents(events, radiusTransform, radiusSquared, signal,
+                        errorSquared, innerRadiusSquared,
+                        useOnePercentBackgroundCorrection);
+  // it is constant access, so no saving or fiddling with the buffer is needed.
+  // Events just can be dropped if necessary
+  // m_Saveable->releaseEvents();
+  if (m_Saveable) {
+    m_Saveable->setBusy(false);
+  }
+}
+
+/** Integrate the signal within several spheres, retrieving the events only
+ * once.
+ *
+ * @param spheres :: the spheres to integrate; the signal and squared error of
+ *        each is added to its signal and errorSquared members.
+ * @param useOnePercentBackgroundCorrection :: if one percent correction
+ *        should be applied to background.
+ */
+TMDE(void MDBox)::integrateSpheres(
+    const std::vector<IntegrationSphere *> &spheres,
+    const bool useOnePercentBackgroundCorrection) const {
+  // If the box is cached to disk, you need to retrieve it
+  const std::vector<MDE> &events = this->getConstEvents();
+  for (auto *sphere : spheres)
+    integrateSphereEvents(events, *sphere->radiusTransform,
+                          sphere->radiusSquared, sphere->signal,
+                          sphere->errorSquared, sphere->innerRadiusSquared,
+                          useOnePercentBackgroundCorrection);
+  if (m_Saveable) {
+    m_Saveable->setBusy(false);
+  }
+}
+
+/** Integrate the signal of events within a sphere. See integrateSphere().
+ *
+ * @param events :: the events to integrate
+ * @param radiusTransform :: nd-to-1 coordinate transformation that converts
+ *from these
+ *        dimensions to the distance (squared) from the center of the sphere.
+ * @param radiusSquared :: radius^2 below which to integrate
+ * @param[out] signal :: the integrated signal is added to this
+ * @param[out] errorSquared :: the integrated squared error is added to this
+ * @param innerRadiusSquared :: radius^2 above which to integrate
+ * @param useOnePercentBackgroundCorrection :: if one percent correction
+ *should be applied to background.
+ */
+TMDE(void MDBox)::integrateSphereEvents(
+    const std::vector<MDE> &events, API::CoordTransform &radiusTransform,
+    const coord_t radiusSquared, signal_t &signal, signal_t &errorSquared,
+    const coord_t innerRadiusSquared,
+    const bool useOnePercentBackgroundCorrection) {
   if (innerRadiusSquared == 0.0) {
     // For each MDLeanEvent
     for (const auto &it : events) {
@@ -642,12 +694,6 @@ TMDE(void MDBox)::integrateSphere(
       errorSquared += vals[k].second;
     }
   }
-  // it is constant access, so no saving or fiddling with the buffer is needed.
-  // Events just can be dropped if necessary
-  // m_Saveable->releaseEvents();
-  if (m_Saveable) {
-    m_Saveable->setBusy(false);
-  }
 }
 
 /** Integrate the signal within a sphere; for example, to perform single-crystal
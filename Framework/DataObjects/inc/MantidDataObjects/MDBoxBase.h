@@ -26,6 +26,22 @@
 namespace Mantid {
 namespace DataObjects {
 
+/** One of the regions integrated together by MDBoxBase::integrateSpheres().
+ * The region is a sphere or a spherical shell, or any shape that its
+ * radiusTransform reduces to a squared distance, e.g. an ellipsoid. */
+struct DLLExport IntegrationSphere {
+  /// nd-to-1 transformation to the squared distance from the center
+  API::CoordTransform *radiusTransform;
+  /// radius^2 below which to integrate
+  coord_t radiusSquared;
+  /// radius^2 above which to integrate
+  coord_t innerRadiusSquared;
+  /// [out] the integrated signal is added to this
+  signal_t signal;
+  /// [out] the integrated squared error is added to this
+  signal_t errorSquared;
+};
+
 #ifndef __INTEL_COMPILER // As of July 13, the packing has no effect for the
                          // Intel compiler and produces a warning
 #pragma pack(push, 4)    // Ensure the structure is no larger than it needs to
@@ -140,6 +156,11 @@ public:
       const coord_t innerRadiusSquared = 0.0,
       const bool useOnePercentBackgroundCorrection = true) const override = 0;
 
+  /** Integrate several spheres in one pass over the boxes */
+  virtual void
+  integrateSpheres(const std::vector<IntegrationSphere *> &spheres,
+                   const bool useOnePercentBackgroundCorrection = true) const;
+
   /** Find the centroid around a sphere */
   void centroidSphere(Mantid::API::CoordTransform &radiusTransform,
                       const coord_t radiusSquared, coord_t *centroid,
@@ -284,5 +284,25 @@ TMDE(size_t MDBoxBase)::addEventsUnsafe(const std::vector<MDE> &events) {
   return 0;
 }
 
+//---------------------------------------------------------------------------------------------------
+/** Integrate the signal within several spheres. The result is the same as
+ * calling integrateSphere() for each of them; boxes that override this
+ * visit their contents once for all the spheres.
+ *
+ * @param spheres :: the spheres to integrate; the signal and squared error of
+ *        each is added to its signal and errorSquared members.
+ * @param useOnePercentBackgroundCorrection :: if one percent correction
+ *        should be applied to background.
+ */
+TMDE(void MDBoxBase)::integrateSpheres(
+    const std::vector<IntegrationSphere *> &spheres,
+    const bool useOnePercentBackgroundCorrection) const {
+  for (auto *sphere : spheres)
+    integrateSphere(*sphere->radiusTransform, sphere->radiusSquared,
+                    sphere->signal, sphere->errorSquared,
+                    sphere->innerRadiusSquared,
+                    useOnePercentBackgroundCorrection);
+}
+
 } // namespace DataObjects
 } // namespace Mantid
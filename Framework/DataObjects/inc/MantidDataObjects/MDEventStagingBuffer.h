@@ -0,0 +1,139 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/MDBoxBase.h"
+#include "MantidDataObjects/MDGridBox.h"
+#include "MantidKernel/System.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** MDEventStagingBuffer : Collects the events that one thread adds to a box
+  structure and adds them in batches.
+
+  MDBox::addEvent() takes the lock of the box for every event, so threads
+  adding to the same few boxes spend most of their time waiting for each
+  other. A staging buffer keeps the events of one thread until it is full,
+  then groups them by the MDBox they belong to and adds each group with a
+  single MDBox::addEvents() call, taking each lock once per batch.
+
+  Each thread must use its own buffer. The box structure must not be split
+  while buffers are being flushed, and the events still in a buffer are not
+  part of the workspace until flush() is called.
+
+  @date 2020-06-10
+*/
+template <typename MDE, size_t nd> class DLLExport MDEventStagingBuffer {
+public:
+  /// Default number of events kept before they are added to the boxes
+  static constexpr size_t DEFAULT_CAPACITY = 4096;
+
+  /**
+  Constructor
+  @param root : the top box of the structure to add the events to
+  @param capacity : number of events kept before they are added
+  */
+  explicit MDEventStagingBuffer(MDBoxBase<MDE, nd> *root,
+                                size_t capacity = DEFAULT_CAPACITY)
+      : m_root(root), m_capacity(std::max(capacity, size_t(1))) {
+    m_events.reserve(m_capacity);
+  }
+
+  /**
+  Add an event to the buffer, adding the buffered events to the boxes when
+  the buffer is full. As with MDGridBox::addEvent(), no bounds checking is
+  done.
+  @param event : the event to add
+  @return the number of events added to the boxes by this call
+  */
+  size_t addEvent(const MDE &event) {
+    m_events.emplace_back(event);
+    if (m_events.size() < m_capacity)
+      return 0;
+    return flush();
+  }
+
+  /**
+  Add all the buffered events to the boxes they belong to and empty the
+  buffer.
+  @return the number of events added; events outside of the boxes are
+  dropped
+  */
+  size_t flush() {
+    const size_t nEvents = m_events.size();
+    m_leaves.resize(nEvents);
+    for (size_t i = 0; i < nEvents; ++i)
+      m_leaves[i] = findLeaf(m_events[i]);
+
+    // Group the events by box, keeping their order within each box.
+    // std::less gives a total order of pointers to unrelated boxes, which <
+    // does not
+    m_order.resize(nEvents);
+    std::iota(m_order.begin(), m_order.end(), size_t(0));
+    std::stable_sort(m_order.begin(), m_order.end(),
+                     [this](const size_t lhs, const size_t rhs) {
+                       return std::less<const void *>()(m_leaves[lhs],
+                                                        m_leaves[rhs]);
+                     });
+
+    size_t nAdded = 0;
+    for (size_t start = 0; start < nEvents;) {
+      MDBoxBase<MDE, nd> *leaf = m_leaves[m_order[start]];
+      size_t end = start + 1;
+      while (end < nEvents && m_leaves[m_order[end]] == leaf)
+        ++end;
+      if (leaf) {
+        m_group.clear();
+        for (size_t i = start; i < end; ++i)
+          m_group.emplace_back(m_events[m_order[i]]);
+        leaf->addEvents(m_group);
+        nAdded += m_group.size();
+      }
+      start = end;
+    }
+    m_events.clear();
+    return nAdded;
+  }
+
+  /// @return the number of events waiting to be added
+  size_t size() const { return m_events.size(); }
+
+private:
+  /**
+  Find the MDBox that MDGridBox::addEvent() would add the event to.
+  @param event : the event
+  @return the box, or nullptr if the event is outside of all the boxes
+  */
+  MDBoxBase<MDE, nd> *findLeaf(const MDE &event) const {
+    MDBoxBase<MDE, nd> *box = m_root;
+    while (box && !box->isBox())
+      box = static_cast<MDGridBox<MDE, nd> *>(box)->getChildForEvent(event);
+    return box;
+  }
+
+  /// The top box of the structure
+  MDBoxBase<MDE, nd> *m_root;
+  /// Number of events kept before they are added
+  size_t m_capacity;
+  /// The events waiting to be added
+  std::vector<MDE> m_events;
+  /// The box of each waiting event
+  std::vector<MDBoxBase<MDE, nd> *> m_leaves;
+  /// The waiting events, ordered by box
+  std::vector<size_t> m_order;
+  /// The events of one box, as passed to MDBoxBase::addEvents()
+  std::vector<MDE> m_group;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -6,13 +6,21 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidAPI/BoxController.h"
+#include "MantidDataObjects/MDBox.h"
+#include "MantidDataObjects/MDGridBox.h"
+#include "MantidDataObjects/MDLeanEvent.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <atomic>
+#include <mutex>
 #include <queue>
 #include <tbb/parallel_sort.h>
 #include <tbb/task_scheduler_init.h>
 #include <thread>
 
 namespace Mantid {
-namespace MDAlgorithms {
+namespace DataObjects {
 
 /**
  * Class to create the box structure of MDWorkspace. The algorithm:
@@ -21,25 +29,23 @@ namespace MDAlgorithms {
  * it delegates this independent subtask to other tread, syncronisation
  * is implemented with queue and mutex.
  * @tparam ND :: number of Dimensions
- * @tparam MDEventType :: Type of created MDEvent [MDLeanEvent, MDEvent]
+ * @tparam MDE :: Type of created MDEvent [MDLeanEvent, MDEvent]
  * @tparam EventIterator :: Iterator of sorted collection storing the converted
  * events
  */
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
+template <size_t ND, typename MDE, typename EventIterator>
 class MDEventTreeBuilder {
-  using MDEvent = MDEventType<ND>;
-  using IntT = typename MDEvent::IntT;
-  using MortonT = typename MDEvent::MortonT;
-  using BoxBase = DataObjects::MDBoxBase<MDEvent, ND>;
-  using Box = DataObjects::MDBox<MDEvent, ND>;
-  using GridBox = DataObjects::MDGridBox<MDEvent, ND>;
-  using EventDistributor = MDEventTreeBuilder<ND, MDEventType, EventIterator>;
+  using IntT = typename MDE::IntT;
+  using MortonT = typename MDE::MortonT;
+  using BoxBase = MDBoxBase<MDE, ND>;
+  using Box = MDBox<MDE, ND>;
+  using GridBox = MDGridBox<MDE, ND>;
+  using EventDistributor = MDEventTreeBuilder<ND, MDE, EventIterator>;
 
 public:
-  using EventAccessType = DataObjects::EventAccessor;
+  using EventAccessType = EventAccessor;
   using IndexCoordinateSwitcher =
-      typename MDEvent::template AccessFor<EventDistributor>;
+      typename MDE::template AccessFor<EventDistributor>;
   enum WORKER_TYPE { MASTER, SLAVE };
   /**
    * Structure to store the subtask of creating subtree from the
@@ -49,8 +55,8 @@ public:
     BoxBase *root;
     const EventIterator begin;
     const EventIterator end;
-    const typename MDEventType<ND>::MortonT lowerBound;
-    const typename MDEventType<ND>::MortonT upperBound;
+    const MortonT lowerBound;
+    const MortonT upperBound;
     size_t maxDepth;
     unsigned level;
   };
@@ -68,14 +74,14 @@ public:
    * @param mdEvents :: events to distribute around the tree
    * @return :: pointer to the root node and error
    */
-  TreeWithIndexError distribute(std::vector<MDEventType<ND>> &mdEvents);
+  TreeWithIndexError distribute(std::vector<MDE> &mdEvents);
 
 private:
   morton_index::MDCoordinate<ND>
-  convertToIndex(std::vector<MDEventType<ND>> &mdEvents,
+  convertToIndex(std::vector<MDE> &mdEvents,
                  const morton_index::MDSpaceBounds<ND> &space);
-  void sortEvents(std::vector<MDEventType<ND>> &mdEvents);
-  BoxBase *doDistributeEvents(std::vector<MDEventType<ND>> &mdEvents);
+  void sortEvents(std::vector<MDE> &mdEvents);
+  BoxBase *doDistributeEvents(std::vector<MDE> &mdEvents);
   void distributeEvents(Task &tsk, const WORKER_TYPE &wtp);
   void pushTask(Task &&tsk);
   std::unique_ptr<Task> popTask();
@@ -96,9 +102,8 @@ private:
   const MortonT m_mortonMax;
 };
 
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
-MDEventTreeBuilder<ND, MDEventType, EventIterator>::MDEventTreeBuilder(
+template <size_t ND, typename MDE, typename EventIterator>
+MDEventTreeBuilder<ND, MDE, EventIterator>::MDEventTreeBuilder(
     const int numWorkers, const size_t threshold,
     const API::BoxController_sptr &bc,
     const morton_index::MDSpaceBounds<ND> &space)
@@ -114,29 +119,27 @@ MDEventTreeBuilder<ND, MDEventType, EventIterator>::MDEventTreeBuilder(
   }
 }
 
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
-typename MDEventTreeBuilder<ND, MDEventType, EventIterator>::TreeWithIndexError
-MDEventTreeBuilder<ND, MDEventType, EventIterator>::distribute(
-    std::vector<MDEvent> &mdEvents) {
+template <size_t ND, typename MDE, typename EventIterator>
+typename MDEventTreeBuilder<ND, MDE, EventIterator>::TreeWithIndexError
+MDEventTreeBuilder<ND, MDE, EventIterator>::distribute(
+    std::vector<MDE> &mdEvents) {
   auto err = convertToIndex(mdEvents, m_space);
   sortEvents(mdEvents);
   auto root = doDistributeEvents(mdEvents);
   return {root, err};
 }
 
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
-DataObjects::MDBoxBase<MDEventType<ND>, ND> *
-MDEventTreeBuilder<ND, MDEventType, EventIterator>::doDistributeEvents(
-    std::vector<MDEventType<ND>> &mdEvents) {
+template <size_t ND, typename MDE, typename EventIterator>
+MDBoxBase<MDE, ND> *
+MDEventTreeBuilder<ND, MDE, EventIterator>::doDistributeEvents(
+    std::vector<MDE> &mdEvents) {
   if (mdEvents.size() <= m_bc->getSplitThreshold()) {
     m_bc->incBoxesCounter(0);
-    return new DataObjects::MDBox<MDEvent, ND>(
-        m_bc.get(), 0, m_extents, mdEvents.begin(), mdEvents.end());
+    return new Box(m_bc.get(), 0, m_extents, mdEvents.begin(),
+                   mdEvents.end());
   } else {
-    auto root =
-        new DataObjects::MDGridBox<MDEvent, ND>(m_bc.get(), 0, m_extents);
+    m_bc->incGridBoxesCounter(0);
+    auto root = new GridBox(m_bc.get(), 0, m_extents);
     Task tsk{root,
              mdEvents.begin(),
              mdEvents.end(),
@@ -163,11 +166,10 @@ MDEventTreeBuilder<ND, MDEventType, EventIterator>::doDistributeEvents(
   }
 }
 
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
+template <size_t ND, typename MDE, typename EventIterator>
 morton_index::MDCoordinate<ND>
-MDEventTreeBuilder<ND, MDEventType, EventIterator>::convertToIndex(
-    std::vector<MDEventType<ND>> &mdEvents,
+MDEventTreeBuilder<ND, MDE, EventIterator>::convertToIndex(
+    std::vector<MDE> &mdEvents,
     const morton_index::MDSpaceBounds<ND> &space) {
   std::vector<morton_index::MDCoordinate<ND>> perThread(
       m_numWorkers, morton_index::MDCoordinate<ND>(0));
@@ -191,31 +193,27 @@ MDEventTreeBuilder<ND, MDEventType, EventIterator>::convertToIndex(
   return maxErr;
 }
 
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
-void MDEventTreeBuilder<ND, MDEventType, EventIterator>::sortEvents(
-    std::vector<MDEventType<ND>> &mdEvents) {
+template <size_t ND, typename MDE, typename EventIterator>
+void MDEventTreeBuilder<ND, MDE, EventIterator>::sortEvents(
+    std::vector<MDE> &mdEvents) {
   tbb::task_scheduler_init init{m_numWorkers};
   tbb::parallel_sort(mdEvents.begin(), mdEvents.end(),
-                     [](const MDEventType<ND> &a, const MDEventType<ND> &b) {
+                     [](const MDE &a, const MDE &b) {
                        return IndexCoordinateSwitcher::getIndex(a) <
                               IndexCoordinateSwitcher::getIndex(b);
                      });
 }
 
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
-void MDEventTreeBuilder<ND, MDEventType, EventIterator>::pushTask(
-    MDEventTreeBuilder<ND, MDEventType, EventIterator>::Task &&tsk) {
+template <size_t ND, typename MDE, typename EventIterator>
+void MDEventTreeBuilder<ND, MDE, EventIterator>::pushTask(
+    MDEventTreeBuilder<ND, MDE, EventIterator>::Task &&tsk) {
   std::lock_guard<std::mutex> g(m_mutex);
   m_tasks.emplace(tsk);
 }
 
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
-std::unique_ptr<
-    typename MDEventTreeBuilder<ND, MDEventType, EventIterator>::Task>
-MDEventTreeBuilder<ND, MDEventType, EventIterator>::popTask() {
+template <size_t ND, typename MDE, typename EventIterator>
+std::unique_ptr<typename MDEventTreeBuilder<ND, MDE, EventIterator>::Task>
+MDEventTreeBuilder<ND, MDE, EventIterator>::popTask() {
   std::lock_guard<std::mutex> g(m_mutex);
   if (m_tasks.empty())
     return {nullptr};
@@ -226,9 +224,8 @@ MDEventTreeBuilder<ND, MDEventType, EventIterator>::popTask() {
   }
 }
 
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
-void MDEventTreeBuilder<ND, MDEventType, EventIterator>::waitAndLaunchSlave() {
+template <size_t ND, typename MDE, typename EventIterator>
+void MDEventTreeBuilder<ND, MDE, EventIterator>::waitAndLaunchSlave() {
   while (true) {
     auto pTsk = popTask();
     if (pTsk)
@@ -244,9 +241,8 @@ void MDEventTreeBuilder<ND, MDEventType, EventIterator>::waitAndLaunchSlave() {
  * Does actual work on creating tasks in MASTER mode and
  * executing tasks in SLAVE mode
  */
-template <size_t ND, template <size_t> class MDEventType,
-          typename EventIterator>
-void MDEventTreeBuilder<ND, MDEventType, EventIterator>::distributeEvents(
+template <size_t ND, typename MDE, typename EventIterator>
+void MDEventTreeBuilder<ND, MDE, EventIterator>::distributeEvents(
     Task &tsk, const WORKER_TYPE &wtp) {
   const size_t childBoxCount = m_bc->getNumSplit();
   const size_t splitThreshold = m_bc->getSplitThreshold();
@@ -362,5 +358,5 @@ void MDEventTreeBuilder<ND, MDEventType, EventIterator>::distributeEvents(
   }
 }
 
-} // namespace MDAlgorithms
+} // namespace DataObjects
 } // namespace Mantid
@@ -9,6 +9,7 @@
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDBoxIterator.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
+#include "MantidDataObjects/MDEventTreeBuilder.h"
 #include "MantidDataObjects/MDFramesToSpecialCoordinateSystem.h"
 #include "MantidDataObjects/MDGridBox.h"
 #include "MantidDataObjects/MDLeanEvent.h"
@@ -20,10 +21,12 @@
 #include "MantidKernel/FunctionTask.h"
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadScheduler.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/WarningSuppressions.h"
@@ -597,6 +600,122 @@ TMDE(size_t MDEventWorkspace)::addEvents(const std::vector<MDE> &events) {
   return data->addEvents(events);
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Add a batch of events to the workspace, building the box structure for
+ * all of them in one pass.
+ *
+ * The events are sorted in parallel along a Morton (Z-order) curve. The events
+ * of every box, at any depth, are then a contiguous range of the vector, so
+ * the MDGridBox hierarchy is built from the top down without moving events
+ * from box to box. This replaces the boxes of the workspace; the events it
+ * already holds are appended to the batch first.
+ *
+ * The Morton ordering needs every box split into the same power of 2 along
+ * each dimension. Otherwise, or for file-backed workspaces, the events are
+ * added with addEvents() and the boxes split with splitAllIfNeeded().
+ * Either way the cached signal and number of points are up to date on return.
+ *
+ * @param events :: events to add. They are reordered, and the events already
+ *        in the workspace may be appended to them.
+ * @param numThreads :: number of threads to use; -1 to use them all.
+ * @return the number of events that were rejected (because of being out of
+ *bounds)
+ */
+TMDE(size_t MDEventWorkspace)::buildFromEvents(std::vector<MDE> &events,
+                                               int numThreads) {
+  if (numThreads < 1)
+    numThreads = PARALLEL_GET_MAX_THREADS;
+
+  // Morton indices of more than 8 dimensions do not fit the index type
+  if constexpr (nd >= 2 && nd <= 8) {
+    const auto &splitInto = m_BoxController->getSplitIntoAll();
+    const size_t split = splitInto.front();
+    const bool mortonSplit =
+        split > 1 && (split & (split - 1)) == 0 &&
+        std::all_of(splitInto.cbegin(), splitInto.cend(),
+                    [split](size_t n) { return n == split; }) &&
+        !m_BoxController->getSplitTopInto();
+
+    if (mortonSplit && !isFileBacked()) {
+      std::vector<API::IMDNode *> boxes;
+      data->getBoxes(boxes, 1000, true);
+      for (auto node : boxes) {
+        auto *box = dynamic_cast<MDBox<MDE, nd> *>(node);
+        if (!box)
+          continue;
+        const std::vector<MDE> &boxEvents = box->getConstEvents();
+        events.insert(events.end(), boxEvents.cbegin(), boxEvents.cend());
+        box->releaseEvents();
+      }
+
+      std::vector<Mantid::Geometry::MDDimensionExtents<coord_t>> extents(nd);
+      morton_index::MDSpaceBounds<nd> space;
+      for (size_t d = 0; d < nd; ++d) {
+        extents[d] = data->getExtents(d);
+        space(d, 0) = extents[d].getMin();
+        space(d, 1) = extents[d].getMax();
+      }
+      const auto firstBad = std::remove_if(
+          events.begin(), events.end(), [&extents](const MDE &event) {
+            for (size_t d = 0; d < nd; ++d)
+              if (extents[d].outside(event.getCenter(d)))
+                return true;
+            return false;
+          });
+      const auto numBad =
+          static_cast<size_t>(std::distance(firstBad, events.end()));
+      events.erase(firstBad, events.end());
+
+      // The builder counts the boxes it makes
+      const size_t nDepths = m_BoxController->getNumMDBoxes().size();
+      for (size_t depth = 0; depth < nDepths; ++depth) {
+        m_BoxController->clearBoxesCounter(depth);
+        m_BoxController->clearGridBoxesCounter(depth);
+      }
+
+      using TreeBuilder =
+          MDEventTreeBuilder<nd, MDE, typename std::vector<MDE>::iterator>;
+      TreeBuilder builder(numThreads, events.size() / numThreads / 10,
+                          m_BoxController, space);
+      auto tree = builder.distribute(events);
+      this->setBox(tree.root);
+      tree.root->calculateGridCaches();
+
+      // Number the boxes breadth first. The children of every MDGridBox then
+      // have consecutive IDs, as MDBoxFlatTree expects when saving.
+      size_t id = 0;
+      tree.root->setID(id++);
+      std::vector<API::IMDNode *> level{tree.root};
+      while (!level.empty()) {
+        std::vector<API::IMDNode *> nextLevel;
+        for (auto node : level)
+          for (size_t i = 0; i < node->getNumChildren(); ++i) {
+            node->getChild(i)->setID(id++);
+            nextLevel.emplace_back(node->getChild(i));
+          }
+        level.swap(nextLevel);
+      }
+      m_BoxController->setMaxId(id);
+
+      logger.debug() << "Largest coordinate error of the Morton indices is "
+                     << tree.err.transpose() << '\n';
+      return numBad;
+    }
+  }
+
+  if (!isGridBox() && data->getNPoints() + events.size() >
+                          m_BoxController->getSplitThreshold())
+    splitBox();
+  const size_t numBad = data->addEvents(events);
+  auto *ts =
+      new Kernel::ThreadSchedulerWorkStealing(static_cast<size_t>(numThreads));
+  Kernel::ThreadPool tp(ts, numThreads);
+  data->splitAllIfNeeded(ts);
+  tp.joinAll();
+  data->refreshCache();
+  return numBad;
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Split the contained MDBox into a MDGridBox or MDSplitBox, if it is not
  * that already.
@@ -138,6 +138,7 @@ public:
   //----------------------------------------------------------------------------------------------------------------------
   size_t addEvent(const MDE &event) override;
   size_t addEventUnsafe(const MDE &event) override;
+  MDBoxBase<MDE, nd> *getChildForEvent(const MDE &event) const;
 
   /*--------------->  EVENTS from event data
    * <-------------------------------------------------------------*/
@@ -164,6 +165,9 @@ public:
       signal_t &signal, signal_t &errorSquared,
       const coord_t innerRadiusSquared = 0.0,
       const bool useOnePercentBackgroundCorrection = true) const override;
+  void integrateSpheres(
+      const std::vector<IntegrationSphere *> &spheres,
+      const bool useOnePercentBackgroundCorrection = true) const override;
 
   void centroidSphere(Mantid::API::CoordTransform &radiusTransform,
                       const coord_t radiusSquared, coord_t *centroid,
@@ -225,6 +229,13 @@ private:
   /// Compute the index of the child box for the given event
   size_t calculateChildIndex(const MDE &event) const;
 
+  /// How a child box lies with respect to an integration sphere
+  enum class SphereOverlap : char { None, Partial, Full };
+  void getSphereOverlaps(API::CoordTransform &radiusTransform,
+                         const coord_t radiusSquared,
+                         const coord_t innerRadiusSquared,
+                         std::vector<SphereOverlap> &overlaps) const;
+
   /// Each dimension is split into this many equally-sized boxes
   size_t split[nd];
   /** Cumulative dimension splitting: split[n] = 1*split[0]*split[..]*split[n-1]
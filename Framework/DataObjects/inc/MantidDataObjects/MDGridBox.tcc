@@ -1134,17 +1134,90 @@ TMDE(void MDGridBox)::integrateSphere(
     API::CoordTransform &radiusTransform, const coord_t radiusSquared,
     signal_t &signal, signal_t &errorSquared, const coord_t innerRadiusSquared,
     const bool useOnePercentBackgroundCorrection) const {
+  std::vector<SphereOverlap> overlaps;
+  getSphereOverlaps(radiusTransform, radiusSquared, innerRadiusSquared,
+                    overlaps);
+
+  for (size_t i = 0; i < numBoxes; ++i) {
+    API::IMDNode *box = m_Children[i];
+    if (overlaps[i] == SphereOverlap::Full) {
+      // Use the integrated sum of signal in the box
+      signal += box->getSignal();
+      errorSquared += box->getErrorSquared();
+    } else if (overlaps[i] == SphereOverlap::Partial) {
+      // Use the detailed integration method.
+      box->integrateSphere(radiusTransform, radiusSquared, signal, errorSquared,
+                           innerRadiusSquared,
+                           useOnePercentBackgroundCorrection);
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Integrate the signal within several spheres at once. Each child box is
+ * visited once for all the spheres that partially contain it, so boxes shared
+ * by neighbouring spheres are only loaded and traversed once.
+ *
+ * @param spheres :: the spheres to integrate; the signal and squared error of
+ *        each is added to its signal and errorSquared members.
+ * @param useOnePercentBackgroundCorrection :: if one percent correction
+ *        should be applied to background.
+ */
+TMDE(void MDGridBox)::integrateSpheres(
+    const std::vector<IntegrationSphere *> &spheres,
+    const bool useOnePercentBackgroundCorrection) const {
+  // The overlap of every child box with every sphere
+  std::vector<SphereOverlap> overlaps;
+  std::vector<SphereOverlap> sphereOverlaps;
+  overlaps.reserve(spheres.size() * numBoxes);
+  for (const auto *sphere : spheres) {
+    getSphereOverlaps(*sphere->radiusTransform, sphere->radiusSquared,
+                      sphere->innerRadiusSquared, sphereOverlaps);
+    overlaps.insert(overlaps.end(), sphereOverlaps.begin(),
+                    sphereOverlaps.end());
+  }
+
+  // Visit the boxes in the same order as integrateSphere() so that each
+  // sphere sums up its signal in the same order.
+  std::vector<IntegrationSphere *> partialSpheres;
+  for (size_t i = 0; i < numBoxes; ++i) {
+    API::IMDNode *box = m_Children[i];
+    partialSpheres.clear();
+    for (size_t j = 0; j < spheres.size(); ++j) {
+      const auto overlap = overlaps[j * numBoxes + i];
+      if (overlap == SphereOverlap::Full) {
+        spheres[j]->signal += box->getSignal();
+        spheres[j]->errorSquared += box->getErrorSquared();
+      } else if (overlap == SphereOverlap::Partial) {
+        partialSpheres.emplace_back(spheres[j]);
+      }
+    }
+    if (!partialSpheres.empty())
+      m_Children[i]->integrateSpheres(partialSpheres,
+                                      useOnePercentBackgroundCorrection);
+  }
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Find how each child box lies with respect to an integration sphere: fully
+ * contained, possibly partially contained, or outside of it.
+ *
+ * @param radiusTransform :: nd-to-1 coordinate transformation that converts
+ *        from these dimensions to the distance (squared) from the center of
+ *        the sphere.
+ * @param radiusSquared :: radius^2 below which to integrate
+ * @param innerRadiusSquared :: radius^2 above which to integrate
+ * @param overlaps [out] :: set to the overlap of each child box
+ */
+TMDE(void MDGridBox)::getSphereOverlaps(
+    API::CoordTransform &radiusTransform, const coord_t radiusSquared,
+    const coord_t innerRadiusSquared,
+    std::vector<SphereOverlap> &overlaps) const {
   // We start by looking at the vertices at every corner of every box contained,
   // to see which boxes are partially contained/fully contained.
 
   // One entry with the # of vertices in this box contained; start at 0.
-  auto verticesContained = new size_t[numBoxes];
-  memset(verticesContained, 0, numBoxes * sizeof(size_t));
-
-  // Set to true if there is a possibility of the box at least partly touching
-  // the integration volume.
-  auto boxMightTouch = new bool[numBoxes];
-  memset(boxMightTouch, 0, numBoxes * sizeof(bool));
+  std::vector<size_t> verticesContained(numBoxes, 0);
 
   // How many vertices does one box have? 2^nd, or bitwise shift left 1 by nd
   // bits
@@ -1227,35 +1300,17 @@ TMDE(void MDGridBox)::integrateSphere(
   }
 
   // OK, we've done all the vertices. Now we go through and check each box.
-  size_t numFullyContained = 0;
-  size_t numPartiallyContained = 0;
-
+  overlaps.assign(numBoxes, SphereOverlap::None);
   for (size_t i = 0; i < numBoxes; ++i) {
-    API::IMDNode *box = m_Children[i];
-    // Box partially contained?
-    bool partialBox = false;
-
     // Is this box fully contained?
     if (verticesContained[i] >= maxVertices) {
-      // Use the integrated sum of signal in the box
-      signal += box->getSignal();
-      errorSquared += box->getErrorSquared();
-
-      //        std::cout << "box at " << i << " (" << box->getExtentsStr() <<
-      //        ") is fully contained. Vertices = " << verticesContained[i] <<
-      //        "\n";
-
-      numFullyContained++;
-      // Go on to the next box
-      continue;
-    }
-
-    if (verticesContained[i] == 0) {
+      overlaps[i] = SphereOverlap::Full;
+    } else if (verticesContained[i] == 0) {
       // There is a chance that this part of the box is within integration
       // volume,
       // even if no vertex of it is.
       coord_t boxCenter[nd];
-      box->getCenter(boxCenter);
+      m_Children[i]->getCenter(boxCenter);
 
       // Distance from center to the peak integration center
       coord_t out[nd];
@@ -1267,31 +1322,12 @@ TMDE(void MDGridBox)::integrateSphere(
         // touching.
         // (We multiply by 0.72 (about sqrt(2)) to look for half the diagonal).
         // NOTE! Watch out for non-spherical transforms!
-        //          std::cout << "box at " << i << " is maybe touching\n";
-        partialBox = true;
+        overlaps[i] = SphereOverlap::Partial;
       }
     } else {
-      partialBox = true;
-      //        std::cout << "box at " << i << " has a vertex touching\n";
-    }
-
-    // We couldn't rule out that the box might be partially contained.
-    if (partialBox) {
-      // Use the detailed integration method.
-      box->integrateSphere(radiusTransform, radiusSquared, signal, errorSquared,
-                           innerRadiusSquared,
-                           useOnePercentBackgroundCorrection);
-      //        std::cout << ".signal=" << signal << "\n";
-      numPartiallyContained++;
+      overlaps[i] = SphereOverlap::Partial;
     }
-  } // (for each box)
-
-  //    std::cout << "Depth " << this->getDepth() << " with " <<
-  //    numFullyContained << " fully contained; " << numPartiallyContained << "
-  //    partial. Signal = " << signal <<"\n";
-
-  delete[] verticesContained;
-  delete[] boxMightTouch;
+  }
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -1723,6 +1759,29 @@ TMDE(inline size_t MDGridBox)::addEventUnsafe(const MDE &event) {
     return 0;
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Find the child box that addEvent() would add the event to. The child may
+ * itself be a MDGridBox.
+ *
+ * Warning! No bounds checking is done, as in addEvent().
+ *
+ * @param event :: reference to a MDEvent
+ * @return the child box, or nullptr if the event is not in any child
+ * */
+TMDE(inline MDBoxBase<MDE, nd> *MDGridBox)::getChildForEvent(
+    const MDE &event) const {
+  size_t cindex = calculateChildIndex(event);
+
+  // Events on the upper boundary of the last child box go to the last box
+  if (cindex == numBoxes)
+    cindex = numBoxes - 1;
+
+  if (cindex < numBoxes)
+    return m_Children[cindex];
+  else
+    return nullptr;
+}
+
 /**Sets particular child MDgridBox at the index, specified by the input
  *parameters
  *@param index     -- the position of the new child in the list of GridBox
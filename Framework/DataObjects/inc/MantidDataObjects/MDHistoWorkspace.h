@@ -16,6 +16,7 @@
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
 #include "MantidGeometry/MDGeometry/MDImplicitFunction.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/ZeroedAllocator.h"
 
 namespace Mantid {
 namespace DataObjects {
@@ -31,6 +32,13 @@ namespace DataObjects {
  *
  * This will be used by ParaView e.g. for visualization.
  *
+ * The bins are held in dense arrays whose memory is only committed for the
+ * pages that are written to. Operations leave alone the bricks of bins that
+ * hold nothing, so a histogram of mostly-empty space uses memory only where
+ * it has data. Setting MDHistoWorkspace.SparseStorage in the configuration
+ * creates the workspace zeroed instead of filled with NaN, which leaves it
+ * empty until it is written.
+ *
  * @author Janik Zikovsky
  * @date 2011-03-24 11:21:06.280523
  */
@@ -460,17 +468,20 @@ private:
 
   void initVertexesArray();
 
+  /// Array of values for each bin, only using memory where written to
+  using BinArray = std::vector<signal_t, Kernel::ZeroedAllocator<signal_t>>;
+
   /// Number of dimensions in this workspace
   size_t numDimensions;
 
   /// Linear array of signals for each bin
-  std::vector<signal_t> m_signals;
+  BinArray m_signals;
 
   /// Linear array of errors for each bin
-  std::vector<signal_t> m_errorsSquared;
+  BinArray m_errorsSquared;
 
   /// Number of contributing events for each bin.
-  std::vector<signal_t> m_numEvents;
+  BinArray m_numEvents;
 
   /// Length of the m_signals / m_errorsSquared arrays.
   size_t m_length;
@@ -522,7 +533,7 @@ protected:
 
   /// Linear array of masks for each bin. Avoids using vector<bool>
   /// due to performance concerns.
-  std::unique_ptr<bool[]> m_masks;
+  std::unique_ptr<bool[], Kernel::ZeroedAllocator<bool>::Deleter> m_masks;
 };
 
 /// A shared pointer to a MDHistoWorkspace
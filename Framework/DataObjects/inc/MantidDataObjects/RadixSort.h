@@ -0,0 +1,120 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "tbb/blocked_range.h"
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/** RadixSort : stable least-significant-digit radix sort on 64 bit keys.
+
+  The data is split into fixed size chunks. Each pass counts the digits of every
+  chunk and scatters the chunks into a scratch buffer in parallel, so a single
+  large vector is spread over all threads. Digits that are identical for every
+  key (e.g. the exponent of times-of-flight in a narrow range, or the high bits
+  of pulse times within one run) are detected up front and their passes
+  skipped.
+*/
+namespace RadixSort {
+
+namespace detail {
+constexpr uint64_t SIGN_BIT = uint64_t(1) << 63;
+constexpr size_t DIGIT_BITS = 8;
+constexpr size_t NUM_BUCKETS = size_t(1) << DIGIT_BITS;
+constexpr size_t NUM_DIGITS = 64 / DIGIT_BITS;
+constexpr size_t CHUNK_SIZE = size_t(1) << 16;
+} // namespace detail
+
+/// Map a double onto an unsigned integer that sorts in the same order
+inline uint64_t orderedKey(const double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (bits & detail::SIGN_BIT) ? ~bits : (bits | detail::SIGN_BIT);
+}
+
+/// Map a signed integer onto an unsigned integer that sorts in the same order
+inline uint64_t orderedKey(const int64_t value) {
+  return static_cast<uint64_t>(value) ^ detail::SIGN_BIT;
+}
+
+/** Stable sort of a vector by a 64 bit key
+ * @param data :: the values to sort
+ * @param key :: functor returning the uint64_t sort key of a value
+ */
+template <class T, class KeyFunc>
+void sort(std::vector<T> &data, const KeyFunc &key) {
+  using namespace detail;
+  const size_t numValues = data.size();
+  if (numValues < 2)
+    return;
+  const size_t numChunks = (numValues + CHUNK_SIZE - 1) / CHUNK_SIZE;
+  const auto chunkEnd = [numValues](const size_t chunk) {
+    return std::min((chunk + 1) * CHUNK_SIZE, numValues);
+  };
+
+  // Bits that differ from the first key anywhere. Digits without any are
+  // shared by all keys and need no pass.
+  const uint64_t firstKey = key(data.front());
+  const uint64_t varyingBits = tbb::parallel_reduce(
+      tbb::blocked_range<size_t>(0, numValues, CHUNK_SIZE), uint64_t(0),
+      [&](const tbb::blocked_range<size_t> &range, uint64_t bits) {
+        for (size_t i = range.begin(); i < range.end(); ++i)
+          bits |= key(data[i]) ^ firstKey;
+        return bits;
+      },
+      [](const uint64_t lhs, const uint64_t rhs) { return lhs | rhs; });
+  if (varyingBits == 0)
+    return;
+
+  std::vector<T> buffer(numValues);
+  std::vector<std::array<size_t, NUM_BUCKETS>> offsets(numChunks);
+  for (size_t digit = 0; digit < NUM_DIGITS; ++digit) {
+    const size_t shift = digit * DIGIT_BITS;
+    if (((varyingBits >> shift) & (NUM_BUCKETS - 1)) == 0)
+      continue;
+    const auto bucket = [&key, shift](const T &value) {
+      return static_cast<size_t>((key(value) >> shift) & (NUM_BUCKETS - 1));
+    };
+
+    // Count the digits in each chunk
+    tbb::parallel_for(size_t(0), numChunks, [&](const size_t chunk) {
+      auto &counts = offsets[chunk];
+      counts.fill(0);
+      for (size_t i = chunk * CHUNK_SIZE; i < chunkEnd(chunk); ++i)
+        ++counts[bucket(data[i])];
+    });
+    // Turn the counts into the output position of each chunk's buckets
+    size_t position = 0;
+    for (size_t b = 0; b < NUM_BUCKETS; ++b) {
+      for (auto &chunkOffsets : offsets) {
+        const size_t count = chunkOffsets[b];
+        chunkOffsets[b] = position;
+        position += count;
+      }
+    }
+    // Scatter, keeping the order within each bucket
+    tbb::parallel_for(size_t(0), numChunks, [&](const size_t chunk) {
+      auto &chunkOffsets = offsets[chunk];
+      for (size_t i = chunk * CHUNK_SIZE; i < chunkEnd(chunk); ++i)
+        buffer[chunkOffsets[bucket(data[i])]++] = data[i];
+    });
+    data.swap(buffer);
+  }
+}
+
+} // namespace RadixSort
+} // namespace DataObjects
+} // namespace Mantid
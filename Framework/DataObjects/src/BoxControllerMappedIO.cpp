@@ -0,0 +1,463 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/BoxControllerMappedIO.h"
+
+#include "MantidAPI/FileFinder.h"
+#include "MantidDataObjects/MDBoxFlatTree.h"
+#include "MantidDataObjects/MDEvent.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Exception.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <nexus/NeXusFile.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace ip = boost::interprocess;
+
+namespace Mantid {
+namespace DataObjects {
+
+std::string BoxControllerMappedIO::g_EventGroupName("event_data");
+std::string BoxControllerMappedIO::g_EventFileAttr("event_file");
+std::string BoxControllerMappedIO::g_DBDataName("free_space_blocks");
+
+/// The start of the event file. The events follow it.
+struct BoxControllerMappedIO::Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t coordSize;
+  uint64_t nColumns;
+  uint64_t nEvents;
+  char typeName[32];
+};
+
+namespace {
+constexpr char MAGIC[8] = {'M', 'D', 'E', 'V', 'E', 'N', 'T', 'S'};
+constexpr uint32_t VERSION = 1;
+
+/// Copy n values, converting them between float and double
+template <typename FROM, typename TO>
+void convertValues(const FROM *in, TO *out, const size_t n) {
+  std::transform(in, in + n, out,
+                 [](const FROM value) { return static_cast<TO>(value); });
+}
+} // namespace
+
+/**Constructor
+ @param bc pointer to the box controller which uses this IO operations
+*/
+BoxControllerMappedIO::BoxControllerMappedIO(API::BoxController *const bc)
+    : m_ReadOnly(true), m_dataChunk(DATA_CHUNK), m_bc(bc),
+      m_CoordSize(sizeof(coord_t)), m_fileCoordSize(sizeof(coord_t)),
+      m_typeName(MDEvent<1>::getTypeName()),
+      m_nColumns(4 + m_bc->getNDims()), m_capacity(0) {}
+
+/** Set up the event type and the size of the event coordinates used by the
+ * save/load operations.
+ * @param blockSize -- size (in bytes) of the event coordinates. 4 and 8 are
+ *                     supported only e.g. float and double
+ * @param typeName  -- the name of the event used in the operations
+ */
+void BoxControllerMappedIO::setDataType(const size_t blockSize,
+                                        const std::string &typeName) {
+  if (blockSize != 4 && blockSize != 8)
+    throw std::invalid_argument("The class currently supports 4(float) and "
+                                "8(double) event coordinates only");
+  const auto nDims = static_cast<int64_t>(m_bc->getNDims());
+  if (typeName == MDLeanEvent<1>::getTypeName())
+    m_nColumns = 2 + nDims;
+  else if (typeName == MDEvent<1>::getTypeName())
+    m_nColumns = 4 + nDims;
+  else
+    throw std::invalid_argument("Unsupported event type: " + typeName +
+                                " provided ");
+  m_CoordSize = blockSize;
+  m_typeName = typeName;
+}
+
+/** @return CoordSize -- size (in bytes) of the event coordinates
+ *  @return typeName  -- the name of the event used in the operations
+ */
+void BoxControllerMappedIO::getDataType(size_t &CoordSize,
+                                        std::string &typeName) const {
+  CoordSize = m_CoordSize;
+  typeName = m_typeName;
+}
+
+/**Open the file to use in IO operations with events
+ *
+ *@param fileName -- the name of the NeXus file to open. Search for file
+ *performed within the Mantid search path.
+ *@param mode  -- opening mode (read or read/write)
+ *@return false if the file had been already opened
+ */
+bool BoxControllerMappedIO::openFile(const std::string &fileName,
+                                     const std::string &mode) {
+  // file already opened
+  if (m_region)
+    return false;
+
+  std::unique_lock<std::shared_mutex> lock(m_mapMutex);
+  m_ReadOnly = mode.find('w') == std::string::npos &&
+               mode.find('W') == std::string::npos;
+
+  // open file if it exists or crate it if not in the mode requested
+  m_fileName = API::FileFinder::Instance().getFullPath(fileName);
+  if (m_fileName.empty()) {
+    if (m_ReadOnly)
+      throw Kernel::Exception::FileError("Can not open file to read ",
+                                         fileName);
+    std::string filePath =
+        Kernel::ConfigService::Instance().getString("defaultsave.directory");
+    if (filePath.empty())
+      m_fileName = fileName;
+    else
+      m_fileName = filePath + "/" + fileName;
+  }
+
+  const bool newEventGroup = readNeXusPointer();
+  openEventFile(newEventGroup);
+  return true;
+}
+
+/** Find the name of the event file in the NeXus file, or add it to the NeXus
+ * file if it is not there yet. The free space blocks of the disk buffer are
+ * read too.
+ * @return true if the event group was created in the NeXus file
+ */
+bool BoxControllerMappedIO::readNeXusPointer() {
+  auto nDims = static_cast<int>(m_bc->getNDims());
+  bool groupExists;
+  auto file = std::unique_ptr<::NeXus::File>(
+      MDBoxFlatTree::createOrOpenMDWSgroup(m_fileName, nDims, m_typeName,
+                                           m_ReadOnly, groupExists));
+
+  std::map<std::string, std::string> groupEntries;
+  file->getEntries(groupEntries);
+  std::string eventFile;
+  bool created = false;
+  if (groupEntries.find(g_EventGroupName) != groupEntries.end()) {
+    file->openGroup(g_EventGroupName, "NXdata");
+    if (!file->hasAttr(g_EventFileAttr))
+      throw Kernel::Exception::FileError(
+          "The events are held in the NeXus file, not in an event file",
+          m_fileName);
+    file->getAttr(g_EventFileAttr, eventFile);
+
+    groupEntries.clear();
+    file->getEntries(groupEntries);
+    if (groupEntries.find(g_DBDataName) != groupEntries.end()) {
+      std::vector<uint64_t> freeSpaceBlocks;
+      file->readData(g_DBDataName, freeSpaceBlocks);
+      this->setFreeSpaceVector(freeSpaceBlocks);
+    }
+  } else {
+    if (m_ReadOnly)
+      throw Kernel::Exception::FileError(
+          "The NXdata group: " + g_EventGroupName +
+              " does not exist in the file opened for read",
+          m_fileName);
+    // The event file sits next to the NeXus file and is found relative to it
+    eventFile = Poco::Path(m_fileName).getFileName() + ".events";
+    file->makeGroup(g_EventGroupName, "NXdata", true);
+    file->putAttr("version", "1.0");
+    file->putAttr(g_EventFileAttr, eventFile);
+    created = true;
+  }
+  file->closeGroup(); // close events group
+  file->closeGroup(); // close workspace group
+  file->close();
+
+  m_eventFileName = Poco::Path(m_fileName)
+                        .parent()
+                        .resolve(Poco::Path(eventFile))
+                        .toString();
+  return created;
+}
+
+/** Write the free space blocks of the disk buffer into the NeXus file */
+void BoxControllerMappedIO::writeFreeSpaceBlocks() {
+  std::vector<uint64_t> freeSpaceBlocks;
+  this->getFreeSpaceVector(freeSpaceBlocks);
+  if (freeSpaceBlocks.empty())
+    freeSpaceBlocks.resize(2, 0); // Needs a minimum size
+  std::vector<int64_t> free_dims(2, 2);
+  free_dims[0] = int64_t(freeSpaceBlocks.size() / 2);
+
+  auto nDims = static_cast<int>(m_bc->getNDims());
+  bool groupExists;
+  auto file = std::unique_ptr<::NeXus::File>(
+      MDBoxFlatTree::createOrOpenMDWSgroup(m_fileName, nDims, m_typeName,
+                                           false, groupExists));
+  file->openGroup(g_EventGroupName, "NXdata");
+  std::map<std::string, std::string> groupEntries;
+  file->getEntries(groupEntries);
+  if (groupEntries.find(g_DBDataName) != groupEntries.end()) {
+    file->writeUpdatedData(g_DBDataName, freeSpaceBlocks, free_dims);
+  } else {
+    std::vector<int64_t> free_chunk(2, 2);
+    free_chunk[0] = int64_t(m_dataChunk);
+    file->writeExtendibleData(g_DBDataName, freeSpaceBlocks, free_dims,
+                              free_chunk);
+  }
+  file->closeGroup(); // close events group
+  file->closeGroup(); // close workspace group
+  file->close();
+}
+
+/** Open and map the event file, checking it holds the events expected.
+ * @param create :: true to replace any existing event file by an empty one
+ */
+void BoxControllerMappedIO::openEventFile(const bool create) {
+  // Keep the events aligned to the size of a double
+  static_assert(sizeof(Header) % sizeof(double) == 0,
+                "The event file header must keep the events aligned");
+  if (create || !Poco::File(m_eventFileName).exists()) {
+    if (m_ReadOnly)
+      throw Kernel::Exception::FileError("Can not open event file to read ",
+                                         m_eventFileName);
+    Header header{};
+    std::copy(std::begin(MAGIC), std::end(MAGIC), header.magic);
+    header.version = VERSION;
+    header.coordSize = static_cast<uint32_t>(m_CoordSize);
+    header.nColumns = static_cast<uint64_t>(m_nColumns);
+    header.nEvents = 0;
+    m_typeName.copy(header.typeName, sizeof(header.typeName) - 1);
+    std::ofstream out(m_eventFileName, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    if (!out)
+      throw Kernel::Exception::FileError("Can not create event file ",
+                                         m_eventFileName);
+  }
+
+  map();
+  if (m_region->get_size() < sizeof(Header))
+    throw Kernel::Exception::FileError("Event file is too short ",
+                                       m_eventFileName);
+  const auto &header = *static_cast<const Header *>(m_region->get_address());
+  if (!std::equal(std::begin(MAGIC), std::end(MAGIC), header.magic) ||
+      header.version != VERSION)
+    throw Kernel::Exception::FileError("Unknown event file format ",
+                                       m_eventFileName);
+  if (std::string(header.typeName, strnlen(header.typeName,
+                                           sizeof(header.typeName))) !=
+      m_typeName)
+    throw Kernel::Exception::FileError(
+        "Trying to open event file with different event type ",
+        m_eventFileName);
+  if (header.nColumns != static_cast<uint64_t>(m_nColumns))
+    throw Kernel::Exception::FileError(
+        "Trying to open event data with different number of dimensions ",
+        m_eventFileName);
+  if (header.coordSize != 4 && header.coordSize != 8)
+    throw Kernel::Exception::FileError("Unknown events data format ",
+                                       m_eventFileName);
+
+  m_fileCoordSize = header.coordSize;
+  m_capacity = (m_region->get_size() - sizeof(Header)) / rowBytes();
+  if (header.nEvents > m_capacity)
+    throw Kernel::Exception::FileError("Event file is too short ",
+                                       m_eventFileName);
+  this->setFileLength(header.nEvents);
+}
+
+/// Map the whole event file into memory
+void BoxControllerMappedIO::map() {
+  const auto mode = m_ReadOnly ? ip::read_only : ip::read_write;
+  m_mapping = ip::file_mapping(m_eventFileName.c_str(), mode);
+  m_region = std::make_unique<ip::mapped_region>(m_mapping, mode);
+}
+
+/** Make room for events in the event file and map it again. Must be called
+ * with the mapping locked for writing.
+ * @param nEvents :: the number of events the file must have room for
+ */
+void BoxControllerMappedIO::reserve(const uint64_t nEvents) const {
+  if (nEvents <= m_capacity)
+    return;
+  // Grow geometrically so saving many small blocks stays cheap
+  const uint64_t capacity = std::max(
+      {nEvents, m_capacity + m_capacity / 2, m_capacity + m_dataChunk});
+  // Windows cannot resize a file while a mapping of it is open, so the file
+  // mapping is recreated as in map()
+  m_region.reset();
+  m_mapping = ip::file_mapping();
+  Poco::File(m_eventFileName).setSize(sizeof(Header) + capacity * rowBytes());
+  m_mapping = ip::file_mapping(m_eventFileName.c_str(), ip::read_write);
+  m_region = std::make_unique<ip::mapped_region>(m_mapping, ip::read_write);
+  m_capacity = capacity;
+}
+
+/// @return the start of the events in the mapped event file
+char *BoxControllerMappedIO::eventData() const {
+  return static_cast<char *>(m_region->get_address()) + sizeof(Header);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------
+/** Save generic data block on specific position within the event file
+ *@param DataBlock     -- the vector with data to write
+ *@param blockPosition -- The starting place to save data to   */
+template <typename Type>
+void BoxControllerMappedIO::saveGenericBlock(
+    const std::vector<Type> &DataBlock, const uint64_t blockPosition) const {
+  if (m_ReadOnly)
+    throw Kernel::Exception::FileError(
+        "Attempt to write to the event file opened for reading",
+        m_eventFileName);
+  const auto nPoints = static_cast<uint64_t>(DataBlock.size() / m_nColumns);
+  const size_t nValues = static_cast<size_t>(nPoints * m_nColumns);
+
+  std::unique_lock<std::shared_mutex> lock(m_mapMutex);
+  reserve(blockPosition + nPoints);
+  char *dest = eventData() + blockPosition * rowBytes();
+  if (m_fileCoordSize == sizeof(Type))
+    std::memcpy(dest, DataBlock.data(), nValues * sizeof(Type));
+  else if (m_fileCoordSize == sizeof(float))
+    convertValues(DataBlock.data(), reinterpret_cast<float *>(dest), nValues);
+  else
+    convertValues(DataBlock.data(), reinterpret_cast<double *>(dest), nValues);
+
+  if (blockPosition + nPoints > this->getFileLength())
+    this->setFileLength(blockPosition + nPoints);
+}
+
+/** Save float data block on specific position within the event file
+ *@param DataBlock     -- the vector with data to write
+ *@param blockPosition -- The starting place to save data to   */
+void BoxControllerMappedIO::saveBlock(const std::vector<float> &DataBlock,
+                                      const uint64_t blockPosition) const {
+  this->saveGenericBlock(DataBlock, blockPosition);
+}
+/** Save double precision data block on specific position within the event
+ *file
+ *@param DataBlock     -- the vector with data to write
+ *@param blockPosition -- The starting place to save data to   */
+void BoxControllerMappedIO::saveBlock(const std::vector<double> &DataBlock,
+                                      const uint64_t blockPosition) const {
+  this->saveGenericBlock(DataBlock, blockPosition);
+}
+
+/** Load generic data block from the mapped event file. A file opened for
+ * reading is read without any lock.
+ *@param Block         -- the storage vector to place data into
+ *@param blockPosition -- The starting place to read data from
+ *@param nPoints       -- number of data points (events) to read
+ */
+template <typename Type>
+void BoxControllerMappedIO::loadGenericBlock(std::vector<Type> &Block,
+                                             const uint64_t blockPosition,
+                                             const size_t nPoints) const {
+  std::shared_lock<std::shared_mutex> lock(m_mapMutex, std::defer_lock);
+  if (!m_ReadOnly)
+    lock.lock();
+  if (blockPosition + nPoints > this->getFileLength())
+    throw Kernel::Exception::FileError("Attemtp to read behind the file end",
+                                       m_eventFileName);
+
+  const size_t nValues = nPoints * m_nColumns;
+  Block.resize(nValues);
+  const char *src = eventData() + blockPosition * rowBytes();
+  if (m_fileCoordSize == sizeof(Type))
+    std::memcpy(Block.data(), src, nValues * sizeof(Type));
+  else if (m_fileCoordSize == sizeof(float))
+    convertValues(reinterpret_cast<const float *>(src), Block.data(), nValues);
+  else
+    convertValues(reinterpret_cast<const double *>(src), Block.data(),
+                  nValues);
+}
+
+/** Load float data block from the event file.
+  *@param Block         -- the storage vector to place data into
+  *@param blockPosition -- The starting place to read data from
+  *@param nPoints       -- number of data points (events) to read
+*/
+void BoxControllerMappedIO::loadBlock(std::vector<float> &Block,
+                                      const uint64_t blockPosition,
+                                      const size_t nPoints) const {
+  this->loadGenericBlock(Block, blockPosition, nPoints);
+}
+/** Load double data block from the event file.
+  *@param Block         -- the storage vector to place data into
+  *@param blockPosition -- The starting place to read data from
+  *@param nPoints       -- number of data points (events) to read
+*/
+void BoxControllerMappedIO::loadBlock(std::vector<double> &Block,
+                                      const uint64_t blockPosition,
+                                      const size_t nPoints) const {
+  this->loadGenericBlock(Block, blockPosition, nPoints);
+}
+
+//-------------------------------------------------------------------------------------------------------------------------------------
+
+/// Write the modified pages of the mapped event file to disk
+void BoxControllerMappedIO::flushData() const {
+  std::shared_lock<std::shared_mutex> lock(m_mapMutex);
+  if (m_region && !m_ReadOnly)
+    m_region->flush();
+}
+
+/** flush disk buffer data from memory, write the number of events to the
+ * event file and unmap it*/
+void BoxControllerMappedIO::closeFile() {
+  if (!m_region)
+    return;
+  // write all file-backed data still stack in the data buffer into the file.
+  this->flushCache();
+
+  std::unique_lock<std::shared_mutex> lock(m_mapMutex);
+  if (!m_ReadOnly) {
+    auto &header = *static_cast<Header *>(m_region->get_address());
+    header.nEvents = this->getFileLength();
+    m_region->flush();
+    m_region.reset();
+    m_mapping = ip::file_mapping();
+    // drop the room reserved for events that were never saved
+    Poco::File(m_eventFileName)
+        .setSize(sizeof(Header) + this->getFileLength() * rowBytes());
+    writeFreeSpaceBlocks();
+  } else {
+    m_region.reset();
+    m_mapping = ip::file_mapping();
+  }
+  m_capacity = 0;
+}
+
+BoxControllerMappedIO::~BoxControllerMappedIO() { this->closeFile(); }
+
+/** Check whether the events of an MDEventWorkspace file are held in a separate
+ * event file
+ * @param fileName :: full name of the NeXus file
+ * @param nDims :: the number of dimensions of the workspace
+ * @param typeName :: the name of the event type of the workspace
+ * @return true if the NeXus file points to an event file
+ */
+bool BoxControllerMappedIO::hasEventFile(const std::string &fileName,
+                                         int nDims,
+                                         const std::string &typeName) {
+  bool groupExists;
+  auto file = std::unique_ptr<::NeXus::File>(
+      MDBoxFlatTree::createOrOpenMDWSgroup(fileName, nDims, typeName, true,
+                                           groupExists));
+  std::map<std::string, std::string> groupEntries;
+  file->getEntries(groupEntries);
+  bool result = false;
+  if (groupEntries.find(g_EventGroupName) != groupEntries.end()) {
+    file->openGroup(g_EventGroupName, "NXdata");
+    result = file->hasAttr(g_EventFileAttr);
+    file->closeGroup();
+  }
+  file->closeGroup();
+  file->close();
+  return result;
+}
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -31,10 +31,10 @@ std::string BoxControllerNeXusIO::g_DBDataName("free_space_blocks");
  @param bc shared pointer to the box controller which uses this IO operations
 */
 BoxControllerNeXusIO::BoxControllerNeXusIO(API::BoxController *const bc)
-    : m_File(nullptr), m_ReadOnly(true), m_dataChunk(DATA_CHUNK), m_bc(bc),
-      m_BlockStart(2, 0), m_BlockSize(2, 0), m_CoordSize(sizeof(coord_t)),
-      m_EventType(FatEvent), m_EventsVersion("1.0"),
-      m_ReadConversion(noConversion) {
+    : m_File(nullptr), m_ReadOnly(true), m_compressed(false),
+      m_dataChunk(DATA_CHUNK), m_bc(bc), m_BlockStart(2, 0), m_BlockSize(2, 0),
+      m_CoordSize(sizeof(coord_t)), m_EventType(FatEvent),
+      m_EventsVersion("1.0"), m_ReadConversion(noConversion) {
   m_BlockSize[1] = 4 + m_bc->getNDims();
 
   for (auto &EventHeader : EventHeaders) {
@@ -223,13 +223,18 @@ void BoxControllerNeXusIO::prepareNxSToWrite_CurVersion() {
     std::vector<int64_t> chunk(m_BlockSize);
     chunk[0] = static_cast<int64_t>(m_dataChunk);
 
+    // Each chunk is compressed separately, so a block of events can still be
+    // read from anywhere in the array by decompressing only the chunks it is
+    // in.
+    const auto compression = m_compressed ? ::NeXus::LZW : ::NeXus::NONE;
+
     // Make and open the data
     if (m_CoordSize == 4)
       m_File->makeCompData("event_data", ::NeXus::FLOAT32, m_BlockSize,
-                           ::NeXus::NONE, chunk, true);
+                           compression, chunk, true);
     else
       m_File->makeCompData("event_data", ::NeXus::FLOAT64, m_BlockSize,
-                           ::NeXus::NONE, chunk, true);
+                           compression, chunk, true);
 
     // A little bit of description for humans to read later
     m_File->putAttr("description", m_EventsTypeHeaders[m_EventType]);
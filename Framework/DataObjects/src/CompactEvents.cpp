@@ -0,0 +1,179 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/CompactEvents.h"
+#include "MantidDataObjects/EventHistogramKernel.h"
+
+#ifdef _MSC_VER
+// qualifier applied to function type has no meaning; ignored
+#pragma warning(disable : 4180)
+#endif
+#include "tbb/parallel_sort.h"
+#ifdef _MSC_VER
+#pragma warning(default : 4180)
+#endif
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+namespace Mantid {
+namespace DataObjects {
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+
+/** Make a pulse table from pulse times in any order, with duplicates
+ * @param pulseTimes :: pulse times in nanoseconds
+ * @return the sorted, unique pulse times
+ */
+std::shared_ptr<const CompactEvents::PulseTable>
+CompactEvents::makePulseTable(std::vector<int64_t> pulseTimes) {
+  tbb::parallel_sort(pulseTimes.begin(), pulseTimes.end());
+  pulseTimes.erase(std::unique(pulseTimes.begin(), pulseTimes.end()),
+                   pulseTimes.end());
+  pulseTimes.shrink_to_fit();
+  return std::make_shared<const PulseTable>(std::move(pulseTimes));
+}
+
+/** Move TofEvent's into compact storage if that is lossless. The input vector
+ * is emptied if the events were packed and left as it is otherwise.
+ * @param events :: events to take over
+ * @param pulseTimes :: table holding the pulse times of all the events. If
+ *        null, a table is made from the events.
+ * @return true if the events were packed
+ */
+bool CompactEvents::pack(std::vector<TofEvent> &events,
+                         std::shared_ptr<const PulseTable> pulseTimes) {
+  if (!pulseTimes) {
+    std::vector<int64_t> times;
+    times.reserve(events.size());
+    for (const auto &event : events)
+      times.emplace_back(event.pulseTime().totalNanoseconds());
+    pulseTimes = makePulseTable(std::move(times));
+  }
+  const auto &table = *pulseTimes;
+  if (table.size() > std::numeric_limits<uint32_t>::max())
+    return false;
+
+  std::vector<CompactEvent> packed;
+  packed.reserve(events.size());
+  // Consecutive events mostly share a pulse, so try the previous one first
+  size_t index = 0;
+  for (const auto &event : events) {
+    const double tof = event.tof();
+    if (!(std::abs(tof) <= FLT_MAX) ||
+        static_cast<double>(static_cast<float>(tof)) != tof)
+      return false;
+    const int64_t pulseTime = event.pulseTime().totalNanoseconds();
+    if (index >= table.size() || table[index] != pulseTime) {
+      const auto it = std::lower_bound(table.cbegin(), table.cend(), pulseTime);
+      if (it == table.cend() || *it != pulseTime)
+        return false;
+      index = static_cast<size_t>(it - table.cbegin());
+    }
+    packed.push_back({static_cast<float>(tof), static_cast<uint32_t>(index)});
+  }
+
+  m_events.swap(packed);
+  m_pulseTimes = std::move(pulseTimes);
+  std::vector<TofEvent>().swap(events);
+  return true;
+}
+
+/** Move the events into a vector of TofEvent's. The compact storage is emptied.
+ * @param events :: vector to fill; existing content is replaced
+ */
+void CompactEvents::unpack(std::vector<TofEvent> &events) {
+  events.clear();
+  events.reserve(m_events.size());
+  for (const auto &event : m_events)
+    events.emplace_back(event.tof(),
+                        DateAndTime((*m_pulseTimes)[event.m_pulseIndex]));
+  clear();
+}
+
+/// Remove all events and release their memory
+void CompactEvents::clear() {
+  std::vector<CompactEvent>().swap(m_events);
+  m_pulseTimes.reset();
+}
+
+/** Memory used by the events. The pulse table is shared, so it is not
+ * included.
+ * @return the memory in bytes
+ */
+size_t CompactEvents::getMemorySize() const {
+  return m_events.capacity() * sizeof(CompactEvent);
+}
+
+/// Sort the events by time-of-flight
+void CompactEvents::sortTof() {
+  const auto byTof = [](const CompactEvent &lhs, const CompactEvent &rhs) {
+    return lhs.m_tof < rhs.m_tof;
+  };
+  if (!std::is_sorted(m_events.cbegin(), m_events.cend(), byTof))
+    tbb::parallel_sort(m_events.begin(), m_events.end(), byTof);
+}
+
+/** Fill a vector with the times-of-flight of the events
+ * @param tofs :: vector to fill; existing content is replaced
+ */
+void CompactEvents::getTofs(std::vector<double> &tofs) const {
+  tofs.clear();
+  tofs.reserve(m_events.size());
+  for (const auto &event : m_events)
+    tofs.emplace_back(event.tof());
+}
+
+/** Fill a counts histogram. The events must be sorted by time-of-flight.
+ * @param X :: the bin edges
+ * @param Y :: the generated counts histogram
+ */
+void CompactEvents::generateCountsHistogram(const MantidVec &X,
+                                            MantidVec &Y) const {
+  if (X.size() <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  std::vector<size_t> positions;
+  EventHistogramKernel::findEdges(m_events, X, positions);
+  EventHistogramKernel::countsFromEdges(positions, Y);
+}
+
+/** Integrate the events between a range of time-of-flight, or all events.
+ * The events must be sorted by time-of-flight unless the entire range is used.
+ * @param minX :: minimum time-of-flight to include
+ * @param maxX :: maximum time-of-flight to include
+ * @param entireRange :: set to true to use all events. minX and maxX are then
+ *        ignored!
+ * @param sum :: place holder for the resulting sum
+ * @param error :: place holder for the resulting error
+ */
+void CompactEvents::integrate(const double minX, const double maxX,
+                              const bool entireRange, double &sum,
+                              double &error) const {
+  sum = 0;
+  error = 0;
+  auto low = m_events.cbegin();
+  auto high = m_events.cend();
+  if (!entireRange) {
+    // If a silly range was given, return 0.
+    if (maxX < minX)
+      return;
+    low = std::partition_point(
+        low, high, [minX](const CompactEvent &e) { return e.tof() < minX; });
+    high = std::partition_point(
+        low, high, [maxX](const CompactEvent &e) { return e.tof() <= maxX; });
+  }
+  // Every event has unit weight
+  sum = static_cast<double>(high - low);
+  error = std::sqrt(sum);
+}
+
+} // namespace DataObjects
+} // namespace Mantid
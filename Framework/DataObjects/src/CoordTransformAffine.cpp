@@ -16,6 +16,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 
+#include <algorithm>
+
 using namespace Mantid::Geometry;
 using namespace Mantid::Kernel;
 using Mantid::API::CoordTransform;
@@ -283,6 +285,35 @@ void CoordTransformAffine::apply(const coord_t *inputVector,
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Apply the coordinate transformation to a block of points, held one
+ * dimension after the other (see CoordTransform::applyBatch). Each output
+ * dimension is built up one input dimension at a time, so the inner loop runs
+ * over the points and vectorises.
+ *
+ * @param inputs :: inD * nPoints input coordinates
+ * @param outputs :: outD * nPoints output coordinates
+ * @param nPoints :: number of points to transform
+ */
+void CoordTransformAffine::applyBatch(const coord_t *inputs, coord_t *outputs,
+                                      const size_t nPoints) const {
+  for (size_t out = 0; out < outD; ++out) {
+    const coord_t *rawMatrixRow = m_rawMatrix[out];
+    coord_t *outRow = outputs + out * nPoints;
+    // The translation, from the homogenous coordinate
+    std::fill_n(outRow, nPoints, rawMatrixRow[inD]);
+    for (size_t in = 0; in < inD; ++in) {
+      const coord_t factor = rawMatrixRow[in];
+      // Projections leave most of the matrix empty
+      if (factor == 0)
+        continue;
+      const coord_t *inRow = inputs + in * nPoints;
+      for (size_t i = 0; i < nPoints; ++i)
+        outRow[i] += factor * inRow[i];
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Serialize the coordinate transform
  *
@@ -112,6 +112,27 @@ void CoordTransformAligned::apply(const coord_t *inputVector,
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Apply the coordinate transformation to a block of points, held one
+ * dimension after the other (see CoordTransform::applyBatch).
+ *
+ * @param inputs :: inD * nPoints input coordinates
+ * @param outputs :: outD * nPoints output coordinates
+ * @param nPoints :: number of points to transform
+ */
+void CoordTransformAligned::applyBatch(const coord_t *inputs,
+                                       coord_t *outputs,
+                                       const size_t nPoints) const {
+  for (size_t out = 0; out < outD; ++out) {
+    const coord_t *inRow = inputs + m_dimensionToBinFrom[out] * nPoints;
+    coord_t *outRow = outputs + out * nPoints;
+    const coord_t origin = m_origin[out];
+    const coord_t scaling = m_scaling[out];
+    for (size_t i = 0; i < nPoints; ++i)
+      outRow[i] = (inRow[i] - origin) * scaling;
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Create an equivalent affine transformation matrix out of the
  * parameters of this axis-aligned transformation.
@@ -0,0 +1,305 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventColumns.h"
+#include "MantidDataObjects/EventHistogramKernel.h"
+
+#ifdef _MSC_VER
+// qualifier applied to function type has no meaning; ignored
+#pragma warning(disable : 4180)
+#endif
+#include "tbb/parallel_sort.h"
+#ifdef _MSC_VER
+#pragma warning(default : 4180)
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace Mantid {
+namespace DataObjects {
+using Types::Core::DateAndTime;
+using Types::Event::TofEvent;
+
+namespace {
+/// Release the memory held by a vector
+template <class T> void freeVector(std::vector<T> &vec) {
+  std::vector<T>().swap(vec);
+}
+} // namespace
+
+/** Move TofEvent's into the columns. The input vector is emptied.
+ * @param events :: events to take over
+ */
+void EventColumns::pack(std::vector<TofEvent> &events) {
+  clear();
+  m_tof.reserve(events.size());
+  m_pulseTime.reserve(events.size());
+  for (const auto &event : events)
+    push_back(event);
+  freeVector(events);
+}
+
+/** Move WeightedEvent's into the columns. The input vector is emptied.
+ * @param events :: events to take over
+ */
+void EventColumns::pack(std::vector<WeightedEvent> &events) {
+  clear();
+  m_tof.reserve(events.size());
+  m_pulseTime.reserve(events.size());
+  m_weight.reserve(events.size());
+  m_errorSquared.reserve(events.size());
+  for (const auto &event : events)
+    push_back(event);
+  freeVector(events);
+}
+
+/** Move WeightedEventNoTime's into the columns. The input vector is emptied.
+ * @param events :: events to take over
+ */
+void EventColumns::pack(std::vector<WeightedEventNoTime> &events) {
+  clear();
+  m_tof.reserve(events.size());
+  m_weight.reserve(events.size());
+  m_errorSquared.reserve(events.size());
+  for (const auto &event : events)
+    push_back(event);
+  freeVector(events);
+}
+
+/** Move the columns into a vector of TofEvent's. The columns are emptied.
+ * @param events :: vector to fill; existing content is replaced
+ */
+void EventColumns::unpack(std::vector<TofEvent> &events) {
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < m_tof.size(); ++i)
+    events.emplace_back(m_tof[i], DateAndTime(m_pulseTime[i]));
+  clear();
+}
+
+/** Move the columns into a vector of WeightedEvent's. The columns are emptied.
+ * @param events :: vector to fill; existing content is replaced
+ */
+void EventColumns::unpack(std::vector<WeightedEvent> &events) {
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < m_tof.size(); ++i)
+    events.emplace_back(m_tof[i], DateAndTime(m_pulseTime[i]), m_weight[i],
+                        m_errorSquared[i]);
+  clear();
+}
+
+/** Move the columns into a vector of WeightedEventNoTime's. The columns are
+ * emptied.
+ * @param events :: vector to fill; existing content is replaced
+ */
+void EventColumns::unpack(std::vector<WeightedEventNoTime> &events) {
+  events.clear();
+  events.reserve(size());
+  for (size_t i = 0; i < m_tof.size(); ++i)
+    events.emplace_back(m_tof[i], m_weight[i], m_errorSquared[i]);
+  clear();
+}
+
+/// Remove all events and release the memory of all columns
+void EventColumns::clear() {
+  freeVector(m_tof);
+  freeVector(m_pulseTime);
+  freeVector(m_weight);
+  freeVector(m_errorSquared);
+}
+
+/** Reserve space in the columns that are in use
+ * @param num :: number of events
+ * @param withPulseTimes :: reserve the pulse time column
+ * @param withWeights :: reserve the weight and error columns
+ */
+void EventColumns::reserve(size_t num, bool withPulseTimes, bool withWeights) {
+  m_tof.reserve(num);
+  if (withPulseTimes)
+    m_pulseTime.reserve(num);
+  if (withWeights) {
+    m_weight.reserve(num);
+    m_errorSquared.reserve(num);
+  }
+}
+
+/// @return the memory used by the columns, based on their capacity
+size_t EventColumns::getMemorySize() const {
+  return m_tof.capacity() * sizeof(double) +
+         m_pulseTime.capacity() * sizeof(int64_t) +
+         (m_weight.capacity() + m_errorSquared.capacity()) * sizeof(float);
+}
+
+/// Give every event a weight and squared error of 1, as for TofEvent's
+void EventColumns::addUnitWeights() {
+  m_weight.assign(m_tof.size(), 1.0f);
+  m_errorSquared.assign(m_tof.size(), 1.0f);
+}
+
+/// Discard the pulse time column, as for WeightedEventNoTime's
+void EventColumns::dropPulseTimes() { freeVector(m_pulseTime); }
+
+/** Reorder a column according to a permutation
+ * @param column :: the column to reorder
+ * @param order :: order[i] is the index of the value to put at position i
+ */
+template <class T>
+void EventColumns::permute(std::vector<T> &column,
+                           const std::vector<size_t> &order) {
+  if (column.empty())
+    return;
+  std::vector<T> sorted;
+  sorted.reserve(column.size());
+  for (const auto index : order)
+    sorted.emplace_back(column[index]);
+  column.swap(sorted);
+}
+
+/// Sort all columns by time-of-flight
+void EventColumns::sortTof() {
+  if (std::is_sorted(m_tof.cbegin(), m_tof.cend()))
+    return;
+  std::vector<size_t> order(m_tof.size());
+  std::iota(order.begin(), order.end(), 0);
+  tbb::parallel_sort(order.begin(), order.end(),
+                     [this](const size_t lhs, const size_t rhs) {
+                       return m_tof[lhs] < m_tof[rhs];
+                     });
+  permute(m_tof, order);
+  permute(m_pulseTime, order);
+  permute(m_weight, order);
+  permute(m_errorSquared, order);
+}
+
+/// Reverse the order of the events
+void EventColumns::reverse() {
+  std::reverse(m_tof.begin(), m_tof.end());
+  std::reverse(m_pulseTime.begin(), m_pulseTime.end());
+  std::reverse(m_weight.begin(), m_weight.end());
+  std::reverse(m_errorSquared.begin(), m_errorSquared.end());
+}
+
+/** Fill a counts histogram from the time-of-flight column. The columns must be
+ * sorted by time-of-flight.
+ * @param X :: the bin edges
+ * @param Y :: the generated counts histogram
+ */
+void EventColumns::generateCountsHistogram(const MantidVec &X,
+                                           MantidVec &Y) const {
+  const size_t x_size = X.size();
+  if (x_size <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  std::vector<size_t> positions;
+  EventHistogramKernel::findEdges(m_tof.data(), m_tof.size(), X, positions);
+  EventHistogramKernel::countsFromEdges(positions, Y);
+}
+
+/** Fill a weighted histogram and its errors from the time-of-flight, weight and
+ * error columns. The columns must be sorted by time-of-flight.
+ * @param X :: the bin edges
+ * @param Y :: the generated weights histogram
+ * @param E :: the generated errors histogram
+ */
+void EventColumns::generateWeightedHistogram(const MantidVec &X, MantidVec &Y,
+                                             MantidVec &E) const {
+  const size_t x_size = X.size();
+  if (x_size <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+  const size_t numBins = x_size - 1;
+  Y.resize(numBins);
+  // Note: Errors will be squared until the last step.
+  E.resize(numBins);
+
+  std::vector<size_t> positions;
+  EventHistogramKernel::findEdges(m_tof.data(), m_tof.size(), X, positions);
+  for (size_t bin = 0; bin < numBins; ++bin) {
+    Y[bin] = EventHistogramKernel::sum(m_weight.data(), positions[bin],
+                                       positions[bin + 1]);
+    E[bin] = EventHistogramKernel::sum(m_errorSquared.data(), positions[bin],
+                                       positions[bin + 1]);
+  }
+
+  std::transform(E.begin(), E.end(), E.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+}
+
+/** Integrate the events between a range of X values, or all events. The
+ * columns must be sorted by time-of-flight unless the entire range is used.
+ * @param minX :: minimum X bin to use in integrating.
+ * @param maxX :: maximum X bin to use in integrating.
+ * @param entireRange :: set to true to use the entire range.
+ * @param sum :: place holder for the resulting sum
+ * @param error :: place holder for the resulting error
+ */
+void EventColumns::integrate(const double minX, const double maxX,
+                             const bool entireRange, double &sum,
+                             double &error) const {
+  sum = 0;
+  error = 0;
+  if (m_tof.empty())
+    return;
+
+  size_t low = 0;
+  size_t high = m_tof.size();
+  if (!entireRange) {
+    // If a silly range was given, return 0.
+    if (maxX < minX)
+      return;
+    low = std::lower_bound(m_tof.cbegin(), m_tof.cend(), minX) -
+          m_tof.cbegin();
+    high = std::upper_bound(m_tof.cbegin() + low, m_tof.cend(), maxX) -
+           m_tof.cbegin();
+  }
+
+  if (m_weight.empty()) {
+    sum = static_cast<double>(high - low);
+    error = sum;
+  } else {
+    for (size_t i = low; i < high; ++i) {
+      sum += double(m_weight[i]);
+      error += double(m_errorSquared[i]);
+    }
+  }
+  error = std::sqrt(error);
+}
+
+/** Convert the time-of-flight by tof'=tof*factor+offset
+ * @param factor :: The value to scale the time-of-flight by
+ * @param offset :: The value to shift the time-of-flight by
+ */
+void EventColumns::convertTof(const double factor, const double offset) {
+  for (auto &tof : m_tof)
+    tof = tof * factor + offset;
+}
+
+/** Convert the time-of-flight with an arbitrary function
+ * @param func :: the conversion
+ */
+void EventColumns::convertTof(const std::function<double(double)> &func) {
+  std::transform(m_tof.begin(), m_tof.end(), m_tof.begin(), func);
+}
+
+/** Convert the time-of-flight according to output = factor * input^power
+ * @param factor :: the conversion factor
+ * @param power :: the power
+ */
+void EventColumns::convertUnitsQuickly(const double factor,
+                                       const double power) {
+  for (auto &tof : m_tof)
+    tof = factor * std::pow(tof, power);
+}
+
+} // namespace DataObjects
+} // namespace Mantid
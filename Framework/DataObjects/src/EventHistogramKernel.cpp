@@ -0,0 +1,132 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/EventHistogramKernel.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                               \
+    (defined(__x86_64__) || defined(__i386__))
+#define MANTID_EVENT_HISTOGRAM_AVX2
+#include <immintrin.h>
+#endif
+
+namespace Mantid {
+namespace DataObjects {
+namespace EventHistogramKernel {
+
+namespace {
+/// Search windows of at most this many events are finished by a linear scan
+constexpr size_t BLOCK_SIZE = 64;
+
+/// Number of values in [begin, end) that are below edge
+size_t countBelowScalar(const double *tofs, size_t begin, size_t end,
+                        const double edge) {
+  size_t count = 0;
+  for (size_t i = begin; i < end; ++i)
+    count += static_cast<size_t>(tofs[i] < edge);
+  return count;
+}
+
+/// Sum of values in [begin, end), accumulated in double precision
+double sumScalar(const float *values, size_t begin, size_t end) {
+  double total = 0.;
+  for (size_t i = begin; i < end; ++i)
+    total += static_cast<double>(values[i]);
+  return total;
+}
+
+#ifdef MANTID_EVENT_HISTOGRAM_AVX2
+__attribute__((target("avx2"))) size_t
+countBelowAVX2(const double *tofs, size_t begin, size_t end,
+               const double edge) {
+  const __m256d edges = _mm256_set1_pd(edge);
+  size_t count = 0;
+  size_t i = begin;
+  for (; i + 4 <= end; i += 4) {
+    const __m256d below =
+        _mm256_cmp_pd(_mm256_loadu_pd(tofs + i), edges, _CMP_LT_OQ);
+    count += static_cast<size_t>(__builtin_popcount(_mm256_movemask_pd(below)));
+  }
+  return count + countBelowScalar(tofs, i, end, edge);
+}
+
+__attribute__((target("avx2"))) double sumAVX2(const float *values,
+                                               size_t begin, size_t end) {
+  __m256d totals = _mm256_setzero_pd();
+  size_t i = begin;
+  for (; i + 4 <= end; i += 4)
+    totals = _mm256_add_pd(totals, _mm256_cvtps_pd(_mm_loadu_ps(values + i)));
+  double lanes[4];
+  _mm256_storeu_pd(lanes, totals);
+  return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]) +
+         sumScalar(values, i, end);
+}
+#endif
+
+size_t countBelow(const double *tofs, size_t begin, size_t end,
+                  const double edge) {
+#ifdef MANTID_EVENT_HISTOGRAM_AVX2
+  if (usesAVX2())
+    return countBelowAVX2(tofs, begin, end, edge);
+#endif
+  return countBelowScalar(tofs, begin, end, edge);
+}
+} // namespace
+
+bool usesAVX2() {
+#ifdef MANTID_EVENT_HISTOGRAM_AVX2
+  static const bool avx2 = __builtin_cpu_supports("avx2");
+  return avx2;
+#else
+  return false;
+#endif
+}
+
+void findEdges(const double *tofs, size_t numEvents, const MantidVec &X,
+               std::vector<size_t> &positions) {
+  positions.resize(X.size());
+  size_t pos = 0;
+  for (size_t i = 0; i < X.size(); ++i) {
+    const double edge = X[i];
+    // Gallop forward from the previous edge to bracket the new position
+    size_t low = pos;
+    size_t high = pos;
+    size_t step = 1;
+    while (high < numEvents && tofs[high] < edge) {
+      low = high + 1;
+      high = low + step;
+      step *= 2;
+    }
+    high = std::min(high, numEvents);
+    // Bisect down to one block, then count the events below the edge in it
+    while (high - low > BLOCK_SIZE) {
+      const size_t mid = low + (high - low) / 2;
+      if (tofs[mid] < edge)
+        low = mid + 1;
+      else
+        high = mid;
+    }
+    pos = low + countBelow(tofs, low, high, edge);
+    positions[i] = pos;
+  }
+}
+
+void countsFromEdges(const std::vector<size_t> &positions, MantidVec &Y) {
+  Y.resize(positions.size() - 1);
+  for (size_t i = 0; i < Y.size(); ++i)
+    Y[i] = static_cast<double>(positions[i + 1] - positions[i]);
+}
+
+double sum(const float *values, size_t begin, size_t end) {
+#ifdef MANTID_EVENT_HISTOGRAM_AVX2
+  if (usesAVX2())
+    return sumAVX2(values, begin, end);
+#endif
+  return sumScalar(values, begin, end);
+}
+
+} // namespace EventHistogramKernel
+} // namespace DataObjects
+} // namespace Mantid
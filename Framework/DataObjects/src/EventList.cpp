@@ -6,8 +6,10 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataObjects/EventList.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidDataObjects/EventHistogramKernel.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidDataObjects/Histogram1D.h"
+#include "MantidDataObjects/RadixSort.h"
 #include "MantidKernel/DateAndTime.h"
 #include "MantidKernel/DateAndTimeHelpers.h"
 #include "MantidKernel/Exception.h"
@@ -23,6 +25,8 @@
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
+#include <array>
 #include <cfloat>
 #include <cmath>
 #include <functional>
@@ -89,6 +93,34 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/**
+ * Find the first event with a pulse time not before the given time in a range
+ * of events sorted by pulse time. The search gallops forward from the start of
+ * the range before bisecting, so stepping through a sorted list interval by
+ * interval costs the logarithm of the number of events skipped each time
+ * rather than the number of events.
+ * @param first :: start of the range
+ * @param last :: end of the range
+ * @param time :: the pulse time to look for
+ * @return iterator to the first event with pulse time >= time, or last
+ */
+template <typename Iterator>
+Iterator findPulseTime(Iterator first, const Iterator last,
+                       const DateAndTime &time) {
+  const auto isBefore = [&time](const typename Iterator::value_type &event) {
+    return event.pulseTime() < time;
+  };
+  size_t step = 1;
+  while (static_cast<size_t>(last - first) > step && isBefore(first[step])) {
+    first += step;
+    step *= 2;
+  }
+  const auto end = static_cast<size_t>(last - first) > step
+                       ? first + static_cast<std::ptrdiff_t>(step) + 1
+                       : last;
+  return std::partition_point(first, end, isBefore);
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -119,6 +151,22 @@ bool compareEventPulseTimeTOF(const TofEvent &e1, const TofEvent &e2) {
   return false;
 }
 
+/// Stable radix sort of events by TOF
+template <class T> void radixSortTof(std::vector<T> &events) {
+  RadixSort::sort(events, [](const T &event) {
+    return RadixSort::orderedKey(event.tof());
+  });
+}
+
+/// Stable radix sort of events by pulse time, then TOF
+template <class T> void radixSortPulseTimeTof(std::vector<T> &events) {
+  // The second pass keeps the TOF order of events with equal pulse times
+  radixSortTof(events);
+  RadixSort::sort(events, [](const T &event) {
+    return RadixSort::orderedKey(event.pulseTime().totalNanoseconds());
+  });
+}
+
 // comparator for pulse time with tolerance
 struct comparePulseTimeTOFDelta {
   explicit comparePulseTimeTOFDelta(const Types::Core::DateAndTime &start,
@@ -152,7 +200,8 @@ struct comparePulseTimeTOFDelta {
 EventList::EventList()
     : m_histogram(HistogramData::Histogram::XMode::BinEdges,
                   HistogramData::Histogram::YMode::Counts),
-      eventType(TOF), order(UNSORTED), mru(nullptr) {}
+      eventType(TOF), m_layout(ARRAY_OF_STRUCTS), m_columnar(false),
+      m_compact(false), order(UNSORTED), mru(nullptr) {}
 
 /** Constructor with a MRU list
  * @param mru :: pointer to the MRU of the parent EventWorkspace
@@ -161,12 +210,14 @@ EventList::EventList()
 EventList::EventList(EventWorkspaceMRU *mru, specnum_t specNo)
     : IEventList(specNo), m_histogram(HistogramData::Histogram::XMode::BinEdges,
                                       HistogramData::Histogram::YMode::Counts),
-      eventType(TOF), order(UNSORTED), mru(mru) {}
+      eventType(TOF), m_layout(ARRAY_OF_STRUCTS), m_columnar(false),
+      m_compact(false), order(UNSORTED), mru(mru) {}
 
 /** Constructor copying from an existing event list
  * @param rhs :: EventList object to copy*/
 EventList::EventList(const EventList &rhs)
-    : IEventList(rhs), m_histogram(rhs.m_histogram), mru{nullptr} {
+    : IEventList(rhs), m_histogram(rhs.m_histogram), m_layout(rhs.m_layout),
+      m_columnar(false), m_compact(false), mru{nullptr} {
   // Note that operator= also assigns m_histogram, but the above use of the copy
   // constructor avoid a memory allocation and is thus faster.
   this->operator=(rhs);
@@ -177,7 +228,8 @@ EventList::EventList(const EventList &rhs)
 EventList::EventList(const std::vector<TofEvent> &events)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges,
                   HistogramData::Histogram::YMode::Counts),
-      eventType(TOF), mru(nullptr) {
+      eventType(TOF), m_layout(ARRAY_OF_STRUCTS), m_columnar(false),
+      m_compact(false), mru(nullptr) {
   this->events.assign(events.begin(), events.end());
   this->eventType = TOF;
   this->order = UNSORTED;
@@ -188,6 +240,7 @@ EventList::EventList(const std::vector<TofEvent> &events)
 EventList::EventList(const std::vector<WeightedEvent> &events)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges,
                   HistogramData::Histogram::YMode::Counts),
+      m_layout(ARRAY_OF_STRUCTS), m_columnar(false), m_compact(false),
       mru(nullptr) {
   this->weightedEvents.assign(events.begin(), events.end());
   this->eventType = WEIGHTED;
@@ -199,6 +252,7 @@ EventList::EventList(const std::vector<WeightedEvent> &events)
 EventList::EventList(const std::vector<WeightedEventNoTime> &events)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges,
                   HistogramData::Histogram::YMode::Counts),
+      m_layout(ARRAY_OF_STRUCTS), m_columnar(false), m_compact(false),
       mru(nullptr) {
   this->weightedEventsNoTime.assign(events.begin(), events.end());
   this->eventType = WEIGHTED_NOTIME;
@@ -228,6 +282,10 @@ void EventList::copyDataInto(EventList &sink) const {
   sink.events = events;
   sink.weightedEvents = weightedEvents;
   sink.weightedEventsNoTime = weightedEventsNoTime;
+  sink.m_columns = m_columns;
+  sink.m_columnar = m_columnar.load();
+  sink.m_compactEvents = m_compactEvents;
+  sink.m_compact = m_compact.load();
   sink.eventType = eventType;
   sink.order = order;
 }
@@ -254,6 +312,7 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
                                     int MaxEventsPerBin) {
   // Fresh start
   this->clear(true);
+  this->unpackColumns();
 
   // Get the input histogram
   const MantidVec &X = inSpec->readX();
@@ -338,7 +397,12 @@ EventList &EventList::operator=(const EventList &rhs) {
   events = rhs.events;
   weightedEvents = rhs.weightedEvents;
   weightedEventsNoTime = rhs.weightedEventsNoTime;
+  m_columns = rhs.m_columns;
   eventType = rhs.eventType;
+  m_layout = rhs.m_layout;
+  m_columnar = rhs.m_columnar.load();
+  m_compactEvents = rhs.m_compactEvents;
+  m_compact = rhs.m_compact.load();
   order = rhs.order;
   return *this;
 }
@@ -349,6 +413,7 @@ EventList &EventList::operator=(const EventList &rhs) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const TofEvent &event) {
+  this->unpackColumns();
 
   switch (this->eventType) {
   case TOF:
@@ -377,6 +442,7 @@ EventList &EventList::operator+=(const TofEvent &event) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
+  this->unpackColumns();
   switch (this->eventType) {
   case TOF:
     // Simply push the events
@@ -417,6 +483,7 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const WeightedEvent &event) {
+  this->unpackColumns();
   this->switchTo(WEIGHTED);
   this->weightedEvents.emplace_back(event);
   this->order = UNSORTED;
@@ -433,6 +500,7 @@ EventList &EventList::operator+=(const WeightedEvent &event) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEvent> &more_events) {
+  this->unpackColumns();
   switch (this->eventType) {
   case TOF:
     // Need to switch to weighted
@@ -470,6 +538,7 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
  * */
 EventList &EventList::
 operator+=(const std::vector<WeightedEventNoTime> &more_events) {
+  this->unpackColumns();
   switch (this->eventType) {
   case TOF:
   case WEIGHTED:
@@ -498,6 +567,8 @@ operator+=(const std::vector<WeightedEventNoTime> &more_events) {
  * @return reference to this
  * */
 EventList &EventList::operator+=(const EventList &more_events) {
+  this->unpackColumns();
+  more_events.unpackColumns();
   // We'll let the += operator for the given vector of event lists handle it
   switch (more_events.getEventType()) {
   case TOF:
@@ -565,6 +636,8 @@ EventList &EventList::operator-=(const EventList &more_events) {
     this->clearData();
     return *this;
   }
+  this->unpackColumns();
+  more_events.unpackColumns();
 
   // We'll let the -= operator for the given vector of event lists handle it
   switch (this->getEventType()) {
@@ -615,6 +688,8 @@ EventList &EventList::operator-=(const EventList &more_events) {
  * @return :: true if equal.
  */
 bool EventList::operator==(const EventList &rhs) const {
+  this->unpackColumns();
+  rhs.unpackColumns();
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
   if (this->eventType != rhs.eventType)
@@ -639,6 +714,8 @@ bool EventList::operator!=(const EventList &rhs) const {
 
 bool EventList::equals(const EventList &rhs, const double tolTof,
                        const double tolWeight, const int64_t tolPulse) const {
+  this->unpackColumns();
+  rhs.unpackColumns();
   // generic checks
   if (this->getNumberEvents() != rhs.getNumberEvents())
     return false;
@@ -713,6 +790,7 @@ void EventList::switchTo(EventType newType) {
  * of TofEvent.
  */
 void EventList::switchToWeightedEvents() {
+  this->unpackCompact();
   switch (eventType) {
   case WEIGHTED:
     // Do nothing; it already is weighted
@@ -727,6 +805,12 @@ void EventList::switchToWeightedEvents() {
 
   case TOF:
     weightedEventsNoTime.clear();
+    if (m_columnar) {
+      // Only the weight columns need to be added
+      m_columns.addUnitWeights();
+      eventType = WEIGHTED;
+      break;
+    }
     // Convert and copy all TofEvents to the weightedEvents list.
     this->weightedEvents.assign(events.cbegin(), events.cend());
     // Get rid of the old events
@@ -741,12 +825,19 @@ void EventList::switchToWeightedEvents() {
  * of TofEvent.
  */
 void EventList::switchToWeightedEventsNoTime() {
+  this->unpackCompact();
   switch (eventType) {
   case WEIGHTED_NOTIME:
     // Do nothing if already there
     return;
 
   case TOF: {
+    if (m_columnar) {
+      m_columns.addUnitWeights();
+      m_columns.dropPulseTimes();
+      eventType = WEIGHTED_NOTIME;
+      break;
+    }
     // Convert and copy all TofEvents to the weightedEvents list.
     this->weightedEventsNoTime.assign(events.cbegin(), events.cend());
     // Get rid of the old events
@@ -756,6 +847,11 @@ void EventList::switchToWeightedEventsNoTime() {
   } break;
 
   case WEIGHTED: {
+    if (m_columnar) {
+      m_columns.dropPulseTimes();
+      eventType = WEIGHTED_NOTIME;
+      break;
+    }
     // Convert and copy all TofEvents to the weightedEvents list.
     this->weightedEventsNoTime.assign(weightedEvents.cbegin(),
                                       weightedEvents.cend());
@@ -767,6 +863,138 @@ void EventList::switchToWeightedEventsNoTime() {
   }
 }
 
+// -----------------------------------------------------------------------------------------------
+/** Select how the events are laid out in memory. Switching to
+ * STRUCT_OF_ARRAYS moves the events into EventColumns and switching to COMPACT
+ * moves TofEvent's into CompactEvents; switching back moves them into the
+ * event vector of the current EventType.
+ * @param layout :: the storage layout to use from now on
+ */
+void EventList::setStorageLayout(const EventStorageLayout layout) {
+  this->setStorageLayout(layout, nullptr);
+}
+
+/** Select how the events are laid out in memory.
+ * @param layout :: the storage layout to use from now on
+ * @param pulseTimes :: table of the pulse times of the events, for the
+ *        COMPACT layout. If null, a table is made for this list alone.
+ */
+void EventList::setStorageLayout(
+    const EventStorageLayout layout,
+    const std::shared_ptr<const CompactEvents::PulseTable> &pulseTimes) {
+  m_layout = layout;
+  if (m_layout == STRUCT_OF_ARRAYS) {
+    this->unpackCompact();
+    this->packColumns();
+  } else {
+    this->unpackColumns();
+    if (m_layout == COMPACT)
+      this->packCompact(pulseTimes);
+  }
+}
+
+/** @return the requested storage layout of the events. Note that a
+ * STRUCT_OF_ARRAYS list temporarily holds its events in a vector after an
+ * operation that needs whole events, until the next conversion of the
+ * times-of-flight or call to setStorageLayout().
+ */
+EventStorageLayout EventList::getStorageLayout() const { return m_layout; }
+
+/** Return the events held column-wise. Only possible with the
+ * STRUCT_OF_ARRAYS layout. The reference is valid until the next call that
+ * needs whole events, e.g. getEvents().
+ * @return a const reference to the columns
+ * @throw runtime_error if the event list uses the ARRAY_OF_STRUCTS layout
+ */
+const EventColumns &EventList::getEventColumns() {
+  if (m_layout != STRUCT_OF_ARRAYS)
+    throw std::runtime_error("EventList::getEventColumns() called for an "
+                             "EventList that does not use the "
+                             "STRUCT_OF_ARRAYS layout.");
+  this->packColumns();
+  return m_columns;
+}
+
+/** Move the events from the event vector into the columns, if the
+ * STRUCT_OF_ARRAYS layout is requested and they are not there already.
+ * This frees the event vector, so it is only done by non-const methods: a
+ * reference returned by a const accessor such as getEvents() stays valid.
+ */
+void EventList::packColumns() {
+  if (m_layout != STRUCT_OF_ARRAYS ||
+      m_columnar.load(std::memory_order_acquire))
+    return;
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  if (m_columnar.load(std::memory_order_relaxed))
+    return;
+  switch (eventType) {
+  case TOF:
+    m_columns.pack(this->events);
+    break;
+  case WEIGHTED:
+    m_columns.pack(this->weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    m_columns.pack(this->weightedEventsNoTime);
+    break;
+  }
+  m_columnar.store(true, std::memory_order_release);
+}
+
+/** Move TofEvent's into compact storage, if the COMPACT layout is requested,
+ * they are not there already and no information is lost by doing so.
+ * @param pulseTimes :: table of the pulse times of the events, or null to
+ *        make one for this list
+ */
+void EventList::packCompact(
+    const std::shared_ptr<const CompactEvents::PulseTable> &pulseTimes) {
+  if (m_layout != COMPACT || eventType != TOF ||
+      m_compact.load(std::memory_order_acquire))
+    return;
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  if (m_compact.load(std::memory_order_relaxed))
+    return;
+  m_compact.store(m_compactEvents.pack(this->events, pulseTimes),
+                  std::memory_order_release);
+}
+
+/** Move the events from compact storage back into the event vector.
+ */
+void EventList::unpackCompact() const {
+  if (!m_compact.load(std::memory_order_acquire))
+    return;
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  if (!m_compact.load(std::memory_order_relaxed))
+    return;
+  m_compactEvents.unpack(this->events);
+  m_compact.store(false, std::memory_order_release);
+}
+
+/** Move the events from the columns or compact storage back into the event
+ * vector of the current EventType. Must be called before any direct use of
+ * the event vectors.
+ */
+void EventList::unpackColumns() const {
+  this->unpackCompact();
+  if (!m_columnar.load(std::memory_order_acquire))
+    return;
+  std::lock_guard<std::mutex> _lock(m_sortMutex);
+  if (!m_columnar.load(std::memory_order_relaxed))
+    return;
+  switch (eventType) {
+  case TOF:
+    m_columns.unpack(this->events);
+    break;
+  case WEIGHTED:
+    m_columns.unpack(this->weightedEvents);
+    break;
+  case WEIGHTED_NOTIME:
+    m_columns.unpack(this->weightedEventsNoTime);
+    break;
+  }
+  m_columnar.store(false, std::memory_order_release);
+}
+
 // ==============================================================================================
 // --- Testing functions (mostly)
 // ---------------------------------------------------------------
@@ -779,6 +1007,7 @@ void EventList::switchToWeightedEventsNoTime() {
  * @return a WeightedEvent
  */
 WeightedEvent EventList::getEvent(size_t event_number) {
+  this->unpackColumns();
   switch (eventType) {
   case TOF:
     return WeightedEvent(events[event_number]);
@@ -805,6 +1034,7 @@ WeightedEvent EventList::getEvent(size_t event_number) {
  * @return a const reference to the list of non-weighted events
  * */
 const std::vector<TofEvent> &EventList::getEvents() const {
+  this->unpackColumns();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
@@ -820,6 +1050,7 @@ const std::vector<TofEvent> &EventList::getEvents() const {
  * @return a reference to the list of non-weighted events
  * */
 std::vector<TofEvent> &EventList::getEvents() {
+  this->unpackColumns();
   if (eventType != TOF)
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
@@ -835,6 +1066,7 @@ std::vector<TofEvent> &EventList::getEvents() {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEvent> &EventList::getWeightedEvents() {
+  this->unpackColumns();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
@@ -850,6 +1082,7 @@ std::vector<WeightedEvent> &EventList::getWeightedEvents() {
  * @return a const reference to the list of weighted events
  * */
 const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
+  this->unpackColumns();
   if (eventType != WEIGHTED)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
@@ -863,6 +1096,7 @@ const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
  * @return a reference to the list of weighted events
  * */
 std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
+  this->unpackColumns();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEventNoTime. Use "
@@ -877,6 +1111,7 @@ std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
  * */
 const std::vector<WeightedEventNoTime> &
 EventList::getWeightedEventsNoTime() const {
+  this->unpackColumns();
   if (eventType != WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for "
                              "an EventList not of type WeightedEventNoTime. "
@@ -898,6 +1133,9 @@ void EventList::clear(const bool removeDetIDs) {
   this->weightedEventsNoTime.clear();
   std::vector<WeightedEventNoTime>().swap(
       this->weightedEventsNoTime); // STL Trick to release memory
+  m_columns.clear();
+  m_compactEvents.clear();
+  m_compact = false;
   if (removeDetIDs)
     this->clearDetectorIDs();
 }
@@ -940,6 +1178,11 @@ void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
  * @param num :: number of events that will be in this EventList
  */
 void EventList::reserve(size_t num) {
+  this->unpackCompact();
+  if (m_columnar) {
+    m_columns.reserve(num, eventType != WEIGHTED_NOTIME, eventType != TOF);
+    return;
+  }
   switch (this->eventType) {
   case TOF:
     this->events.reserve(num);
@@ -960,16 +1203,18 @@ void EventList::reserve(size_t num) {
 // --------------------------------------------------------------------------
 /** Sort events by TOF or Frame
  * @param order :: Order by which to sort.
+ * @param algorithm :: Sorting algorithm used for TOF and pulse time + TOF.
  * */
-void EventList::sort(const EventSortType order) const {
+void EventList::sort(const EventSortType order,
+                     const EventSortAlgorithm algorithm) const {
   if (order == UNSORTED) {
     return; // don't bother doing anything. Why did you ask to unsort?
   } else if (order == TOF_SORT) {
-    this->sortTof();
+    this->sortTof(algorithm);
   } else if (order == PULSETIME_SORT) {
     this->sortPulseTime();
   } else if (order == PULSETIMETOF_SORT) {
-    this->sortPulseTimeTOF();
+    this->sortPulseTimeTOF(algorithm);
   } else if (order == PULSETIMETOF_DELTA_SORT) {
     throw std::invalid_argument("sorting by pulse time with delta requires "
                                 "extra parameters. Use sortPulseTimeTOFDelta "
@@ -992,8 +1237,11 @@ void EventList::setSortOrder(const EventSortType order) const {
 }
 
 // --------------------------------------------------------------------------
-/** Sort events by TOF in one thread */
-void EventList::sortTof() const {
+/** Sort events by TOF
+ * @param algorithm :: Sorting algorithm to use. The structure-of-arrays layout
+ * always uses a comparison sort.
+ */
+void EventList::sortTof(const EventSortAlgorithm algorithm) const {
   if (this->order == TOF_SORT)
     return; // nothing to do
 
@@ -1003,6 +1251,33 @@ void EventList::sortTof() const {
   if (this->order == TOF_SORT)
     return;
 
+  if (m_columnar) {
+    m_columns.sortTof();
+    this->order = TOF_SORT;
+    return;
+  }
+  if (m_compact) {
+    m_compactEvents.sortTof();
+    this->order = TOF_SORT;
+    return;
+  }
+
+  if (algorithm == RADIX_SORT) {
+    switch (eventType) {
+    case TOF:
+      radixSortTof(events);
+      break;
+    case WEIGHTED:
+      radixSortTof(weightedEvents);
+      break;
+    case WEIGHTED_NOTIME:
+      radixSortTof(weightedEventsNoTime);
+      break;
+    }
+    this->order = TOF_SORT;
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     tbb::parallel_sort(events.begin(), events.end());
@@ -1031,6 +1306,8 @@ void EventList::sortTof() const {
 void EventList::sortTimeAtSample(const double &tofFactor,
                                  const double &tofShift,
                                  bool forceResort) const {
+  // The callers use the event vectors, even if already sorted
+  this->unpackColumns();
   // Check pre-cached sort flag.
   if (this->order == TIMEATSAMPLE_SORT && !forceResort)
     return;
@@ -1065,6 +1342,7 @@ void EventList::sortTimeAtSample(const double &tofFactor,
 // --------------------------------------------------------------------------
 /** Sort events by Frame */
 void EventList::sortPulseTime() const {
+  this->unpackColumns();
   if (this->order == PULSETIME_SORT)
     return; // nothing to do
 
@@ -1094,8 +1372,10 @@ void EventList::sortPulseTime() const {
 /*
  * Sort events by pulse time + TOF
  * (the absolute time)
+ * @param algorithm :: Sorting algorithm to use.
  */
-void EventList::sortPulseTimeTOF() const {
+void EventList::sortPulseTimeTOF(const EventSortAlgorithm algorithm) const {
+  this->unpackColumns();
   if (this->order == PULSETIMETOF_SORT)
     return; // already ordered.
 
@@ -1107,11 +1387,18 @@ void EventList::sortPulseTimeTOF() const {
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+    if (algorithm == RADIX_SORT)
+      radixSortPulseTimeTof(events);
+    else
+      tbb::parallel_sort(events.begin(), events.end(),
+                         compareEventPulseTimeTOF);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTimeTOF);
+    if (algorithm == RADIX_SORT)
+      radixSortPulseTimeTof(weightedEvents);
+    else
+      tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
+                         compareEventPulseTimeTOF);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1131,6 +1418,7 @@ void EventList::sortPulseTimeTOF() const {
  */
 void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
                                       const double seconds) const {
+  this->unpackColumns();
   // Avoid sorting from multiple threads
   std::lock_guard<std::mutex> _lock(m_sortMutex);
 
@@ -1173,7 +1461,10 @@ void EventList::reverse() {
   std::reverse(x.begin(), x.end());
 
   // flip the events if they are tof sorted
-  if (this->isSortedByTof()) {
+  this->unpackCompact();
+  if (this->isSortedByTof() && m_columnar) {
+    m_columns.reverse();
+  } else if (this->isSortedByTof()) {
     switch (eventType) {
     case TOF:
       std::reverse(this->events.begin(), this->events.end());
@@ -1200,6 +1491,10 @@ void EventList::reverse() {
  * @return the number of events in the list.
  *  */
 size_t EventList::getNumberEvents() const {
+  if (m_columnar)
+    return m_columns.size();
+  if (m_compact)
+    return m_compactEvents.size();
   switch (eventType) {
   case TOF:
     return this->events.size();
@@ -1215,6 +1510,10 @@ size_t EventList::getNumberEvents() const {
  * Much like stl containers, returns true if there is nothing in the event list.
  */
 bool EventList::empty() const {
+  if (m_columnar)
+    return m_columns.empty();
+  if (m_compact)
+    return m_compactEvents.empty();
   switch (eventType) {
   case TOF:
     return this->events.empty();
@@ -1234,6 +1533,10 @@ bool EventList::empty() const {
  * @return :: the memory used by the EventList, in bytes.
  * */
 size_t EventList::getMemorySize() const {
+  if (m_columnar)
+    return m_columns.getMemorySize() + sizeof(EventList);
+  if (m_compact)
+    return m_compactEvents.getMemorySize() + sizeof(EventList);
   switch (eventType) {
   case TOF:
     return this->events.capacity() * sizeof(TofEvent) + sizeof(EventList);
@@ -1761,6 +2064,8 @@ inline void EventList::compressFatEventsHelper(
  *be == this.
  */
 void EventList::compressEvents(double tolerance, EventList *destination) {
+  this->unpackColumns();
+  destination->unpackColumns();
   if (!this->empty()) {
     this->sortTof();
     switch (eventType) {
@@ -1814,9 +2119,79 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
   destination->clearUnused();
 }
 
+// --------------------------------------------------------------------------
+/** Compress weighted events without time that were appended to a list whose
+ * first events are already compressed and sorted by TOF. Only the appended
+ * events are sorted and grouped, with the same rule as compressEvents(). A
+ * group within the tolerance of the compressed event before it is added to
+ * that event; otherwise it is inserted as a new event. Compressed events are
+ * never combined with each other, so compressing in several passes differs
+ * from a single pass only where a group of a later pass lies within the
+ * tolerance of a compressed event of an earlier pass.
+ *
+ * @param tolerance :: how close do two event's TOF have to be to be considered
+ *the same.
+ * @param numCompressed :: number of events at the start of the list that are
+ *already compressed.
+ */
+void EventList::compressAppendedEvents(const double tolerance,
+                                       const size_t numCompressed) {
+  if (eventType != WEIGHTED_NOTIME)
+    throw std::runtime_error("EventList::compressAppendedEvents() called on an "
+                             "EventList that is not of weighted events "
+                             "without time.");
+  this->unpackColumns();
+  auto &compressed = this->weightedEventsNoTime;
+  if (numCompressed < compressed.size()) {
+    std::vector<WeightedEventNoTime> groups;
+    {
+      std::vector<WeightedEventNoTime> appended(
+          compressed.begin() + numCompressed, compressed.end());
+      compressed.resize(numCompressed);
+      std::sort(appended.begin(), appended.end());
+      compressEventsHelper(appended, groups, tolerance);
+    }
+
+    std::vector<WeightedEventNoTime> out;
+    out.reserve(compressed.size() + groups.size());
+    auto next = compressed.cbegin();
+    // TOF of the last compressed event put in the output, before any group
+    // was added to it
+    double lastTof = std::numeric_limits<double>::lowest();
+    bool lastIsCompressed = false;
+    for (const auto &group : groups) {
+      for (; next != compressed.cend() && next->m_tof <= group.m_tof; ++next) {
+        out.emplace_back(*next);
+        lastTof = next->m_tof;
+        lastIsCompressed = true;
+      }
+      if (lastIsCompressed && group.m_tof - lastTof <= tolerance) {
+        // The squared errors count the events when they are not weighted
+        auto &event = out.back();
+        const double norm = event.errorSquared() + group.errorSquared();
+        if (norm != 0.)
+          event.m_tof = (event.m_tof * event.errorSquared() +
+                         group.m_tof * group.errorSquared()) /
+                        norm;
+        event.m_weight = static_cast<float>(event.weight() + group.weight());
+        event.m_errorSquared =
+            static_cast<float>(event.errorSquared() + group.errorSquared());
+      } else {
+        out.emplace_back(group);
+        lastIsCompressed = false;
+      }
+    }
+    out.insert(out.end(), next, compressed.cend());
+    compressed.swap(out);
+  }
+  this->order = TOF_SORT;
+}
+
 void EventList::compressFatEvents(
     const double tolerance, const Mantid::Types::Core::DateAndTime &timeStart,
     const double seconds, EventList *destination) {
+  this->unpackColumns();
+  destination->unpackColumns();
 
   // only worry about non-empty EventLists
   if (!this->empty()) {
@@ -1982,57 +2357,17 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events,
     std::fill(E.begin(), E.end(), 0.0);
   }
 
-  //---------------------- Histogram without weights
-  //---------------------------------
-
-  // Do we even have any events to do?
-  if (!events.empty()) {
-    // Iterate through all events (sorted by tof)
-    auto itev = findFirstEvent(events, T(X[0]));
-    auto itev_end = events.cend();
-    // The above can still take you to end() if no events above X[0], so check
-    // again.
-    if (itev == itev_end)
-      return;
-
-    // Find the first bin
-    size_t bin = 0;
-    // The tof is greater the first bin boundary, so we need to find the first
-    // bin
-    double tof = itev->tof();
-    while (bin < x_size - 1) {
-      // Within range?
-      if ((tof >= X[bin]) && (tof < X[bin + 1])) {
-        // Add up the weight (convert to double before adding, to preserve
-        // precision)
-        Y[bin] += double(itev->m_weight);
-        E[bin] += double(itev->m_errorSquared); // square of error
-        break;
-      }
-      ++bin;
-    }
-    // Go to the next event, we've already binned this first one.
-    ++itev;
-
-    // Keep going through all the events
-    while ((itev != itev_end) && (bin < x_size - 1)) {
-      tof = itev->tof();
-      while (bin < x_size - 1) {
-        // Within range? Since both events and X are sorted, they are going to
-        // have
-        // tof >= X[bin] because the previous event was.
-        if (tof < X[bin + 1]) {
-          // Add up the weight (convert to double before adding, to preserve
-          // precision)
-          Y[bin] += double(itev->m_weight);
-          E[bin] += double(itev->m_errorSquared); // square of error
-          break;
-        }
-        ++bin;
-      }
-      ++itev;
+  // Locate the bin edges in the events (sorted by tof), then add up the
+  // weights of the events between each pair of edges. Convert to double
+  // before adding, to preserve precision.
+  std::vector<size_t> positions;
+  EventHistogramKernel::findEdges(events, X, positions);
+  for (size_t bin = 0; bin < x_size - 1; ++bin) {
+    for (size_t i = positions[bin]; i < positions[bin + 1]; ++i) {
+      Y[bin] += double(events[i].m_weight);
+      E[bin] += double(events[i].m_errorSquared); // square of error
     }
-  } // end if (there are any events to histogram)
+  }
 
   // Now do the sqrt of all errors
   std::transform(E.begin(), E.end(), E.begin(),
@@ -2051,6 +2386,7 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events,
  */
 void EventList::generateHistogramPulseTime(const MantidVec &X, MantidVec &Y,
                                            MantidVec &E, bool skipError) const {
+  this->unpackColumns();
   // All types of weights need to be sorted by Pulse Time
   this->sortPulseTime();
 
@@ -2088,6 +2424,7 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
                                               const double &tofFactor,
                                               const double &tofOffset,
                                               bool skipError) const {
+  this->unpackColumns();
   // All types of weights need to be sorted by time at sample
   this->sortTimeAtSample(tofFactor, tofOffset);
 
@@ -2122,7 +2459,6 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
 void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
                                   MantidVec &E, bool skipError) const {
   // All types of weights need to be sorted by TOF
-
   this->sortTof();
 
   switch (eventType) {
@@ -2134,10 +2470,18 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
     break;
 
   case WEIGHTED:
+    if (m_columnar) {
+      m_columns.generateWeightedHistogram(X, Y, E);
+      break;
+    }
     histogramForWeightsHelper(this->weightedEvents, X, Y, E);
     break;
 
   case WEIGHTED_NOTIME:
+    if (m_columnar) {
+      m_columns.generateWeightedHistogram(X, Y, E);
+      break;
+    }
     histogramForWeightsHelper(this->weightedEventsNoTime, X, Y, E);
     break;
   }
@@ -2163,53 +2507,13 @@ void EventList::generateCountsHistogramPulseTime(const MantidVec &X,
 
   // Sort the events by pulsetime
   this->sortPulseTime();
-  // Clear the Y data, assign all to 0.
-  Y.resize(x_size - 1, 0);
-
-  //---------------------- Histogram without weights
-  //---------------------------------
-
-  if (!this->events.empty()) {
-    // Iterate through all events (sorted by pulse time)
-    auto itev = findFirstPulseEvent(this->events, X[0]);
-    auto itev_end = events.cend(); // cache for speed
-    // The above can still take you to end() if no events above X[0], so check
-    // again.
-    if (itev == itev_end)
-      return;
-
-    // Find the first bin
-    size_t bin = 0;
-
-    // The tof is greater the first bin boundary, so we need to find the first
-    // bin
-    double pulsetime =
-        static_cast<double>(itev->pulseTime().totalNanoseconds());
-    while (bin < x_size - 1) {
-      // Within range?
-      if ((pulsetime >= X[bin]) && (pulsetime < X[bin + 1])) {
-        Y[bin]++;
-        break;
-      }
-      ++bin;
-    }
-    // Go to the next event, we've already binned this first one.
-    ++itev;
-
-    // Keep going through all the events
-    while ((itev != itev_end) && (bin < x_size - 1)) {
-      pulsetime = static_cast<double>(itev->pulseTime().totalNanoseconds());
-      while (bin < x_size - 1) {
-        // Within range?
-        if ((pulsetime >= X[bin]) && (pulsetime < X[bin + 1])) {
-          Y[bin]++;
-          break;
-        }
-        ++bin;
-      }
-      ++itev;
-    }
-  } // end if (there are any events to histogram)
+  // Each bin holds the events between the positions of its edges
+  std::vector<size_t> positions;
+  EventHistogramKernel::findEdges(
+      this->events, X, positions, [](const TofEvent &event) {
+        return static_cast<double>(event.pulseTime().totalNanoseconds());
+      });
+  EventHistogramKernel::countsFromEdges(positions, Y);
 }
 
 /** With respect to PulseTime fill a histogram given equal histogram
@@ -2231,6 +2535,7 @@ void EventList::generateCountsHistogramPulseTime(const double &xMin,
                                                  MantidVec &Y,
                                                  const double TOF_min,
                                                  const double TOF_max) const {
+  this->unpackColumns();
 
   if (this->events.empty())
     return;
@@ -2346,30 +2651,18 @@ void EventList::generateCountsHistogram(const MantidVec &X,
 
   // Sort the events by tof
   this->sortTof();
-  // Clear the Y data, assign all to 0.
-  Y.resize(x_size - 1, 0);
-
-  //---------------------- Histogram without weights
-  //---------------------------------
-
-  // Do we even have any events to do?
-  if (!this->events.empty()) {
-    // Iterate through all events (sorted by tof) placing them in the correct
-    // bin.
-    auto itev = findFirstEvent(this->events, TofEvent(X[0]));
-    // Go through all the events,
-    for (auto itx = X.cbegin(); itev != events.end(); ++itev) {
-      double tof = itev->tof();
-      itx = std::find_if(itx, X.cend(),
-                         [tof](const double x) { return tof < x; });
-      if (itx == X.cend()) {
-        break;
-      }
-      auto bin =
-          std::max(std::distance(X.cbegin(), itx) - 1, std::ptrdiff_t{0});
-      ++Y[bin];
-    }
-  } // end if (there are any events to histogram)
+  if (m_columnar) {
+    m_columns.generateCountsHistogram(X, Y);
+    return;
+  }
+  if (m_compact) {
+    m_compactEvents.generateCountsHistogram(X, Y);
+    return;
+  }
+  // Each bin holds the events between the positions of its edges
+  std::vector<size_t> positions;
+  EventHistogramKernel::findEdges(this->events, X, positions);
+  EventHistogramKernel::countsFromEdges(positions, Y);
 }
 
 // --------------------------------------------------------------------------
@@ -2490,6 +2783,14 @@ void EventList::integrate(const double minX, const double maxX,
     // The event list must be sorted by TOF!
     this->sortTof();
   }
+  if (m_columnar) {
+    m_columns.integrate(minX, maxX, entireRange, sum, error);
+    return;
+  }
+  if (m_compact) {
+    m_compactEvents.integrate(minX, maxX, entireRange, sum, error);
+    return;
+  }
 
   // Convert the list
   switch (eventType) {
@@ -2521,6 +2822,8 @@ void EventList::integrate(const double minX, const double maxX,
  */
 void EventList::convertTof(std::function<double(double)> func,
                            const int sorting) {
+  this->unpackCompact();
+  this->packColumns();
   // fix the histogram parameter
   MantidVec &x = dataX();
   transform(x.begin(), x.end(), x.begin(), func);
@@ -2535,6 +2838,11 @@ void EventList::convertTof(std::function<double(double)> func,
   if (this->getNumberEvents() <= 0)
     return;
 
+  if (m_columnar) {
+    m_columns.convertTof(func);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2568,6 +2876,8 @@ void EventList::convertTofHelper(std::vector<T> &events,
  * @param offset :: The value to shift the time-of-flight by
  */
 void EventList::convertTof(const double factor, const double offset) {
+  this->unpackCompact();
+  this->packColumns();
   // fix the histogram parameter
   auto &x = mutableX();
   x *= factor;
@@ -2579,6 +2889,11 @@ void EventList::convertTof(const double factor, const double offset) {
   if (this->getNumberEvents() <= 0)
     return;
 
+  if (m_columnar) {
+    m_columns.convertTof(factor, offset);
+    return;
+  }
+
   // Convert the list
   switch (eventType) {
   case TOF:
@@ -2665,6 +2980,7 @@ void EventList::addPulsetimesHelper(std::vector<T> &events,
  * @param seconds :: The value to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetime(const double seconds) {
+  this->unpackColumns();
   if (this->getNumberEvents() <= 0)
     return;
 
@@ -2690,6 +3006,7 @@ void EventList::addPulsetime(const double seconds) {
  * @param seconds :: A set of values to shift the pulsetime by, in seconds
  */
 void EventList::addPulsetimes(const std::vector<double> &seconds) {
+  this->unpackColumns();
   if (this->getNumberEvents() <= 0)
     return;
   if (this->getNumberEvents() != seconds.size()) {
@@ -2760,6 +3077,7 @@ std::size_t EventList::maskTofHelper(std::vector<T> &events,
  * @param tofMax :: upper bound of TOF to filter out
  */
 void EventList::maskTof(const double tofMin, const double tofMax) {
+  this->unpackColumns();
   if (tofMax <= tofMin)
     throw std::runtime_error("EventList::maskTof: tofMax must be > tofMin");
 
@@ -2830,6 +3148,7 @@ std::size_t EventList::maskConditionHelper(std::vector<T> &events,
  * @param mask :: condition vector
  */
 void EventList::maskCondition(const std::vector<bool> &mask) {
+  this->unpackColumns();
 
   // mask size must match the number of events
   if (this->getNumberEvents() != mask.size())
@@ -2879,6 +3198,15 @@ void EventList::getTofsHelper(const std::vector<T> &events,
  *  @param tofs :: A reference to the vector to be filled
  */
 void EventList::getTofs(std::vector<double> &tofs) const {
+  if (m_compact) {
+    m_compactEvents.getTofs(tofs);
+    return;
+  }
+  if (m_columnar) {
+    const auto &columnTofs = m_columns.tofs();
+    tofs.assign(columnTofs.cbegin(), columnTofs.cend());
+    return;
+  }
   // Set the capacity of the vector to avoid multiple resizes
   tofs.reserve(this->getNumberEvents());
 
@@ -2925,6 +3253,11 @@ void EventList::getWeightsHelper(const std::vector<T> &events,
  *  @param weights :: A reference to the vector to be filled
  */
 void EventList::getWeights(std::vector<double> &weights) const {
+  if (m_columnar && eventType != TOF) {
+    const auto &columnWeights = m_columns.weights();
+    weights.assign(columnWeights.cbegin(), columnWeights.cend());
+    return;
+  }
   // Set the capacity of the vector to avoid multiple resizes
   weights.reserve(this->getNumberEvents());
 
@@ -2973,6 +3306,16 @@ void EventList::getWeightErrorsHelper(const std::vector<T> &events,
  *  @param weightErrors :: A reference to the vector to be filled
  */
 void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
+  if (m_columnar && eventType != TOF) {
+    const auto &errorSquareds = m_columns.errorSquareds();
+    weightErrors.resize(errorSquareds.size());
+    std::transform(errorSquareds.cbegin(), errorSquareds.cend(),
+                   weightErrors.begin(),
+                   [](const float errorSquared) {
+                     return std::sqrt(double(errorSquared));
+                   });
+    return;
+  }
   // Set the capacity of the vector to avoid multiple resizes
   weightErrors.reserve(this->getNumberEvents());
 
@@ -3022,6 +3365,7 @@ void EventList::getPulseTimesHelper(
  * @return by copy a vector of DateAndTime times
  */
 std::vector<Mantid::Types::Core::DateAndTime> EventList::getPulseTimes() const {
+  this->unpackColumns();
   std::vector<Mantid::Types::Core::DateAndTime> times;
   // Set the capacity of the vector to avoid multiple resizes
   times.reserve(this->getNumberEvents());
@@ -3053,6 +3397,24 @@ double EventList::getTofMin() const {
   if (this->empty())
     return tMin;
 
+  if (m_columnar) {
+    const auto &tofs = m_columns.tofs();
+    if (this->order == TOF_SORT)
+      return tofs.front();
+    return *std::min_element(tofs.cbegin(), tofs.cend());
+  }
+  if (m_compact) {
+    const auto &compactEvents = m_compactEvents.events();
+    if (this->order == TOF_SORT)
+      return compactEvents.front().tof();
+    const auto byTof = [](const CompactEvent &lhs, const CompactEvent &rhs) {
+      return lhs.m_tof < rhs.m_tof;
+    };
+    const auto minimum =
+        std::min_element(compactEvents.cbegin(), compactEvents.cend(), byTof);
+    return minimum->tof();
+  }
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -3097,6 +3459,24 @@ double EventList::getTofMax() const {
   if (this->empty())
     return tMax;
 
+  if (m_columnar) {
+    const auto &tofs = m_columns.tofs();
+    if (this->order == TOF_SORT)
+      return tofs.back();
+    return *std::max_element(tofs.cbegin(), tofs.cend());
+  }
+  if (m_compact) {
+    const auto &compactEvents = m_compactEvents.events();
+    if (this->order == TOF_SORT)
+      return compactEvents.back().tof();
+    const auto byTof = [](const CompactEvent &lhs, const CompactEvent &rhs) {
+      return lhs.m_tof < rhs.m_tof;
+    };
+    const auto maximum =
+        std::max_element(compactEvents.cbegin(), compactEvents.cend(), byTof);
+    return maximum->tof();
+  }
+
   // when events are ordered by tof just need the first value
   if (this->order == TOF_SORT) {
     switch (eventType) {
@@ -3135,6 +3515,7 @@ double EventList::getTofMax() const {
  * @return The minimum tof value for the list of the events.
  */
 DateAndTime EventList::getPulseTimeMin() const {
+  this->unpackColumns();
   // set up as the maximum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3179,6 +3560,7 @@ DateAndTime EventList::getPulseTimeMin() const {
  * @return The maximum tof value for the list of events.
  */
 DateAndTime EventList::getPulseTimeMax() const {
+  this->unpackColumns();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3222,6 +3604,7 @@ DateAndTime EventList::getPulseTimeMax() const {
 void EventList::getPulseTimeMinMax(
     Mantid::Types::Core::DateAndTime &tMin,
     Mantid::Types::Core::DateAndTime &tMax) const {
+  this->unpackColumns();
   // set up as the minimum available date time.
   tMax = DateAndTime::minimum();
   tMin = DateAndTime::maximum();
@@ -3272,6 +3655,7 @@ void EventList::getPulseTimeMinMax(
 
 DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
                                           const double &tofOffset) const {
+  this->unpackColumns();
   // set up as the minimum available date time.
   DateAndTime tMax = DateAndTime::minimum();
 
@@ -3319,6 +3703,7 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
 
 DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor,
                                           const double &tofOffset) const {
+  this->unpackColumns();
   // set up as the minimum available date time.
   DateAndTime tMin = DateAndTime::maximum();
 
@@ -3391,6 +3776,7 @@ void EventList::setTofsHelper(std::vector<T> &events,
  * @param tofs :: The vector of doubles to set the tofs to.
  */
 void EventList::setTofs(const MantidVec &tofs) {
+  this->unpackColumns();
   this->order = UNSORTED;
 
   // Convert the list
@@ -3459,6 +3845,7 @@ void EventList::multiplyHelper(std::vector<T> &events, const double value,
  * @return reference to this
  */
 EventList &EventList::operator*=(const double value) {
+  this->unpackColumns();
   this->multiply(value);
   return *this;
 }
@@ -3493,6 +3880,7 @@ EventList &EventList::operator*=(const double value) {
  * @param error: error on 'value'. Can be 0.
  */
 void EventList::multiply(const double value, const double error) {
+  this->unpackColumns();
   // Do nothing if multiplying by exactly one and there is no error
   if ((value == 1.0) && (error == 0.0))
     return;
@@ -3621,6 +4009,7 @@ void EventList::multiplyHistogramHelper(std::vector<T> &events,
  */
 void EventList::multiply(const MantidVec &X, const MantidVec &Y,
                          const MantidVec &E) {
+  this->unpackColumns();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3761,6 +4150,7 @@ void EventList::divideHistogramHelper(std::vector<T> &events,
  */
 void EventList::divide(const MantidVec &X, const MantidVec &Y,
                        const MantidVec &E) {
+  this->unpackColumns();
   switch (eventType) {
   case TOF:
     // Switch to weights if needed.
@@ -3791,6 +4181,7 @@ void EventList::divide(const MantidVec &X, const MantidVec &Y,
  * @throw std::invalid_argument if value == 0; cannot divide by zero.
  */
 EventList &EventList::operator/=(const double value) {
+  this->unpackColumns();
   if (value == 0.0)
     throw std::invalid_argument(
         "EventList::divide() called with value of 0.0. Cannot divide by zero.");
@@ -3809,6 +4200,7 @@ EventList &EventList::operator/=(const double value) {
  * @throw std::invalid_argument if value == 0; cannot divide by zero.
  */
 void EventList::divide(const double value, const double error) {
+  this->unpackColumns();
   if (value == 0.0)
     throw std::invalid_argument(
         "EventList::divide() called with value of 0.0. Cannot divide by zero.");
@@ -3828,7 +4220,7 @@ void EventList::divide(const double value, const double error) {
 // ----------- SPLITTING AND FILTERING ---------------------------------------
 // ==============================================================================================
 /** Filter a vector of events into another based on pulse time.
- * TODO: Make this more efficient using STL-fu.
+ * The events must be sorted by pulse time.
  * @param events :: input events
  * @param start :: start time (absolute)
  * @param stop :: end time (absolute)
@@ -3838,17 +4230,9 @@ template <class T>
 void EventList::filterByPulseTimeHelper(std::vector<T> &events,
                                         DateAndTime start, DateAndTime stop,
                                         std::vector<T> &output) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  // Find the first event with m_pulsetime >= start
-  while ((itev != itev_end) && (itev->m_pulsetime < start))
-    itev++;
-
-  while ((itev != itev_end) && (itev->m_pulsetime < stop)) {
-    // Add the copy to the output
-    output.emplace_back(*itev);
-    ++itev;
-  }
+  const auto first = findPulseTime(events.cbegin(), events.cend(), start);
+  const auto last = findPulseTime(first, events.cend(), stop);
+  output.insert(output.end(), first, last);
 }
 
 /** Filter a vector of events into another based on time at sample.
@@ -3902,6 +4286,7 @@ void EventList::filterByPulseTime(DateAndTime start, DateAndTime stop,
   this->sortPulseTime();
   // Clear the output
   output.clear();
+  output.unpackColumns();
   // Has to match the given type
   output.switchTo(eventType);
   output.setDetectorIDs(this->getDetectorIDs());
@@ -3936,6 +4321,7 @@ void EventList::filterByTimeAtSample(Types::Core::DateAndTime start,
   this->sortTimeAtSample(tofFactor, tofOffset);
   // Clear the output
   output.clear();
+  output.unpackColumns();
   // Has to match the given type
   output.switchTo(eventType);
   output.setDetectorIDs(this->getDetectorIDs());
@@ -3993,31 +4379,19 @@ void EventList::filterInPlaceHelper(Kernel::TimeSplitterType &splitter,
     const int index = itspl->index();
 
     // Skip the events before the start of the time
-    while ((itev != itev_end) && (itev->m_pulsetime < start))
-      itev++;
+    itev = findPulseTime(itev, itev_end, start);
+    const auto intervalEnd = findPulseTime(itev, itev_end, stop);
 
     // Are we aligned in the input vs output?
     bool copyingInPlace = (itOut == itev);
     if (copyingInPlace) {
-      while ((itev != itev_end) && (itev->m_pulsetime < stop))
-        ++itev;
       // Make sure the iterators still match
-      itOut = itev;
-    } else {
-      // Go through all the events that are in the interval (if any)
-      while ((itev != itev_end) && (itev->m_pulsetime < stop)) {
-        if (index >= 0) {
-          // Copy the input Event to the output iterator position.
-          // Strictly speaking, this is not necessary if itOut == itev; but the
-          // extra check would likely
-          //  slow down the filtering in the 99% of cases where itOut != itev.
-          *itOut = *itev;
-          // And go up a spot in the output iterator.
-          ++itOut;
-        }
-        ++itev;
-      }
+      itOut = intervalEnd;
+    } else if (index >= 0) {
+      // Move the events in the interval down to the output position
+      itOut = std::copy(itev, intervalEnd, itOut);
     }
+    itev = intervalEnd;
 
     // Go to the next interval
     ++itspl;
@@ -4043,6 +4417,7 @@ void EventList::filterInPlaceHelper(Kernel::TimeSplitterType &splitter,
  *     that will be kept. Any other events will be deleted.
  */
 void EventList::filterInPlace(Kernel::TimeSplitterType &splitter) {
+  this->unpackColumns();
   // Start by sorting the event list by pulse time.
   this->sortPulseTime();
 
@@ -4096,20 +4471,13 @@ void EventList::splitByTimeHelper(Kernel::TimeSplitterType &splitter,
     const size_t index = itspl->index();
 
     // Skip the events before the start of the time
-    while ((itev != itev_end) && (itev->m_pulsetime < start))
-      itev++;
-
-    // Go through all the events that are in the interval (if any)
-    while ((itev != itev_end) && (itev->m_pulsetime < stop)) {
-      // Copy the event into another
-      const T eventCopy(*itev);
-      if (index < numOutputs) {
-        EventList *myOutput = outputs[index];
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-      }
-      ++itev;
-    }
+    itev = findPulseTime(itev, itev_end, start);
+
+    // Copy all the events that are in the interval (if any)
+    const auto intervalEnd = findPulseTime(itev, itev_end, stop);
+    if (index < numOutputs)
+      appendEventsHelper<T>(*outputs[index], itev, intervalEnd);
+    itev = intervalEnd;
 
     // Go to the next interval
     ++itspl;
@@ -4145,6 +4513,7 @@ void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
   size_t numOutputs = outputs.size();
   for (size_t i = 0; i < numOutputs; i++) {
     outputs[i]->clear();
+    outputs[i]->unpackColumns();
     outputs[i]->setDetectorIDs(this->getDetectorIDs());
     outputs[i]->setHistogram(m_histogram);
     // Match the output event type.
@@ -4196,6 +4565,25 @@ void EventList::splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
   // 2. Prepare to Iterate through all events (sorted by tof)
   auto itev = events.begin();
   auto itev_end = events.end();
+  EventList *unfiltered = outputs[-1];
+
+  // The full time is not monotonic in a list sorted by pulse time, so the
+  // intervals are found by a linear scan. The events of each are then copied
+  // in one go.
+  const auto startTime = [=](const T &event) {
+    if (docorrection)
+      return calculateCorrectedFullTime(event, toffactor, tofshift);
+    return event.m_pulsetime.totalNanoseconds() +
+           static_cast<int64_t>(event.m_tof * 1000);
+  };
+  const auto stopTime = [=](const T &event) {
+    if (docorrection)
+      return event.m_pulsetime.totalNanoseconds() +
+             static_cast<int64_t>(toffactor * event.m_tof * 1000 +
+                                  tofshift * 1.0E9);
+    return event.m_pulsetime.totalNanoseconds() +
+           static_cast<int64_t>(event.m_tof * 1000);
+  };
 
   // 3. This is the time of the first section. Anything before is thrown out.
   while (itspl != itspl_end) {
@@ -4204,44 +4592,20 @@ void EventList::splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
     int64_t stop = itspl->stop().totalNanoseconds();
     const int index = itspl->index();
 
-    // a) Skip the events before the start of the time
-    // TODO This step can be
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      int64_t fulltime;
-      if (docorrection)
-        fulltime = calculateCorrectedFullTime(*itev, toffactor, tofshift);
-      else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < start) {
-        // a1) Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        itev++;
-      } else {
-        break;
-      }
-    }
-
-    // b) Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-      int64_t fulltime;
-      if (docorrection)
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(toffactor * itev->m_tof * 1000 +
-                                        tofshift * 1.0E9);
-      else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < stop) {
-        // b1) Add a copy to the output
-        outputs[index]->addEventQuickly(*itev);
-        ++itev;
-      } else {
-        break;
-      }
-    }
+    // a) Record the events before the start of the time to index = -1 space
+    auto intervalStart = itev;
+    while (intervalStart != itev_end && startTime(*intervalStart) < start)
+      ++intervalStart;
+    if (intervalStart != itev)
+      appendEventsHelper<T>(*unfiltered, itev, intervalStart);
+
+    // b) Add all the events that are in the interval (if any) to the output
+    auto intervalEnd = intervalStart;
+    while (intervalEnd != itev_end && stopTime(*intervalEnd) < stop)
+      ++intervalEnd;
+    if (intervalEnd != intervalStart)
+      appendEventsHelper<T>(*outputs[index], intervalStart, intervalEnd);
+    itev = intervalEnd;
 
     // Go to the next interval
     ++itspl;
@@ -4283,6 +4647,7 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
   for (outiter = outputs.begin(); outiter != outputs.end(); ++outiter) {
     EventList *opeventlist = outiter->second;
     opeventlist->clear();
+    opeventlist->unpackColumns();
     opeventlist->setDetectorIDs(this->getDetectorIDs());
     opeventlist->setHistogram(m_histogram);
     // Match the output event type.
@@ -4311,260 +4676,136 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
   }
 }
 
-//------------------------------------------------------------------------------------------------
-/** Split the event list into n outputs, operating on a vector of either
- *TofEvent's or WeightedEvent's
- *  The comparison between neutron event and splitter is based on neutron
- *event's pulse time plus
- *
- * @param vectimes :: a vector of absolute time in nanoseconds serving as
- *boundaries of splitters
- * @param vecgroups :: a vector of integer serving as the target workspace group
- *for splitters
- * @param outputs :: a vector of where the split events will end up. The # of
- *entries in there should
- *        be big enough to accommodate the indices.
- * @param vecEvents :: either this->events or this->weightedEvents.
- * @param docorrection :: flag to determine whether or not to apply correction
- * @param toffactor :: factor multiplied to TOF for correcting event time from
- *detector to sample
- * @param tofshift :: shift in SECOND to TOF for correcting event time from
- *detector to sample
- */
-template <class T>
-std::string EventList::splitByFullTimeVectorSplitterHelper(
-    const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-    std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-    bool docorrection, double toffactor, double tofshift) const {
-  // Define variables for events
-  // size_t numevents = events.size();
-  typename std::vector<T>::iterator eviter;
-  std::stringstream msgss;
-
-  // Loop through events
-  for (eviter = vecEvents.begin(); eviter != vecEvents.end(); ++eviter) {
-    // Obtain time of event
-    int64_t evabstimens;
-    if (docorrection)
-      evabstimens = eviter->m_pulsetime.totalNanoseconds() +
-                    static_cast<int64_t>(toffactor * eviter->m_tof * 1000 +
-                                         tofshift * 1.0E9);
-    else
-      evabstimens = eviter->m_pulsetime.totalNanoseconds() +
-                    static_cast<int64_t>(eviter->m_tof * 1000);
-
-    // Search in vector
-    int index = static_cast<int>(
-        lower_bound(vectimes.begin(), vectimes.end(), evabstimens) -
-        vectimes.begin());
-    int group;
-    // FIXME - whether lower_bound() equal to vectimes.size()-1 should be
-    // filtered out?
-    if (index == 0 || index > static_cast<int>(vectimes.size() - 1)) {
-      // Event is before first splitter or after last splitter.  Put to -1
-      group = -1;
-    } else {
-      group = vecgroups[index - 1];
-    }
-
-    // Copy event to the proper group
-    EventList *myOutput = outputs[group];
-    if (!myOutput) {
-      std::stringstream errss;
-      errss << "Group " << group << " has a NULL output EventList. "
-            << "\n";
-      msgss << errss.str();
-    } else {
-      const T eventCopy(*eviter);
-      myOutput->addEventQuickly(eventCopy);
-    }
-  }
-
-  return (msgss.str());
-}
-
-//------------------------------------------------------------------------------------------------
-/** Split the event list into n outputs, operating on a vector of either
- *TofEvent's or WeightedEvent's
- *  The comparison between neutron event and splitter is based on neutron
- *event's pulse time plus
- *
- * @param vectimes :: a vector of absolute time in nanoseconds serving as
- *boundaries of splitters
- * @param vecgroups :: a vector of integer serving as the target workspace group
- *for splitters
- * @param outputs :: a vector of where the split events will end up. The # of
- *entries in there should
- *        be big enough to accommodate the indices.
- * @param vecEvents :: either this->events or this->weightedEvents.
- * @param docorrection :: flag to determine whether or not to apply correction
- * @param toffactor :: factor multiplied to TOF for correcting event time from
- *detector to sample
- * @param tofshift :: shift in SECOND to TOF for correcting event time from
- *detector to sample
- */
-template <class T>
-std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
-    const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-    std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-    bool docorrection, double toffactor, double tofshift) const {
-  // Define variables for events
-  // size_t numevents = events.size();
-  // typename std::vector<T>::iterator eviter;
-  std::stringstream msgss;
-
-  size_t num_splitters = vecgroups.size();
-  // prepare to Iterate through all events (sorted by tof)
-  auto iter_events = vecEvents.begin();
-  auto iter_events_end = vecEvents.end();
-
-  // std::stringstream debug_ss;
-  // debug_ss << "\nFilter events...:\n";
-
-  for (size_t i = 0; i < num_splitters; ++i) {
-    // get one splitter
-    int64_t start_i64 = vectimes[i];
-    int64_t stop_i64 = vectimes[i + 1];
-    int group = vecgroups[i];
-    // debug_ss << "working on splitter: " << i << " from " << start_i64 << " to
-    // " << stop_i64 << "\n";
-
-    // go over events
-    while (iter_events != iter_events_end) {
-      int64_t absolute_time;
-      if (docorrection)
-        absolute_time =
-            iter_events->m_pulsetime.totalNanoseconds() +
-            static_cast<int64_t>(toffactor * iter_events->m_tof * 1000 +
-                                 tofshift * 1.0E9);
-      else
-        absolute_time = iter_events->m_pulsetime.totalNanoseconds() +
-                        static_cast<int64_t>(iter_events->m_tof * 1000);
-
-      // debug_ss << "  event " << iter_events - vecEvents.begin() << " abs.time
-      // = " << absolute_time << "\n";
-
-      if (absolute_time < start_i64) {
-        // event occurs before the splitter. only can happen with first
-        // splitter. Then ignore and move to next
-        ++iter_events;
-        continue;
-      }
-
-      if (absolute_time < stop_i64) {
-        // in the splitter, then copy the event into another
-        const T eventCopy(*iter_events);
-        // Copy event to the proper group
-        EventList *myOutput = outputs[group];
-        if (!myOutput) {
-          // there is no such group defined. quit for this group
-          std::stringstream errss;
-          errss << "Group " << group << " has a NULL output EventList. "
-                << "\n";
-          msgss << errss.str();
-          throw std::runtime_error(errss.str());
-        }
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-        ++iter_events;
-      } else {
-        // event occurs after the stop time, it should belonged to the next
-        // splitter
-        break;
-      }
-    } // while
-
-    // quit the loop if there is no more event left
-    if (iter_events == iter_events_end)
-      break;
-  } // for splitter
-
-  // std::cout << debug_ss.str();
-
-  return (msgss.str());
-}
-
 //----------------------------------------------------------------------------------------------
-/**
- * @brief EventList::splitByFullTimeMatrixSplitter
- * @param vec_splitters_time  :: vector of splitting times
- * @param vecgroups :: vector of index group for splitters
- * @param vec_outputEventList :: vector of groups of splitted events
+/** Split the event list between outputs by the full time of each event, i.e.
+ * its pulse time plus its (corrected) TOF. Every event is assigned a target
+ * and counted first, so each output is allocated once at its final size, and
+ * the events are then copied in a single pass. The events of every output stay
+ * in the order of this list, which is sorted by pulse time and TOF first.
+ *
+ * @param splitterTimes :: boundaries of the splitters in nanoseconds. Events
+ *        in [splitterTimes[i], splitterTimes[i + 1]) go to target
+ *        splitterTargets[i].
+ * @param splitterTargets :: target of each splitter
+ * @param outputs :: output event list of each target, indexed by target.
+ *        Events outside all splitters, or of a target without an output, are
+ *        dropped. If there are no splitters at all, every event is copied to
+ *        target 0, the unfiltered events in FilterEvents.
  * @param docorrection :: flag to do TOF correction from detector to sample
  * @param toffactor :: factor multiplied to TOF for correction
  * @param tofshift :: shift to TOF in unit of SECOND for correction
- * @return
  */
-// TODO/FIXME/NOW - Consider to use vector to replace vec_outputEventList and
-// have an option to ignore the un-filtered events!
-std::string EventList::splitByFullTimeMatrixSplitter(
-    const std::vector<int64_t> &vec_splitters_time,
-    const std::vector<int> &vecgroups,
-    std::map<int, EventList *> vec_outputEventList, bool docorrection,
+void EventList::splitByFullTimeToTargets(
+    const std::vector<int64_t> &splitterTimes,
+    const std::vector<int> &splitterTargets,
+    const std::vector<EventList *> &outputs, bool docorrection,
     double toffactor, double tofshift) const {
-  // Check validity
   if (eventType == WEIGHTED_NOTIME)
-    throw std::runtime_error("EventList::splitByTime() called on an EventList "
-                             "that no longer has time information.");
+    throw std::runtime_error("EventList::splitByFullTimeToTargets() called on "
+                             "an EventList that no longer has time "
+                             "information.");
+  if (!splitterTargets.empty() &&
+      splitterTimes.size() != splitterTargets.size() + 1)
+    throw std::runtime_error("Splitter time vector size and splitter target "
+                             "vector size are not correct.");
 
-  // Start by sorting the event list by pulse time, if its flag is not set up
-  // right
-  sortPulseTimeTOF();
+  this->sortPulseTimeTOF();
 
-  // Initialize all the output event list
-  std::map<int, EventList *>::iterator outiter;
-  for (outiter = vec_outputEventList.begin();
-       outiter != vec_outputEventList.end(); ++outiter) {
-    EventList *opeventlist = outiter->second;
-    opeventlist->clear();
-    opeventlist->setDetectorIDs(this->getDetectorIDs());
-    opeventlist->setHistogram(m_histogram);
+  // Initialize all the outputs
+  for (auto *output : outputs) {
+    if (!output)
+      continue;
+    output->clear();
+    output->unpackColumns();
+    output->setDetectorIDs(this->getDetectorIDs());
+    output->setHistogram(m_histogram);
     // Match the output event type.
-    opeventlist->switchTo(eventType);
+    output->switchTo(eventType);
   }
 
-  std::string debugmessage;
-
-  // Do nothing if there are no entries
-  if (vecgroups.empty()) {
-    // Copy all events to group workspace = -1
-    (*vec_outputEventList[-1]) = (*this);
-    // this->duplicate(outputs[-1]);
-  } else {
-    // Split
+  if (splitterTargets.empty()) {
+    if (!outputs.empty() && outputs[0])
+      *outputs[0] = *this;
+    return;
+  }
 
-    // Try to find out which filtering algorithm to use by comparing number of
-    // splitters and number of events
-    bool sparse_splitter = vec_splitters_time.size() < this->getNumberEvents();
+  switch (eventType) {
+  case TOF:
+    scatterByFullTimeHelper(splitterTimes, splitterTargets, outputs,
+                            this->events, docorrection, toffactor, tofshift);
+    break;
+  case WEIGHTED:
+    scatterByFullTimeHelper(splitterTimes, splitterTargets, outputs,
+                            this->weightedEvents, docorrection, toffactor,
+                            tofshift);
+    break;
+  case WEIGHTED_NOTIME:
+    break;
+  }
+}
 
-    switch (eventType) {
-    case TOF:
-      if (sparse_splitter)
-        debugmessage = splitByFullTimeSparseVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList, this->events,
-            docorrection, toffactor, tofshift);
-      else
-        debugmessage = splitByFullTimeVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList, this->events,
-            docorrection, toffactor, tofshift);
-      break;
-    case WEIGHTED:
-      if (sparse_splitter)
-        debugmessage = splitByFullTimeSparseVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList,
-            this->weightedEvents, docorrection, toffactor, tofshift);
-      else
-        debugmessage = splitByFullTimeVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList,
-            this->weightedEvents, docorrection, toffactor, tofshift);
-      break;
-    case WEIGHTED_NOTIME:
-      debugmessage = "TOF type is weighted no time.  Impossible to split. ";
-      break;
+/** Copy the events of a vector to the outputs of their targets, counting the
+ * events of every target before allocating the outputs.
+ * @param splitterTimes :: boundaries of the splitters in nanoseconds
+ * @param splitterTargets :: target of each splitter
+ * @param outputs :: output event list of each target, indexed by target
+ * @param events :: either this->events or this->weightedEvents
+ * @param docorrection :: flag to do TOF correction from detector to sample
+ * @param toffactor :: factor multiplied to TOF for correction
+ * @param tofshift :: shift to TOF in unit of SECOND for correction
+ */
+template <class T>
+void EventList::scatterByFullTimeHelper(
+    const std::vector<int64_t> &splitterTimes,
+    const std::vector<int> &splitterTargets,
+    const std::vector<EventList *> &outputs, const std::vector<T> &events,
+    bool docorrection, double toffactor, double tofshift) const {
+  // Find the target of every event and count the events of every target
+  std::vector<int> eventTargets(events.size(), -1);
+  std::vector<size_t> counts(outputs.size(), 0);
+  size_t splitter = 0;
+  for (size_t i = 0; i < events.size(); ++i) {
+    const auto &event = events[i];
+    int64_t time;
+    if (docorrection)
+      time = event.m_pulsetime.totalNanoseconds() +
+             static_cast<int64_t>(toffactor * event.m_tof * 1000 +
+                                  tofshift * 1.0E9);
+    else
+      time = event.m_pulsetime.totalNanoseconds() +
+             static_cast<int64_t>(event.m_tof * 1000);
+
+    // Most events fall in the same splitter as the one before them
+    if (time < splitterTimes[splitter] || time >= splitterTimes[splitter + 1]) {
+      const auto next = std::upper_bound(splitterTimes.cbegin(),
+                                         splitterTimes.cend(), time);
+      if (next == splitterTimes.cbegin() || next == splitterTimes.cend())
+        continue;
+      splitter = static_cast<size_t>(next - splitterTimes.cbegin()) - 1;
     }
+    const int target = splitterTargets[splitter];
+    if (target < 0 || static_cast<size_t>(target) >= outputs.size() ||
+        !outputs[target])
+      continue;
+    eventTargets[i] = target;
+    ++counts[target];
   }
 
-  return debugmessage;
+  // Allocate every output at its final size
+  std::vector<std::vector<T> *> destinations(outputs.size(), nullptr);
+  for (size_t target = 0; target < outputs.size(); ++target) {
+    if (counts[target] == 0)
+      continue;
+    getEventsFrom(*outputs[target], destinations[target]);
+    destinations[target]->reserve(counts[target]);
+    outputs[target]->order = this->order;
+  }
+
+  // Copy the events
+  for (size_t i = 0; i < events.size(); ++i) {
+    if (eventTargets[i] >= 0)
+      destinations[eventTargets[i]]->emplace_back(events[i]);
+  }
 }
 
 //-------------------------------------------
@@ -4583,6 +4824,7 @@ void EventList::splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
   // Prepare to Events Iterate through all events (sorted by tof)
   auto itev = events.begin();
   auto itev_end = events.end();
+  EventList *unfiltered = outputs[-1];
 
   // Iterate (loop) on all splitters
   while (itspl != itspl_end) {
@@ -4593,30 +4835,15 @@ void EventList::splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
 
     // Skip the events before the start of the time and put to 'unfiltered'
     // EventList
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      if (itev->m_pulsetime < start) {
-        // Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        // Event within a splitter interval
-        break;
-      }
-    }
+    const auto intervalStart = findPulseTime(itev, itev_end, start);
+    if (intervalStart != itev)
+      appendEventsHelper<T>(*unfiltered, itev, intervalStart);
 
-    // Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-
-      if (itev->m_pulsetime < stop) {
-        outputs[index]->addEventQuickly(*itev);
-        ++itev;
-      } else {
-        // Out of interval
-        break;
-      }
-    }
+    // Copy all the events that are in the interval (if any)
+    const auto intervalEnd = findPulseTime(intervalStart, itev_end, stop);
+    if (intervalEnd != intervalStart)
+      appendEventsHelper<T>(*outputs[index], intervalStart, intervalEnd);
+    itev = intervalEnd;
 
     // Go to the next interval
     ++itspl;
@@ -4648,6 +4875,7 @@ void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
   for (outiter = outputs.begin(); outiter != outputs.end(); ++outiter) {
     EventList *opeventlist = outiter->second;
     opeventlist->clear();
+    opeventlist->unpackColumns();
     opeventlist->setDetectorIDs(this->getDetectorIDs());
     opeventlist->setHistogram(m_histogram);
     // Match the output event type.
@@ -4693,6 +4921,7 @@ void EventList::splitByPulseTimeWithMatrix(
   for (outiter = outputs.begin(); outiter != outputs.end(); ++outiter) {
     EventList *opeventlist = outiter->second;
     opeventlist->clear();
+    opeventlist->unpackColumns();
     opeventlist->setDetectorIDs(this->getDetectorIDs());
     opeventlist->setHistogram(m_histogram);
     // Match the output event type.
@@ -4733,6 +4962,7 @@ void EventList::splitByPulseTimeWithMatrixHelper(
   // Prepare to Events Iterate through all events (sorted by tof)
   auto itev = events.begin();
   auto itev_end = events.end();
+  EventList *unfiltered = outputs[-1];
 
   // Iterate (loop) on all splitters
   for (size_t i_target = 0; i_target < vec_split_target.size(); ++i_target) {
@@ -4743,30 +4973,17 @@ void EventList::splitByPulseTimeWithMatrixHelper(
 
     // Skip the events before the start of the time and put to 'unfiltered'
     // EventList
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      if (itev->m_pulsetime < start) {
-        // Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        // Event within a splitter interval
-        break;
-      }
-    }
-
-    // Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-
-      if (itev->m_pulsetime < stop) {
-        outputs[index]->addEventQuickly(*itev);
-        ++itev;
-      } else {
-        // Out of interval
-        break;
-      }
-    }
+    const auto intervalStart =
+        findPulseTime(itev, itev_end, DateAndTime(start));
+    if (intervalStart != itev)
+      appendEventsHelper<T>(*unfiltered, itev, intervalStart);
+
+    // Copy all the events that are in the interval (if any)
+    const auto intervalEnd =
+        findPulseTime(intervalStart, itev_end, DateAndTime(stop));
+    if (intervalEnd != intervalStart)
+      appendEventsHelper<T>(*outputs[index], intervalStart, intervalEnd);
+    itev = intervalEnd;
 
     // No need to keep looping through the filter if we are out of events
     if (itev == itev_end)
@@ -4774,6 +4991,25 @@ void EventList::splitByPulseTimeWithMatrixHelper(
   } // END-WHILE Splitter
 }
 
+/** Append a range of events to another event list of the same type. The
+ * output is no longer sorted afterwards.
+ * @param output :: the list to add the events to
+ * @param first :: start of the range of events
+ * @param last :: end of the range of events
+ */
+template <class T>
+void EventList::appendEventsHelper(
+    EventList &output, typename std::vector<T>::const_iterator first,
+    typename std::vector<T>::const_iterator last) {
+  if (first == last)
+    return;
+  std::vector<T> *events;
+  output.unpackColumns();
+  getEventsFrom(output, events);
+  events->insert(events->end(), first, last);
+  output.order = UNSORTED;
+}
+
 //--------------------------------------------------------------------------
 /** Get the vector of events contained in an EventList;
  * this is overloaded by event type.
@@ -4839,13 +5075,17 @@ template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
                                          Mantid::Kernel::Unit *fromUnit,
                                          Mantid::Kernel::Unit *toUnit) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  for (; itev != itev_end; itev++) {
-    // Conver to TOF
-    double tof = fromUnit->singleToTOF(itev->m_tof);
-    // And back from TOF to whatever
-    itev->m_tof = toUnit->singleFromTOF(tof);
+  // Gather the times-of-flight in blocks, so that the units convert a whole
+  // block at a time
+  std::array<double, 1024> tofs;
+  for (size_t start = 0; start < events.size(); start += tofs.size()) {
+    const size_t blockSize = std::min(tofs.size(), events.size() - start);
+    const auto block = events.begin() + start;
+    for (size_t i = 0; i < blockSize; ++i)
+      tofs[i] = block[i].m_tof;
+    fromUnit->convertViaTOF(*toUnit, tofs.data(), tofs.data() + blockSize);
+    for (size_t i = 0; i < blockSize; ++i)
+      block[i].m_tof = tofs[i];
   }
 }
 
@@ -4870,6 +5110,14 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit *fromUnit,
     throw std::runtime_error(
         "EventList::convertUnitsViaTof(): toUnit is not initialized!");
 
+  this->unpackCompact();
+  this->packColumns();
+  if (m_columnar) {
+    auto &tofs = m_columns.tofs();
+    fromUnit->convertViaTOF(*toUnit, tofs.data(), tofs.data() + tofs.size());
+    return;
+  }
+
   switch (eventType) {
   case TOF:
     convertUnitsViaTofHelper(this->events, fromUnit, toUnit);
@@ -4907,6 +5155,12 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events,
  *  @param power :: the Power b to apply to the conversion
  */
 void EventList::convertUnitsQuickly(const double &factor, const double &power) {
+  this->unpackCompact();
+  this->packColumns();
+  if (m_columnar) {
+    m_columns.convertUnitsQuickly(factor, power);
+    return;
+  }
   switch (eventType) {
   case TOF:
     convertUnitsQuicklyHelper(this->events, factor, power);
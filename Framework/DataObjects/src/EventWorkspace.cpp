@@ -25,6 +25,7 @@
 #include "MantidKernel/TimeSeriesProperty.h"
 
 #include "tbb/parallel_for.h"
+#include <algorithm>
 #include <limits>
 #include <numeric>
 
@@ -45,11 +46,12 @@ using std::size_t;
 using namespace Mantid::Kernel;
 
 EventWorkspace::EventWorkspace(const Parallel::StorageMode storageMode)
-    : IEventWorkspace(storageMode), mru(std::make_unique<EventWorkspaceMRU>()) {
-}
+    : IEventWorkspace(storageMode), mru(std::make_unique<EventWorkspaceMRU>()),
+      m_storageLayout(ARRAY_OF_STRUCTS) {}
 
 EventWorkspace::EventWorkspace(const EventWorkspace &other)
-    : IEventWorkspace(other), mru(std::make_unique<EventWorkspaceMRU>()) {
+    : IEventWorkspace(other), mru(std::make_unique<EventWorkspaceMRU>()),
+      m_storageLayout(other.m_storageLayout) {
   for (const auto &el : other.data) {
     // Create a new event list, copying over the events
     auto newel = std::make_unique<EventList>(*el);
@@ -101,6 +103,7 @@ void EventWorkspace::init(const std::size_t &NVectors,
   // Make sure SOMETHING exists for all initialized spots.
   EventList el;
   el.setHistogram(edges);
+  el.setStorageLayout(m_storageLayout);
   for (size_t i = 0; i < NVectors; i++) {
     data[i] = std::make_unique<EventList>(el);
     data[i]->setMRU(mru.get());
@@ -125,6 +128,7 @@ void EventWorkspace::init(const HistogramData::Histogram &histogram) {
   data.resize(numberOfDetectorGroups());
   EventList el;
   el.setHistogram(histogram);
+  el.setStorageLayout(m_storageLayout);
   for (size_t i = 0; i < data.size(); i++) {
     data[i] = std::make_unique<EventList>(el);
     data[i]->setMRU(mru.get());
@@ -449,6 +453,74 @@ void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
     eventList->switchTo(type);
 }
 
+/** Change how the events of all event lists are held in memory. Event lists
+ * created later by init() use the same layout. For COMPACT, all event lists
+ * share one table of the pulse times found in the workspace.
+ *
+ * @param layout :: ARRAY_OF_STRUCTS (the default), STRUCT_OF_ARRAYS or COMPACT
+ */
+void EventWorkspace::setStorageLayout(const EventStorageLayout layout) {
+  std::shared_ptr<const CompactEvents::PulseTable> pulseTimes;
+  if (layout == EventStorageLayout::COMPACT)
+    pulseTimes = makePulseTable();
+  setStorageLayout(layout, std::move(pulseTimes));
+}
+
+/** Change how the events of all event lists are held in memory, with a
+ * pulse time table that is already known, e.g. from the file the events were
+ * read from. This saves scanning all events for their pulse times. Lists with
+ * a pulse time missing from the table keep their current layout.
+ *
+ * @param layout :: ARRAY_OF_STRUCTS (the default), STRUCT_OF_ARRAYS or COMPACT
+ * @param pulseTimes :: sorted, unique pulse times made by
+ * CompactEvents::makePulseTable. Only used for COMPACT.
+ */
+void EventWorkspace::setStorageLayout(
+    const EventStorageLayout layout,
+    std::shared_ptr<const CompactEvents::PulseTable> pulseTimes) {
+  m_storageLayout = layout;
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int wksp_index = 0; wksp_index < static_cast<int>(data.size());
+       wksp_index++) {
+    data[wksp_index]->setStorageLayout(layout, pulseTimes);
+  }
+}
+
+/// @returns the sorted, unique pulse times of all TofEvent's in the workspace
+std::shared_ptr<const CompactEvents::PulseTable>
+EventWorkspace::makePulseTable() const {
+  // Events of a list mostly share few pulses, so reduce each list first
+  std::vector<std::vector<int64_t>> listTimes(data.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int wksp_index = 0; wksp_index < static_cast<int>(data.size());
+       wksp_index++) {
+    const auto &el = *data[wksp_index];
+    if (el.getEventType() != API::TOF)
+      continue;
+    auto &times = listTimes[wksp_index];
+    int64_t previous = std::numeric_limits<int64_t>::min();
+    for (const auto &event : el.getEvents()) {
+      const int64_t time = event.pulseTime().totalNanoseconds();
+      if (time != previous)
+        times.emplace_back(time);
+      previous = time;
+    }
+    std::sort(times.begin(), times.end());
+    times.erase(std::unique(times.begin(), times.end()), times.end());
+  }
+  std::vector<int64_t> allTimes;
+  for (auto &times : listTimes) {
+    allTimes.insert(allTimes.end(), times.cbegin(), times.cend());
+    std::vector<int64_t>().swap(times);
+  }
+  return CompactEvents::makePulseTable(std::move(allTimes));
+}
+
+/// @returns the memory layout used for the events of all event lists
+EventStorageLayout EventWorkspace::getStorageLayout() const {
+  return m_storageLayout;
+}
+
 /// Returns true always - an EventWorkspace always represents histogramm-able
 /// data
 /// @returns If the data is a histogram - always true for an eventWorkspace
@@ -628,13 +700,13 @@ class EventSortingTask {
 public:
   /// ctor
   EventSortingTask(const EventWorkspace *WS, EventSortType sortType,
-                   Mantid::API::Progress *prog)
-      : m_sortType(sortType), m_WS(WS), prog(prog) {}
+                   EventSortAlgorithm algorithm, Mantid::API::Progress *prog)
+      : m_sortType(sortType), m_algorithm(algorithm), m_WS(WS), prog(prog) {}
 
   // Execute the sort as specified.
   void operator()(const tbb::blocked_range<size_t> &range) const {
     for (size_t wi = range.begin(); wi < range.end(); ++wi) {
-      m_WS->getSpectrum(wi).sort(m_sortType);
+      m_WS->getSpectrum(wi).sort(m_sortType, m_algorithm);
     }
     // Report progress
     if (prog)
@@ -644,6 +716,8 @@ public:
 private:
   /// How to sort
   EventSortType m_sortType;
+  /// Which sorting algorithm to use
+  EventSortAlgorithm m_algorithm;
   /// EventWorkspace on which to sort
   const EventWorkspace *m_WS;
   /// Optional Progress dialog.
@@ -668,9 +742,11 @@ EventSortType EventWorkspace::getSortType() const {
  * @param sortType :: How to sort the event lists.
  * @param prog :: a progress report object. If the pointer is not NULL, each
  * event list will call prog.report() once.
+ * @param algorithm :: Sorting algorithm used within each event list.
  */
 void EventWorkspace::sortAll(EventSortType sortType,
-                             Mantid::API::Progress *prog) const {
+                             Mantid::API::Progress *prog,
+                             EventSortAlgorithm algorithm) const {
   if (this->getSortType() == sortType) {
     if (prog != nullptr) {
       prog->reportIncrement(this->data.size());
@@ -679,7 +755,7 @@ void EventWorkspace::sortAll(EventSortType sortType,
   }
 
   // Create the thread pool, and optimize by doing the longest sorts first.
-  EventSortingTask task(this, sortType, prog);
+  EventSortingTask task(this, sortType, algorithm, prog);
   tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()), task);
 }
 
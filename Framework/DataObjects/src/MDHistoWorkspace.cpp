@@ -13,12 +13,14 @@
 #include "MantidGeometry/MDGeometry/MDDimensionExtents.h"
 #include "MantidGeometry/MDGeometry/MDGeometryXMLBuilder.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/VMD.h"
 #include "MantidKernel/WarningSuppressions.h"
 
 #include <boost/optional.hpp>
 #include <boost/scoped_array.hpp>
+#include <algorithm>
 #include <cmath>
 #include <map>
 #include <memory>
@@ -27,6 +29,45 @@ using namespace Mantid::Kernel;
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
 
+namespace {
+/// Number of bins in a brick of the arrays, one page of signal values. Bricks
+/// holding nothing are not written to, so their memory is never committed.
+constexpr size_t BRICK_SIZE = 4096 / sizeof(Mantid::signal_t);
+
+/// @return true if all the bits of the n values are zero
+template <typename T> bool isZeroBrick(const T *data, size_t n) {
+  const auto bytes = reinterpret_cast<const char *>(data);
+  return std::all_of(bytes, bytes + n * sizeof(T),
+                     [](const char byte) { return byte == 0; });
+}
+
+/// Set all the values to value, skipping the bricks holding it already
+template <typename T> void fillBricks(T *data, size_t length, const T value) {
+  for (size_t start = 0; start < length; start += BRICK_SIZE) {
+    const size_t n = std::min(BRICK_SIZE, length - start);
+    T *brick = data + start;
+    if (!std::all_of(brick, brick + n, [value](T v) { return v == value; }))
+      std::fill_n(brick, n, value);
+  }
+}
+
+/// Copy length values to a zeroed array, skipping the bricks holding zeros
+template <typename T> void copyBricks(const T *from, T *to, size_t length) {
+  for (size_t start = 0; start < length; start += BRICK_SIZE) {
+    const size_t n = std::min(BRICK_SIZE, length - start);
+    if (!isZeroBrick(from + start, n))
+      std::copy_n(from + start, n, to + start);
+  }
+}
+
+/// @return true if new workspaces start zeroed, not written to, instead of NaN
+bool useSparseStorage() {
+  return Mantid::Kernel::ConfigService::Instance()
+      .getValue<bool>("MDHistoWorkspace.SparseStorage")
+      .get_value_or(false);
+}
+} // namespace
+
 namespace Mantid {
 namespace DataObjects {
 //----------------------------------------------------------------------------------------------
@@ -101,16 +142,16 @@ MDHistoWorkspace::MDHistoWorkspace(const MDHistoWorkspace &other)
       m_displayNormalization(other.m_displayNormalization) {
   // Dimensions are copied by the copy constructor of MDGeometry
   this->cacheValues();
-  // Allocate the linear arrays
-  m_signals = std::vector<signal_t>(m_length);
-  m_errorsSquared = std::vector<signal_t>(m_length);
-  m_numEvents = std::vector<signal_t>(m_length);
-  m_masks = std::make_unique<bool[]>(m_length);
-  // Now copy all the data
-  std::copy_n(other.m_signals.begin(), m_length, m_signals.begin());
-  std::copy_n(other.m_errorsSquared.begin(), m_length, m_errorsSquared.begin());
-  std::copy_n(other.m_numEvents.begin(), m_length, m_numEvents.begin());
-  std::copy_n(other.m_masks.get(), m_length, m_masks.get());
+  // Allocate the linear arrays, zeroed
+  m_signals = BinArray(m_length);
+  m_errorsSquared = BinArray(m_length);
+  m_numEvents = BinArray(m_length);
+  m_masks.reset(Kernel::ZeroedAllocator<bool>().allocate(m_length));
+  // Now copy all the data that is not zero
+  copyBricks(other.m_signals.data(), m_signals.data(), m_length);
+  copyBricks(other.m_errorsSquared.data(), m_errorsSquared.data(), m_length);
+  copyBricks(other.m_numEvents.data(), m_numEvents.data(), m_length);
+  copyBricks(other.m_masks.get(), m_masks.get(), m_length);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -138,14 +179,16 @@ void MDHistoWorkspace::init(
   MDGeometry::initGeometry(dimensions);
   this->cacheValues();
 
-  // Allocate the linear arrays
-  m_signals = std::vector<signal_t>(m_length);
-  m_errorsSquared = std::vector<signal_t>(m_length);
-  m_numEvents = std::vector<signal_t>(m_length);
-  m_masks = std::make_unique<bool[]>(m_length);
-  // Initialize them to NAN (quickly)
-  signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
-  this->setTo(nan, nan, nan);
+  // Allocate the linear arrays, zeroed
+  m_signals = BinArray(m_length);
+  m_errorsSquared = BinArray(m_length);
+  m_numEvents = BinArray(m_length);
+  m_masks.reset(Kernel::ZeroedAllocator<bool>().allocate(m_length));
+  // Initialize them to NAN (quickly), unless they are to be left empty
+  if (!useSparseStorage()) {
+    signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
+    this->setTo(nan, nan, nan);
+  }
   m_nEventsContributed = 0;
 }
 
@@ -240,6 +283,7 @@ void MDHistoWorkspace::initVertexesArray() {
 
 //----------------------------------------------------------------------------------------------
 /** Sets all signals/errors in the workspace to the given values
+ * Bricks of bins holding the values already are not written to.
  *
  * @param signal :: signal value to set
  * @param errorSquared :: error (squared) value to set
@@ -247,10 +291,10 @@ void MDHistoWorkspace::initVertexesArray() {
  */
 void MDHistoWorkspace::setTo(signal_t signal, signal_t errorSquared,
                              signal_t numEvents) {
-  std::fill_n(m_signals.begin(), m_length, signal);
-  std::fill_n(m_errorsSquared.begin(), m_length, errorSquared);
-  std::fill_n(m_numEvents.begin(), m_length, numEvents);
-  std::fill_n(m_masks.get(), m_length, false);
+  fillBricks(m_signals.data(), m_length, signal);
+  fillBricks(m_errorsSquared.data(), m_length, errorSquared);
+  fillBricks(m_numEvents.data(), m_length, numEvents);
+  fillBricks(m_masks.get(), m_length, false);
   m_nEventsContributed = static_cast<uint64_t>(numEvents) * m_length;
 }
 
@@ -760,15 +804,23 @@ MDHistoWorkspace &MDHistoWorkspace::operator+=(const MDHistoWorkspace &b) {
 
 //----------------------------------------------------------------------------------------------
 /** Perform the += operation, element-by-element, for two MDHistoWorkspace's
+ * Bricks of bins that are empty in b are left alone.
  *
  * @param b :: workspace on the RHS of the operation
  * */
 void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "add");
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] += b.m_signals[i];
-    m_errorsSquared[i] += b.m_errorsSquared[i];
-    m_numEvents[i] += b.m_numEvents[i];
+  for (size_t start = 0; start < m_length; start += BRICK_SIZE) {
+    const size_t end = std::min(start + BRICK_SIZE, m_length);
+    if (isZeroBrick(&b.m_signals[start], end - start) &&
+        isZeroBrick(&b.m_errorsSquared[start], end - start) &&
+        isZeroBrick(&b.m_numEvents[start], end - start))
+      continue;
+    for (size_t i = start; i < end; ++i) {
+      m_signals[i] += b.m_signals[i];
+      m_errorsSquared[i] += b.m_errorsSquared[i];
+      m_numEvents[i] += b.m_numEvents[i];
+    }
   }
   m_nEventsContributed += b.m_nEventsContributed;
 }
@@ -799,15 +851,23 @@ MDHistoWorkspace &MDHistoWorkspace::operator-=(const MDHistoWorkspace &b) {
 
 //----------------------------------------------------------------------------------------------
 /** Perform the -= operation, element-by-element, for two MDHistoWorkspace's
+ * Bricks of bins that are empty in b are left alone.
  *
  * @param b :: workspace on the RHS of the operation
  * */
 void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "subtract");
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] -= b.m_signals[i];
-    m_errorsSquared[i] += b.m_errorsSquared[i];
-    m_numEvents[i] += b.m_numEvents[i];
+  for (size_t start = 0; start < m_length; start += BRICK_SIZE) {
+    const size_t end = std::min(start + BRICK_SIZE, m_length);
+    if (isZeroBrick(&b.m_signals[start], end - start) &&
+        isZeroBrick(&b.m_errorsSquared[start], end - start) &&
+        isZeroBrick(&b.m_numEvents[start], end - start))
+      continue;
+    for (size_t i = start; i < end; ++i) {
+      m_signals[i] -= b.m_signals[i];
+      m_errorsSquared[i] += b.m_errorsSquared[i];
+      m_numEvents[i] += b.m_numEvents[i];
+    }
   }
   m_nEventsContributed += b.m_nEventsContributed;
 }
@@ -0,0 +1,169 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidAPI/FileFinder.h"
+#include "MantidDataObjects/BoxControllerMappedIO.h"
+#include "MantidDataObjects/BoxControllerNeXusIO.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <memory>
+
+#include <cxxtest/TestSuite.h>
+
+#include <Poco/File.h>
+
+using Mantid::DataObjects::BoxControllerMappedIO;
+
+class BoxControllerMappedIOTest : public CxxTest::TestSuite {
+public:
+  static BoxControllerMappedIOTest *createSuite() {
+    return new BoxControllerMappedIOTest();
+  }
+  static void destroySuite(BoxControllerMappedIOTest *suite) { delete suite; }
+
+  Mantid::API::BoxController_sptr sc;
+  std::string fileName;
+
+  BoxControllerMappedIOTest() {
+    sc = std::make_shared<Mantid::API::BoxController>(4);
+    fileName = "BoxControllerMappedIOTestFile.nxs";
+  }
+
+  void setUp() override { removeFiles(); }
+  void tearDown() override { removeFiles(); }
+
+  void test_data_type() {
+    BoxControllerMappedIO io(sc.get());
+    size_t coordSize;
+    std::string typeName;
+    io.getDataType(coordSize, typeName);
+    TS_ASSERT_EQUALS(4, coordSize);
+    TS_ASSERT_EQUALS("MDEvent", typeName);
+    TS_ASSERT_EQUALS(io.getNDataColums(), 8);
+
+    TS_ASSERT_THROWS(io.setDataType(9, typeName),
+                     const std::invalid_argument &);
+    TS_ASSERT_THROWS(io.setDataType(4, "UnknownEvent"),
+                     const std::invalid_argument &);
+    io.setDataType(8, "MDLeanEvent");
+    TS_ASSERT_EQUALS(io.getNDataColums(), 6);
+  }
+
+  void test_open_creates_event_file_next_to_nexus_file() {
+    BoxControllerMappedIO io(sc.get());
+    TSM_ASSERT_THROWS("new file does not open in read mode",
+                      io.openFile(fileName, "r"),
+                      const Mantid::Kernel::Exception::FileError &);
+
+    TS_ASSERT(io.openFile(fileName, "w"));
+    TS_ASSERT(io.isOpened());
+    TS_ASSERT(!io.openFile(fileName, "w"));
+    TS_ASSERT_EQUALS(io.getEventFileName(), io.getFileName() + ".events");
+    io.closeFile();
+    TS_ASSERT(!io.isOpened());
+
+    TS_ASSERT(BoxControllerMappedIO::hasEventFile(io.getFileName(), 4,
+                                                  "MDEvent"));
+    TS_ASSERT(Poco::File(io.getEventFileName()).exists());
+
+    // The events are not in the NeXus file, so it can not be read as usual
+    Mantid::DataObjects::BoxControllerNeXusIO nexusIO(sc.get());
+    TS_ASSERT_THROWS_ANYTHING(nexusIO.openFile(io.getFileName(), "r"));
+  }
+
+  void test_write_and_read_back() {
+    BoxControllerMappedIO io(sc.get());
+    io.openFile(fileName, "w");
+    const size_t nColumns = io.getNDataColums();
+    // The event file grows to make room for the block
+    const size_t nEvents = 50000;
+    std::vector<float> block(nEvents * nColumns);
+    for (size_t i = 0; i < block.size(); i++)
+      block[i] = static_cast<float>(i);
+    io.saveBlock(block, 100);
+    TS_ASSERT_EQUALS(io.getFileLength(), 100 + nEvents);
+
+    // Read back while the file is open for writing
+    std::vector<float> read;
+    io.loadBlock(read, 100 + 10, 2);
+    TS_ASSERT_EQUALS(read.size(), 2 * nColumns);
+    TS_ASSERT_EQUALS(read[0], static_cast<float>(10 * nColumns));
+    TS_ASSERT_THROWS(io.loadBlock(read, 100 + nEvents, 1),
+                     const Mantid::Kernel::Exception::FileError &);
+    io.closeFile();
+    TS_ASSERT_EQUALS(Poco::File(io.getEventFileName()).getSize(),
+                     64 + (100 + nEvents) * nColumns * sizeof(float));
+
+    // Read the file from many threads at once, converting to double
+    io.setDataType(8, "MDEvent");
+    io.openFile(fileName, "r");
+    TS_ASSERT_EQUALS(io.getFileLength(), 100 + nEvents);
+    TS_ASSERT_THROWS(io.saveBlock(block, 0),
+                     const Mantid::Kernel::Exception::FileError &);
+    int errors = 0;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < static_cast<int>(nEvents); i += 100) {
+      std::vector<double> events;
+      io.loadBlock(events, 100 + i, 100);
+      for (size_t j = 0; j < events.size(); j++) {
+        if (events[j] != static_cast<double>(block[i * nColumns + j])) {
+          PARALLEL_ATOMIC
+          errors++;
+        }
+      }
+    }
+    TS_ASSERT_EQUALS(errors, 0);
+    io.closeFile();
+  }
+
+  void test_events_are_kept_when_the_event_file_grows_many_times() {
+    BoxControllerMappedIO io(sc.get());
+    io.openFile(fileName, "w");
+    const size_t nColumns = io.getNDataColums();
+    const size_t nEvents = 20000;
+    std::vector<float> block(nEvents * nColumns);
+    for (size_t pass = 0; pass < 5; pass++) {
+      std::fill(block.begin(), block.end(), static_cast<float>(pass));
+      io.saveBlock(block, pass * nEvents);
+    }
+    TS_ASSERT_EQUALS(io.getFileLength(), 5 * nEvents);
+
+    std::vector<float> read;
+    for (size_t pass = 0; pass < 5; pass++) {
+      io.loadBlock(read, pass * nEvents + nEvents - 1, 1);
+      TS_ASSERT_EQUALS(read[0], static_cast<float>(pass));
+    }
+    io.closeFile();
+  }
+
+  void test_free_space_index_is_written_out_and_read_in() {
+    BoxControllerMappedIO io(sc.get());
+    io.openFile(fileName, "w");
+    std::vector<uint64_t> freeSpace{10, 2, 30, 4};
+    io.setFreeSpaceVector(freeSpace);
+    io.closeFile();
+
+    BoxControllerMappedIO reader(sc.get());
+    reader.openFile(fileName, "w");
+    std::vector<uint64_t> readFreeSpace;
+    reader.getFreeSpaceVector(readFreeSpace);
+    TS_ASSERT_EQUALS(freeSpace, readFreeSpace);
+    reader.closeFile();
+  }
+
+private:
+  void removeFiles() {
+    const std::string fullPath =
+        Mantid::API::FileFinder::Instance().getFullPath(fileName);
+    if (fullPath.empty())
+      return;
+    Poco::File(fullPath).remove();
+    if (Poco::File(fullPath + ".events").exists())
+      Poco::File(fullPath + ".events").remove();
+  }
+};
@@ -185,12 +185,14 @@ public:
     }
   };
 
-  template <typename FROM, typename TO> void WriteReadRead() {
+  template <typename FROM, typename TO>
+  void WriteReadRead(const bool compressed = false) {
     using Mantid::DataObjects::BoxControllerNeXusIO;
 
     BoxControllerNeXusIO *pSaver(nullptr);
     TS_ASSERT_THROWS_NOTHING(pSaver = createTestBoxController());
     pSaver->setDataType(sizeof(FROM), "MDEvent");
+    pSaver->setCompressed(compressed);
     std::string FullPathFile;
 
     TS_ASSERT_THROWS_NOTHING(pSaver->openFile(this->xxfFileName, "w"));
@@ -233,6 +235,14 @@ public:
 
   void test_WriteFloatReadDouble() { this->WriteReadRead<float, double>(); }
 
+  void test_WriteCompressedFloatReadFloat() {
+    this->WriteReadRead<float, float>(true);
+  }
+
+  void test_WriteCompressedDoubleReadFloat() {
+    this->WriteReadRead<double, float>(true);
+  }
+
 private:
   /// Create a test box controller. Ownership is passed to the caller
   Mantid::DataObjects::BoxControllerNeXusIO *createTestBoxController() {
@@ -0,0 +1,75 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/CompactEvents.h"
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::DataObjects;
+using Mantid::MantidVec;
+using Mantid::Types::Event::TofEvent;
+
+class CompactEventsTest : public CxxTest::TestSuite {
+public:
+  void test_makePulseTable() {
+    const auto table = CompactEvents::makePulseTable({300, 100, 200, 100, 300});
+    TS_ASSERT_EQUALS(*table, std::vector<int64_t>({100, 200, 300}));
+  }
+
+  void test_pack_unpack_is_lossless() {
+    std::vector<TofEvent> events{TofEvent(3.5, 200), TofEvent(1.25, 100),
+                                 TofEvent(2.0, 200)};
+    const auto original = events;
+    CompactEvents compact;
+    TS_ASSERT(compact.pack(events, nullptr));
+    TS_ASSERT(events.empty());
+    TS_ASSERT_EQUALS(compact.size(), 3);
+    TS_ASSERT_EQUALS(compact.events()[0].m_pulseIndex, 1);
+    TS_ASSERT_EQUALS(compact.events()[1].m_pulseIndex, 0);
+    TS_ASSERT_EQUALS(compact.getMemorySize(), 3 * sizeof(CompactEvent));
+
+    compact.unpack(events);
+    TS_ASSERT(compact.empty());
+    TS_ASSERT_EQUALS(events, original);
+  }
+
+  void test_pack_refuses_lossy_events() {
+    // 0.1 is not exactly representable as a float
+    std::vector<TofEvent> events{TofEvent(1.0, 100), TofEvent(0.1, 100)};
+    CompactEvents compact;
+    TS_ASSERT(!compact.pack(events, nullptr));
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT(compact.empty());
+
+    // Pulse time missing from the table
+    events = {TofEvent(1.0, 100), TofEvent(2.0, 150)};
+    TS_ASSERT(!compact.pack(events, CompactEvents::makePulseTable({100, 200})));
+    TS_ASSERT_EQUALS(events.size(), 2);
+  }
+
+  void test_sortTof_histogram_and_integrate() {
+    std::vector<TofEvent> events{TofEvent(3.5, 100), TofEvent(0.5, 100),
+                                 TofEvent(1.5, 200), TofEvent(1.75, 100)};
+    CompactEvents compact;
+    TS_ASSERT(compact.pack(events, nullptr));
+    compact.sortTof();
+    std::vector<double> tofs;
+    compact.getTofs(tofs);
+    TS_ASSERT_EQUALS(tofs, std::vector<double>({0.5, 1.5, 1.75, 3.5}));
+
+    MantidVec Y;
+    compact.generateCountsHistogram({0.0, 1.0, 2.0, 3.0}, Y);
+    TS_ASSERT_EQUALS(Y, MantidVec({1.0, 2.0, 0.0}));
+
+    double sum, error;
+    compact.integrate(1.0, 4.0, false, sum, error);
+    TS_ASSERT_EQUALS(sum, 3.0);
+    TS_ASSERT_DELTA(error, std::sqrt(3.0), 1e-12);
+    compact.integrate(0.0, 0.0, true, sum, error);
+    TS_ASSERT_EQUALS(sum, 4.0);
+  }
+};
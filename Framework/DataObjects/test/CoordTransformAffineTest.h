@@ -125,6 +125,32 @@ public:
                                ct.applyVMD(VMD(1.0, 2.0, 3.0)));
   }
 
+  void test_applyBatch_matches_apply() {
+    CoordTransformAffine ct(3, 2);
+    Matrix<coord_t> mat(3, 4);
+    mat[0][0] = 0.5;
+    mat[0][1] = -1.0;
+    mat[0][3] = 2.0;
+    mat[1][2] = 3.0;
+    mat[1][3] = -1.0;
+    mat[2][3] = 1.0;
+    ct.setMatrix(mat);
+    // Coordinates held one dimension after the other
+    const size_t nPoints = 5;
+    std::vector<coord_t> inputs(3 * nPoints);
+    for (size_t i = 0; i < inputs.size(); ++i)
+      inputs[i] = static_cast<coord_t>(i) * 0.25f - 1.0f;
+    std::vector<coord_t> outputs(2 * nPoints);
+    ct.applyBatch(inputs.data(), outputs.data(), nPoints);
+    for (size_t i = 0; i < nPoints; ++i) {
+      coord_t in[3] = {inputs[i], inputs[nPoints + i], inputs[2 * nPoints + i]};
+      coord_t out[2];
+      ct.apply(in, out);
+      TS_ASSERT_DELTA(outputs[i], out[0], 1e-5);
+      TS_ASSERT_DELTA(outputs[nPoints + i], out[1], 1e-5);
+    }
+  }
+
   /** Test rotation in isolation */
   void test_rotation() {
     using Mantid::Kernel::V3D;
@@ -423,4 +449,17 @@ public:
       ct.apply(in, out);
     }
   }
+
+  void test_applyBatch_4D_performance() {
+    CoordTransformAffine ct(4, 4);
+    coord_t translation[4] = {2.0, 3.0, 4.0, 5.0};
+    ct.addTranslation(translation);
+    const size_t nPoints = 1000;
+    std::vector<coord_t> in(4 * nPoints, 1.5);
+    std::vector<coord_t> out(4 * nPoints);
+
+    for (size_t i = 0; i < 1000 * 10; ++i) {
+      ct.applyBatch(in.data(), out.data(), nPoints);
+    }
+  }
 };
@@ -0,0 +1,111 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/EventColumns.h"
+#include <cmath>
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::DataObjects;
+using Mantid::MantidVec;
+using Mantid::Types::Event::TofEvent;
+
+class EventColumnsTest : public CxxTest::TestSuite {
+public:
+  void test_pack_unpack_TofEvent() {
+    std::vector<TofEvent> events{TofEvent(3.5, 100), TofEvent(1.5, 200)};
+    EventColumns columns;
+    columns.pack(events);
+    TS_ASSERT(events.empty());
+    TS_ASSERT_EQUALS(columns.size(), 2);
+    TS_ASSERT_EQUALS(columns.pulseTimes().size(), 2);
+    TS_ASSERT(columns.weights().empty());
+
+    columns.unpack(events);
+    TS_ASSERT(columns.empty());
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT_EQUALS(events[0], TofEvent(3.5, 100));
+    TS_ASSERT_EQUALS(events[1], TofEvent(1.5, 200));
+  }
+
+  void test_pack_unpack_WeightedEvent() {
+    std::vector<WeightedEvent> events{WeightedEvent(3.5, 100, 2.0, 4.0),
+                                      WeightedEvent(1.5, 200, 0.5, 0.25)};
+    EventColumns columns;
+    columns.pack(events);
+    TS_ASSERT_EQUALS(columns.weights(), std::vector<float>({2.0f, 0.5f}));
+    TS_ASSERT_EQUALS(columns.errorSquareds(),
+                     std::vector<float>({4.0f, 0.25f}));
+
+    columns.unpack(events);
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT_EQUALS(events[1], WeightedEvent(1.5, 200, 0.5, 0.25));
+  }
+
+  void test_pack_unpack_WeightedEventNoTime() {
+    std::vector<WeightedEventNoTime> events{WeightedEventNoTime(3.5, 2.0, 4.0)};
+    EventColumns columns;
+    columns.pack(events);
+    TS_ASSERT(columns.pulseTimes().empty());
+
+    columns.unpack(events);
+    TS_ASSERT_EQUALS(events.size(), 1);
+    TS_ASSERT_EQUALS(events[0], WeightedEventNoTime(3.5, 2.0, 4.0));
+  }
+
+  void test_sortTof_keeps_columns_aligned() {
+    EventColumns columns;
+    columns.push_back(WeightedEvent(3.0, 300, 3.0, 9.0));
+    columns.push_back(WeightedEvent(1.0, 100, 1.0, 1.0));
+    columns.push_back(WeightedEvent(2.0, 200, 2.0, 4.0));
+    columns.sortTof();
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({1.0, 2.0, 3.0}));
+    TS_ASSERT_EQUALS(columns.weights(), std::vector<float>({1.0f, 2.0f, 3.0f}));
+    TS_ASSERT_EQUALS(columns.errorSquareds(),
+                     std::vector<float>({1.0f, 4.0f, 9.0f}));
+    TS_ASSERT_EQUALS(columns.pulseTimes()[2],
+                     Mantid::Types::Core::DateAndTime(300).totalNanoseconds());
+  }
+
+  void test_histograms_and_integrate() {
+    EventColumns columns;
+    for (double tof : {0.5, 1.5, 1.7, 2.5, 5.0})
+      columns.push_back(WeightedEventNoTime(tof, 2.0, 4.0));
+    const MantidVec X{1.0, 2.0, 3.0};
+
+    MantidVec Y, E;
+    columns.generateCountsHistogram(X, Y);
+    TS_ASSERT_EQUALS(Y, MantidVec({2.0, 1.0}));
+    columns.generateWeightedHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(Y, MantidVec({4.0, 2.0}));
+    TS_ASSERT_DELTA(E[0], std::sqrt(8.0), 1e-12);
+    TS_ASSERT_DELTA(E[1], 2.0, 1e-12);
+
+    double sum, error;
+    columns.integrate(1.0, 3.0, false, sum, error);
+    TS_ASSERT_EQUALS(sum, 6.0);
+    TS_ASSERT_DELTA(error, std::sqrt(12.0), 1e-12);
+    columns.integrate(0.0, 0.0, true, sum, error);
+    TS_ASSERT_EQUALS(sum, 10.0);
+  }
+
+  void test_convertTof_and_weights() {
+    EventColumns columns;
+    columns.push_back(TofEvent(1.0, 10));
+    columns.push_back(TofEvent(2.0, 20));
+    columns.convertTof(2.0, 1.0);
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({3.0, 5.0}));
+    columns.convertTof([](double tof) { return -tof; });
+    TS_ASSERT_EQUALS(columns.tofs(), std::vector<double>({-3.0, -5.0}));
+
+    columns.addUnitWeights();
+    TS_ASSERT_EQUALS(columns.weights(), std::vector<float>(2, 1.0f));
+    columns.dropPulseTimes();
+    TS_ASSERT(columns.pulseTimes().empty());
+    TS_ASSERT_EQUALS(columns.size(), 2);
+  }
+};
@@ -0,0 +1,67 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/EventHistogramKernel.h"
+#include "MantidDataObjects/Events.h"
+#include <cmath>
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::DataObjects;
+using Mantid::MantidVec;
+using Mantid::Types::Event::TofEvent;
+
+class EventHistogramKernelTest : public CxxTest::TestSuite {
+public:
+  void test_findEdges_matches_lower_bound() {
+    std::vector<double> tofs;
+    for (size_t i = 0; i < 1000; ++i)
+      tofs.emplace_back(std::sqrt(static_cast<double>(i)));
+    // Edges below, inside (including exact matches) and above the data
+    const MantidVec X{-1.0, 0.0, 0.5, 3.0, 3.0, 10.0, 20.0, 31.0, 50.0};
+
+    std::vector<size_t> positions;
+    EventHistogramKernel::findEdges(tofs.data(), tofs.size(), X, positions);
+    TS_ASSERT_EQUALS(positions.size(), X.size());
+    for (size_t i = 0; i < X.size(); ++i)
+      TSM_ASSERT_EQUALS(i, positions[i],
+                        std::lower_bound(tofs.begin(), tofs.end(), X[i]) -
+                            tofs.begin());
+  }
+
+  void test_findEdges_events_matches_contiguous() {
+    std::vector<TofEvent> events;
+    std::vector<double> tofs;
+    for (size_t i = 0; i < 500; ++i) {
+      events.emplace_back(0.1 * static_cast<double>(i / 3));
+      tofs.emplace_back(events.back().tof());
+    }
+    MantidVec X;
+    for (double x = 1.0; x < 60.0; x *= 1.1)
+      X.emplace_back(x);
+
+    std::vector<size_t> fromEvents, fromTofs;
+    EventHistogramKernel::findEdges(events, X, fromEvents);
+    EventHistogramKernel::findEdges(tofs.data(), tofs.size(), X, fromTofs);
+    TS_ASSERT_EQUALS(fromEvents, fromTofs);
+  }
+
+  void test_countsFromEdges() {
+    MantidVec Y;
+    EventHistogramKernel::countsFromEdges({2, 2, 5, 9}, Y);
+    TS_ASSERT_EQUALS(Y, MantidVec({0.0, 3.0, 4.0}));
+  }
+
+  void test_sum() {
+    std::vector<float> values(37);
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = static_cast<float>(i);
+    TS_ASSERT_EQUALS(EventHistogramKernel::sum(values.data(), 0, 0), 0.0);
+    TS_ASSERT_EQUALS(EventHistogramKernel::sum(values.data(), 3, 4), 3.0);
+    TS_ASSERT_EQUALS(EventHistogramKernel::sum(values.data(), 1, 37), 666.0);
+  }
+};
@@ -963,6 +963,21 @@ public:
     }
   }
 
+  void test_histogram_by_pulse_time_when_tof_order_differs() {
+    // Pulse times 0, 10, ..., 90 ns with decreasing times-of-flight
+    EventList eList;
+    for (int i = 0; i < 10; i++)
+      eList += TofEvent(100.0 - i, DateAndTime(int64_t(10 * i)));
+    eList.sortTof();
+
+    const MantidVec X{0., 25., 50., 100.};
+    MantidVec Y, E;
+    eList.generateHistogramPulseTime(X, Y, E);
+    const MantidVec expected{3., 2., 5.};
+    TS_ASSERT_EQUALS(Y, expected);
+    TS_ASSERT_DELTA(E[0], std::sqrt(3.), 1e-12);
+  }
+
   void test_histogram_weighed_event_by_pulse_time_throws() {
     EventList eList = this->fake_uniform_pulse_data(WEIGHTED);
 
@@ -1294,6 +1309,115 @@ public:
     TS_ASSERT_EQUALS(el.integrate(1000, 100, false), 0);
   }
 
+  //-----------------------------------------------------------------------------------------------
+  void test_storageLayout_histogram_matches_allTypes() {
+    MantidVec X = makeX(BIN_DELTA * 3.3, NUMBINS);
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      EventList columns(el);
+      columns.setStorageLayout(STRUCT_OF_ARRAYS);
+      TS_ASSERT_EQUALS(columns.getStorageLayout(), STRUCT_OF_ARRAYS);
+      TS_ASSERT_EQUALS(columns.getNumberEvents(), el.getNumberEvents());
+
+      MantidVec Y1, E1, Y2, E2;
+      el.generateHistogram(X, Y1, E1);
+      columns.generateHistogram(X, Y2, E2);
+      TSM_ASSERT_EQUALS(this_type, Y1, Y2);
+      TSM_ASSERT_EQUALS(this_type, E1, E2);
+      TSM_ASSERT_EQUALS(this_type, columns.integrate(0, MAX_TOF, false),
+                        el.integrate(0, MAX_TOF, false));
+      TSM_ASSERT_EQUALS(this_type, columns.getTofMin(), el.getTofMin());
+      TSM_ASSERT_EQUALS(this_type, columns.getTofMax(), el.getTofMax());
+    }
+  }
+
+  void test_storageLayout_event_accessors_unpack_columns() {
+    this->fake_uniform_data_weights();
+    const std::vector<WeightedEvent> original = el.getWeightedEvents();
+    el.setStorageLayout(STRUCT_OF_ARRAYS);
+    el.convertTof(2.0, 1.0);
+    TS_ASSERT_EQUALS(el.getEventColumns().tofs().size(), original.size());
+
+    // Accessing whole events moves them back into the vector
+    const auto &events = el.getWeightedEvents();
+    TS_ASSERT_EQUALS(events.size(), original.size());
+    for (size_t i = 0; i < events.size(); i++) {
+      TS_ASSERT_EQUALS(events[i].tof(), original[i].tof() * 2.0 + 1.0);
+      TS_ASSERT_EQUALS(events[i].pulseTime(), original[i].pulseTime());
+      TS_ASSERT_EQUALS(events[i].weight(), original[i].weight());
+      TS_ASSERT_EQUALS(events[i].errorSquared(), original[i].errorSquared());
+    }
+    TS_ASSERT_EQUALS(el.getStorageLayout(), STRUCT_OF_ARRAYS);
+
+    el.setStorageLayout(ARRAY_OF_STRUCTS);
+    TS_ASSERT_THROWS(el.getEventColumns(), const std::runtime_error &);
+  }
+
+  void test_storageLayout_const_calls_keep_event_references() {
+    this->fake_data();
+    el.setStorageLayout(STRUCT_OF_ARRAYS);
+    const EventList &constList = el;
+    const auto &events = constList.getEvents();
+    const size_t numEvents = events.size();
+
+    // Histogramming and integrating must not move the events back into the
+    // columns behind the reference
+    MantidVec X = makeX(BIN_DELTA, NUMBINS), Y, E;
+    constList.generateHistogram(X, Y, E);
+    constList.integrate(0, MAX_TOF, false);
+    TS_ASSERT_EQUALS(events.size(), numEvents);
+    TS_ASSERT_EQUALS(&events, &constList.getEvents());
+
+    // The next time-of-flight conversion moves them into the columns again
+    el.convertTof(1.0, 0.0);
+    TS_ASSERT_EQUALS(el.getEventColumns().tofs().size(), numEvents);
+  }
+
+  void test_storageLayout_switchTo_and_addEventQuickly() {
+    EventList list;
+    list.setStorageLayout(STRUCT_OF_ARRAYS);
+    list.addEventQuickly(TofEvent(5.0, 100));
+    list.addEventQuickly(TofEvent(1.0, 200));
+    TS_ASSERT_EQUALS(list.getNumberEvents(), 2);
+    list.switchTo(WEIGHTED);
+    TS_ASSERT_EQUALS(list.getWeights(), std::vector<double>(2, 1.0));
+    list.switchTo(WEIGHTED_NOTIME);
+    list.sortTof();
+    TS_ASSERT_EQUALS(list.getTofs(), std::vector<double>({1.0, 5.0}));
+    TS_ASSERT_EQUALS(list.getWeightedEventsNoTime()[1].tof(), 5.0);
+    TS_ASSERT_EQUALS(list.getWeightedEventsNoTime()[1].weight(), 1.0);
+  }
+
+  void test_storageLayout_compact() {
+    EventList list;
+    for (int i = 0; i < 100; i++)
+      list.addEventQuickly(TofEvent(static_cast<double>(100 - i), i / 10));
+    const std::vector<TofEvent> original = list.getEvents();
+    MantidVec X{0.0, 25.0, 50.0, 200.0}, Y1, E1, Y2, E2;
+    list.generateHistogram(X, Y1, E1);
+    const size_t memory = list.getMemorySize();
+
+    list.setStorageLayout(COMPACT);
+    TS_ASSERT_EQUALS(list.getStorageLayout(), COMPACT);
+    TS_ASSERT_EQUALS(list.getNumberEvents(), 100);
+    TS_ASSERT_LESS_THAN(list.getMemorySize(), memory);
+    list.generateHistogram(X, Y2, E2);
+    TS_ASSERT_EQUALS(Y1, Y2);
+    TS_ASSERT_EQUALS(E1, E2);
+    TS_ASSERT_EQUALS(list.integrate(10.0, 20.0, false), 11.0);
+    TS_ASSERT_EQUALS(list.getTofMin(), 1.0);
+    TS_ASSERT_EQUALS(list.getTofMax(), 100.0);
+
+    // Accessing whole events unpacks them without loss
+    list.setStorageLayout(ARRAY_OF_STRUCTS);
+    auto events = list.getEvents();
+    std::vector<TofEvent> expected(original);
+    std::sort(expected.begin(), expected.end());
+    std::sort(events.begin(), events.end());
+    TS_ASSERT_EQUALS(events, expected);
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_maskTof_allTypes() {
     // Go through each possible EventType as the input
@@ -1681,6 +1805,40 @@ public:
     }
   }
 
+  void test_radix_sortTof_matches_comparison_sort() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      EventList comparison = this->fake_data();
+      // Include negative and repeated times-of-flight
+      comparison.convertTof(1.0, -5e6);
+      comparison.addEventQuickly(TofEvent(-1.0, 1));
+      comparison.addEventQuickly(TofEvent(-1.0, 2));
+      comparison.switchTo(static_cast<EventType>(this_type));
+      EventList radix(comparison);
+
+      comparison.sortTof();
+      radix.sortTof(RADIX_SORT);
+      TS_ASSERT(radix.isSortedByTof());
+      TSM_ASSERT_EQUALS(this_type, radix.getTofs(), comparison.getTofs());
+    }
+  }
+
+  void test_radix_sortPulseTimeTOF() {
+    for (int this_type = 0; this_type < 2; this_type++) {
+      EventList el = this->fake_data();
+      el.switchTo(static_cast<EventType>(this_type));
+
+      el.sort(PULSETIMETOF_SORT, RADIX_SORT);
+      TS_ASSERT_EQUALS(el.getSortType(), PULSETIMETOF_SORT);
+      for (size_t i = 1; i < el.getNumberEvents(); i++) {
+        TSM_ASSERT_LESS_THAN_EQUALS(this_type, el.getEvent(i - 1).pulseTime(),
+                                    el.getEvent(i).pulseTime());
+        if (el.getEvent(i - 1).pulseTime() == el.getEvent(i).pulseTime())
+          TSM_ASSERT_LESS_THAN_EQUALS(this_type, el.getEvent(i - 1).tof(),
+                                      el.getEvent(i).tof());
+      }
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_filterByPulseTime() {
     // Go through each possible EventType (except the no-time one) as the input
@@ -1928,10 +2086,10 @@ public:
     el.sortPulseTimeTOF();
 
     // Output will be 10 event lists
-    std::map<int, EventList *> outputs;
-    for (int i = 0; i < 10; i++)
-      outputs.emplace(i, new EventList());
-    outputs.emplace(-1, new EventList());
+    std::vector<EventList> lists(10);
+    std::vector<EventList *> outputs;
+    for (auto &list : lists)
+      outputs.emplace_back(&list);
 
     // Generate time splitters
     std::vector<int64_t> vec_splitTimes{1000000, 2000000, 3000000, 4000000,
@@ -1939,29 +2097,74 @@ public:
                                         9000000, 10000000};
     std::vector<int> vec_splitGroup{-1, 2, -1, 4, -1, 6, -1, 8, -1};
     // Do the splitting
-    el.splitByFullTimeMatrixSplitter(vec_splitTimes, vec_splitGroup, outputs,
-                                     false, 1.0, 0.0);
+    el.splitByFullTimeToTargets(vec_splitTimes, vec_splitGroup, outputs, false,
+                                1.0, 0.0);
 
     // No events in the first ouput 0-99
-    TS_ASSERT_EQUALS(outputs[0]->getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(lists[0].getNumberEvents(), 0);
 
     for (int i = 1; i < 10; i++) {
-      EventList *myOut = outputs[i];
       if ((i % 2) == 0) {
         // Even
-        TS_ASSERT_EQUALS(myOut->getNumberEvents(), 1);
+        TS_ASSERT_EQUALS(lists[i].getNumberEvents(), 1);
       } else {
         // Odd
-        TS_ASSERT_EQUALS(myOut->getNumberEvents(), 0);
+        TS_ASSERT_EQUALS(lists[i].getNumberEvents(), 0);
       }
     }
+  }
 
-    // Clean the pointers
-    for (auto &output : outputs) {
-      delete output.second;
-    }
+  void test_splitByFullTimeToTargets() {
+    // One event per pulse, every 1 ms, with full times inside the pulse
+    fake_uniform_time_sns_data();
+    el.switchTo(WEIGHTED);
 
-    return;
+    // Splitters of 100 pulses each, cycling through targets 0, 1, 2 and -1
+    std::vector<int64_t> splitterTimes;
+    std::vector<int> splitterTargets;
+    for (int i = 0; i <= 10; i++)
+      splitterTimes.emplace_back(static_cast<int64_t>(i) * 100000000);
+    for (int i = 0; i < 10; i++)
+      splitterTargets.emplace_back(i % 4 == 3 ? -1 : i % 4);
+
+    // Target 2 has no output
+    EventList output0, output1;
+    std::vector<EventList *> outputs{&output0, &output1, nullptr};
+    el.splitByFullTimeToTargets(splitterTimes, splitterTargets, outputs, false,
+                                1.0, 0.0);
+
+    TS_ASSERT_EQUALS(output0.getNumberEvents(), 300);
+    TS_ASSERT_EQUALS(output1.getNumberEvents(), 300);
+    TS_ASSERT_EQUALS(output0.getEventType(), WEIGHTED);
+    // The outputs keep the pulse time order of the input
+    TS_ASSERT_EQUALS(output1.getSortType(), PULSETIMETOF_SORT);
+    const auto &events = output1.getWeightedEvents();
+    for (size_t i = 1; i < events.size(); i++)
+      TS_ASSERT_LESS_THAN(events[i - 1].pulseTime(), events[i].pulseTime());
+    TS_ASSERT_EQUALS(events.front().pulseTime().totalNanoseconds(), 100000000);
+    TS_ASSERT_EQUALS(events.back().pulseTime().totalNanoseconds(), 999000000);
+  }
+
+  void test_splitByFullTimeToTargets_boundaries() {
+    // Events at 0, 1, 2 and 3 ms of a single pulse
+    el = EventList();
+    for (int i = 0; i < 4; i++)
+      el.addEventQuickly(TofEvent(1000. * i, DateAndTime(0)));
+
+    // [0, 1 ms) -> 0 and [1 ms, 3 ms) -> 1, so the event at 3 ms is dropped
+    EventList output0, output1;
+    std::vector<EventList *> outputs{&output0, &output1};
+    el.splitByFullTimeToTargets({0, 1000000, 3000000}, {0, 1}, outputs, false,
+                                1.0, 0.0);
+    TS_ASSERT_EQUALS(output0.getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(output1.getNumberEvents(), 2);
+    TS_ASSERT_EQUALS(output1.getEvent(0).tof(), 1000.);
+    TS_ASSERT_EQUALS(output1.getEvent(1).tof(), 2000.);
+
+    // Without splitters everything goes to target 0
+    el.splitByFullTimeToTargets({}, {}, outputs, false, 1.0, 0.0);
+    TS_ASSERT_EQUALS(output0.getNumberEvents(), 4);
+    TS_ASSERT_EQUALS(output1.getNumberEvents(), 0);
   }
 
   //-----------------------------------------------------------------------------------------------
@@ -2008,6 +2211,43 @@ public:
     }
   }
 
+  void test_splitByPulseTime_many_intervals() {
+    // Several events share each pulse time and they are added out of order
+    el = EventList();
+    for (int64_t i = 0; i < 5000; i++)
+      el += TofEvent(static_cast<double>(i), DateAndTime((i * 7919) % 1000));
+
+    // Intervals 3 ns long every 10 ns, cycling through 3 outputs
+    TimeSplitterType split;
+    for (int i = 0; i < 100; i++)
+      split.emplace_back(SplittingInterval(i * 10, i * 10 + 3, i % 3));
+    std::vector<EventList> lists(4);
+    std::map<int, EventList *> outputs;
+    for (int i = -1; i < 3; i++)
+      outputs[i] = &lists[i + 1];
+    el.splitByPulseTime(split, outputs);
+
+    // Events between the intervals are unfiltered, those after the last
+    // interval are dropped
+    const auto expectedOutput = [](const int64_t pulse) {
+      if (pulse >= 993)
+        return -2;
+      return pulse % 10 < 3 ? static_cast<int>(pulse / 10 % 3) : -1;
+    };
+    std::vector<size_t> expectedCounts(4, 0);
+    for (const auto &event : el.getEvents()) {
+      const int output = expectedOutput(event.pulseTime().totalNanoseconds());
+      if (output >= -1)
+        ++expectedCounts[output + 1];
+    }
+    for (int i = -1; i < 3; i++) {
+      TS_ASSERT_EQUALS(outputs[i]->getNumberEvents(), expectedCounts[i + 1]);
+      for (const auto &event : outputs[i]->getEvents())
+        TS_ASSERT_EQUALS(expectedOutput(event.pulseTime().totalNanoseconds()),
+                         i);
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_splitByTime_FilterWithOverlap() {
     this->fake_uniform_time_data();
@@ -2266,6 +2506,37 @@ public:
     TS_ASSERT_EQUALS(varyingOut, varyingOut2);
   }
 
+  void test_compressAppendedEvents() {
+    EventList notWeighted;
+    notWeighted.addEventQuickly(TofEvent(1.0));
+    TS_ASSERT_THROWS(notWeighted.compressAppendedEvents(0.5, 0),
+                     const std::runtime_error &);
+
+    EventList el;
+    el.switchTo(WEIGHTED_NOTIME);
+    auto &events = el.getWeightedEventsNoTime();
+    for (const double tof : {9.0, 5.0, 1.0, 5.0})
+      events.emplace_back(tof, 1.0, 1.0);
+    // Nothing compressed yet is the same as compressEvents
+    TS_ASSERT_THROWS_NOTHING(el.compressAppendedEvents(0.5, 0));
+    TS_ASSERT_EQUALS(events.size(), 3);
+    TS_ASSERT_EQUALS(events[1].tof(), 5.0);
+    TS_ASSERT_EQUALS(events[1].weight(), 2.0);
+
+    for (const double tof : {20.0, 9.2, 0.0, 5.0})
+      events.emplace_back(tof, 1.0, 1.0);
+    TS_ASSERT_THROWS_NOTHING(el.compressAppendedEvents(0.5, 3));
+    TS_ASSERT_EQUALS(el.getSortType(), TOF_SORT);
+    const std::vector<double> tofs{0.0, 1.0, 5.0, 9.1, 20.0};
+    const std::vector<double> weights{1.0, 1.0, 3.0, 2.0, 1.0};
+    TS_ASSERT_EQUALS(events.size(), tofs.size());
+    for (size_t i = 0; i < std::min(events.size(), tofs.size()); ++i) {
+      TS_ASSERT_DELTA(events[i].tof(), tofs[i], 1e-10);
+      TS_ASSERT_EQUALS(events[i].weight(), weights[i]);
+      TS_ASSERT_EQUALS(events[i].errorSquared(), weights[i]);
+    }
+  }
+
   void test_compressWeightedFatEvents() {
     this->fake_uniform_data_weights(WEIGHTED);
     EventList uniformOut;
@@ -2388,10 +2659,10 @@ public:
     el.sortPulseTimeTOF();
 
     // Output will be 10 event lists
-    std::map<int, EventList *> outputs;
-    for (int i = 0; i < 10; i++)
-      outputs.emplace(i, new EventList());
-    outputs.emplace(-1, new EventList());
+    std::vector<EventList> lists(10);
+    std::vector<EventList *> outputs;
+    for (auto &list : lists)
+      outputs.emplace_back(&list);
 
     // Generate time splitters
     std::vector<int64_t> vec_splitTimes(11);
@@ -2419,34 +2690,21 @@ public:
     vec_splitGroup[8] = 1;
 
     // Do the splitting
-    el.splitByFullTimeMatrixSplitter(vec_splitTimes, vec_splitGroup, outputs,
-                                     true, 0.0, 2.0E-4);
+    el.splitByFullTimeToTargets(vec_splitTimes, vec_splitGroup, outputs, true,
+                                0.0, 2.0E-4);
 
     // Examine result
-    TS_ASSERT_EQUALS(outputs.size(), 11);
-
     // group 2
-    EventList *e2 = outputs[2];
-    TS_ASSERT_EQUALS(e2->getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(lists[2].getNumberEvents(), 1);
 
     // group 5
-    EventList *e5 = outputs[5];
-    TS_ASSERT_EQUALS(e5->getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(lists[5].getNumberEvents(), 0);
 
     // group 4
-    EventList *e4 = outputs[4];
-    TS_ASSERT_EQUALS(e4->getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(lists[4].getNumberEvents(), 0);
 
     // group 7
-    EventList *e7 = outputs[7];
-    TS_ASSERT_EQUALS(e7->getNumberEvents(), 1);
-
-    // Clean the pointers
-    for (auto &output : outputs) {
-      delete output.second;
-    }
-
-    return;
+    TS_ASSERT_EQUALS(lists[7].getNumberEvents(), 1);
   }
 
   //-----------------------------------------------------------------------------------------------
@@ -2460,10 +2718,10 @@ public:
 
     el.sortPulseTimeTOF();
     // Output will be 10 event lists
-    std::map<int, EventList *> outputs;
-    for (int i = 0; i < 10; i++)
-      outputs.emplace(i, new EventList());
-    outputs.emplace(-1, new EventList());
+    std::vector<EventList> lists(10);
+    std::vector<EventList *> outputs;
+    for (auto &list : lists)
+      outputs.emplace_back(&list);
 
     // Generate time splitters
     std::vector<int64_t> vec_splitTimes(11);
@@ -2491,34 +2749,18 @@ public:
     vec_splitGroup[8] = 1;
 
     // Do the splitting
-    el.splitByFullTimeMatrixSplitter(vec_splitTimes, vec_splitGroup, outputs,
-                                     true, 0.5, 2.0E-4);
+    el.splitByFullTimeToTargets(vec_splitTimes, vec_splitGroup, outputs, true,
+                                0.5, 2.0E-4);
 
     // Examine result
-    TS_ASSERT_EQUALS(outputs.size(), 11);
-
     // group 2
-    EventList *e2 = outputs[2];
-    TS_ASSERT_EQUALS(e2->getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(lists[2].getNumberEvents(), 0);
 
     // group 5
-    EventList *e5 = outputs[5];
-    TS_ASSERT_EQUALS(e5->getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(lists[5].getNumberEvents(), 1);
 
     // group 4
-    EventList *e4 = outputs[4];
-    TS_ASSERT_EQUALS(e4->getNumberEvents(), 0);
-
-    // group 7
-    // EventList* e7 = outputs[7];
-    // TS_ASSERT_EQUALS(e7->getNumberEvents(), 1);
-
-    // Clean the pointers
-    for (auto &output : outputs) {
-      delete output.second;
-    }
-
-    return;
+    TS_ASSERT_EQUALS(lists[4].getNumberEvents(), 0);
   }
 
   //==================================================================================
@@ -2909,6 +3151,9 @@ public:
                                           rand() % 1000, 2.34, 4.56);
     el_sorted_weighted.setSortOrder(TOF_SORT);
 
+    el_sorted_columns = el_sorted_original;
+    el_sorted_columns.setStorageLayout(STRUCT_OF_ARRAYS);
+
     // A vector for histogramming, 100,000 steps of 1.0
     for (double i = 0; i < 100000; i += 1.0)
       fineX.emplace_back(i);
@@ -2924,7 +3169,7 @@ public:
   }
 
   EventList el_random, el_random_source, el_sorted, el_sorted_original,
-      el_sorted_weighted, el4, el5;
+      el_sorted_weighted, el_sorted_columns, el4, el5;
   MantidVec fineX;
   MantidVec coarseX;
 
@@ -2942,6 +3187,14 @@ public:
 
   void test_sort_tof() { el_random.sortTof(); }
 
+  void test_sort_tof_radix() { el_random.sortTof(RADIX_SORT); }
+
+  void test_sort_pulsetime_tof() { el_random.sortPulseTimeTOF(); }
+
+  void test_sort_pulsetime_tof_radix() {
+    el_random.sortPulseTimeTOF(RADIX_SORT);
+  }
+
   void test_compressEvents() {
     EventList out_el;
     el_sorted.compressEvents(10.0, &out_el);
@@ -2952,6 +3205,14 @@ public:
     el_sorted.compressEvents(10.0, &out_el);
   }
 
+  void test_splitByTime_short_intervals() {
+    TimeSplitterType split;
+    for (int i = 0; i < 1000; i += 10)
+      split.emplace_back(SplittingInterval(i, i + 1, 0));
+    EventList output;
+    el_random.splitByTime(split, {&output});
+  }
+
   void test_multiply() { el_random *= 2.345; }
 
   void test_convertTof() { el_random.convertTof(2.5, 6.78); }
@@ -2975,6 +3236,48 @@ public:
     el_sorted_weighted.generateHistogram(coarseX, Y, E);
   }
 
+  void test_histogram_events_per_second() {
+    MantidVec Y, E;
+    for (const auto &X : {fineX, coarseX}) {
+      for (auto *list : {&el_sorted, &el_sorted_weighted, &el_sorted_columns}) {
+        Timer timer;
+        list->generateHistogram(X, Y, E);
+        const double seconds = timer.elapsed();
+        std::cout << "\nHistogrammed " << list->getNumberEvents()
+                  << " events into " << X.size() - 1 << " bins at "
+                  << static_cast<double>(list->getNumberEvents()) / seconds
+                  << " events/s";
+      }
+    }
+    std::cout << "\n";
+  }
+
+  void test_counts_histogram_of_plain_tof_events() {
+    // The row-wise TofEvent list and the columns take separate code paths
+    MantidVec Y, E, columnsY;
+    for (const auto &X : {fineX, coarseX}) {
+      Timer timer;
+      el_sorted.generateHistogram(X, Y, E, true);
+      const double seconds = timer.elapsed();
+      std::cout << "\nCounted " << el_sorted.getNumberEvents()
+                << " TofEvents into " << X.size() - 1 << " bins at "
+                << static_cast<double>(el_sorted.getNumberEvents()) / seconds
+                << " events/s";
+      el_sorted_columns.generateHistogram(X, columnsY, E, true);
+      TS_ASSERT_EQUALS(Y, columnsY);
+    }
+    std::cout << "\n";
+  }
+
+  void test_histogram_fine_struct_of_arrays() {
+    MantidVec Y, E;
+    el_sorted_columns.generateHistogram(fineX, Y, E);
+  }
+
+  void test_convertTof_struct_of_arrays() {
+    el_sorted_columns.convertTof(2.5, 6.78);
+  }
+
   void test_maskTof() {
     TS_ASSERT_EQUALS(el_sorted.getNumberEvents(), 10000000);
     el_sorted.maskTof(25e3, 75e3);
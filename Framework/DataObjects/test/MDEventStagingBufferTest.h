@@ -0,0 +1,184 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/MDEventStagingBuffer.h"
+#include "MantidDataObjects/MDEventWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Timer.h"
+#include "MantidTestHelpers/MDEventsTestHelper.h"
+
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+
+namespace {
+using MDEW3 = MDEventWorkspace<MDLeanEvent<3>, 3>;
+
+/// 3D workspace from 0 to 10, split in 10 along each dimension, with the
+/// first box split again
+std::shared_ptr<MDEW3> createSplitWorkspace() {
+  auto ws = MDEventsTestHelper::makeMDEW<3>(10, 0.0, 10.0);
+  ws->splitBox();
+  auto *root = dynamic_cast<MDGridBox<MDLeanEvent<3>, 3> *>(ws->getBox());
+  root->splitContents(0);
+  return ws;
+}
+
+/// Deterministic event number i, spread over the workspace
+MDLeanEvent<3> makeEvent(size_t i) {
+  const coord_t centers[3] = {static_cast<coord_t>((i * 7) % 100) * 0.1f,
+                              static_cast<coord_t>((i * 13) % 100) * 0.1f,
+                              static_cast<coord_t>((i * 17) % 100) * 0.1f};
+  return MDLeanEvent<3>(static_cast<float>(i % 5 + 1), 1.0f, centers);
+}
+} // namespace
+
+class MDEventStagingBufferTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDEventStagingBufferTest *createSuite() {
+    return new MDEventStagingBufferTest();
+  }
+  static void destroySuite(MDEventStagingBufferTest *suite) { delete suite; }
+
+  void test_events_are_kept_until_the_buffer_is_full() {
+    auto ws = createSplitWorkspace();
+    MDEventStagingBuffer<MDLeanEvent<3>, 3> buffer(ws->getBox(), 10);
+    for (size_t i = 0; i < 9; ++i)
+      TS_ASSERT_EQUALS(buffer.addEvent(makeEvent(i)), 0);
+    TS_ASSERT_EQUALS(buffer.size(), 9);
+    TS_ASSERT_EQUALS(buffer.addEvent(makeEvent(9)), 10);
+    TS_ASSERT_EQUALS(buffer.size(), 0);
+    TS_ASSERT_EQUALS(buffer.flush(), 0);
+
+    ws->refreshCache();
+    TS_ASSERT_EQUALS(ws->getNPoints(), 10);
+  }
+
+  void test_events_go_to_the_same_boxes_as_with_addEvent() {
+    auto expected = createSplitWorkspace();
+    auto ws = createSplitWorkspace();
+    MDEventStagingBuffer<MDLeanEvent<3>, 3> buffer(ws->getBox(), 37);
+    for (size_t i = 0; i < 1000; ++i) {
+      expected->addEvent(makeEvent(i));
+      buffer.addEvent(makeEvent(i));
+    }
+    buffer.flush();
+    expected->refreshCache();
+    ws->refreshCache();
+
+    std::vector<IMDNode *> expectedBoxes, boxes;
+    expected->getBox()->getBoxes(expectedBoxes, 1000, true);
+    ws->getBox()->getBoxes(boxes, 1000, true);
+    TS_ASSERT_EQUALS(boxes.size(), expectedBoxes.size());
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      auto *expectedBox = dynamic_cast<MDBox<MDLeanEvent<3>, 3> *>(
+          expectedBoxes[i]);
+      auto *box = dynamic_cast<MDBox<MDLeanEvent<3>, 3> *>(boxes[i]);
+      const auto &expectedEvents = expectedBox->getConstEvents();
+      const auto &events = box->getConstEvents();
+      TS_ASSERT_EQUALS(events.size(), expectedEvents.size());
+      for (size_t j = 0; j < events.size(); ++j) {
+        // the order of the events in each box is kept
+        TS_ASSERT_EQUALS(events[j].getSignal(), expectedEvents[j].getSignal());
+        TS_ASSERT_EQUALS(events[j].getCenter(0),
+                         expectedEvents[j].getCenter(0));
+      }
+      expectedBox->releaseEvents();
+      box->releaseEvents();
+    }
+  }
+
+  void test_events_outside_of_the_boxes_are_dropped() {
+    auto ws = createSplitWorkspace();
+    MDEventStagingBuffer<MDLeanEvent<3>, 3> buffer(ws->getBox());
+    const coord_t outside[3] = {25.f, 25.f, 25.f};
+    buffer.addEvent(MDLeanEvent<3>(1.0f, 1.0f, outside));
+    buffer.addEvent(makeEvent(1));
+    TS_ASSERT_EQUALS(buffer.flush(), 1);
+    ws->refreshCache();
+    TS_ASSERT_EQUALS(ws->getNPoints(), 1);
+  }
+
+  void test_one_buffer_per_thread() {
+    auto ws = createSplitWorkspace();
+    const int64_t nEvents = 100000;
+    PARALLEL {
+      MDEventStagingBuffer<MDLeanEvent<3>, 3> buffer(ws->getBox(), 100);
+      PRAGMA_OMP(for)
+      for (int64_t i = 0; i < nEvents; ++i)
+        buffer.addEvent(makeEvent(static_cast<size_t>(i)));
+      buffer.flush();
+    }
+    ws->refreshCache();
+    TS_ASSERT_EQUALS(ws->getNPoints(), nEvents);
+    double signal = 0.;
+    for (int64_t i = 0; i < nEvents; ++i)
+      signal += makeEvent(static_cast<size_t>(i)).getSignal();
+    TS_ASSERT_DELTA(ws->getBox()->getSignal(), signal, 1e-6 * signal);
+  }
+};
+
+class MDEventStagingBufferTestPerformance : public CxxTest::TestSuite {
+public:
+  static MDEventStagingBufferTestPerformance *createSuite() {
+    return new MDEventStagingBufferTestPerformance();
+  }
+  static void destroySuite(MDEventStagingBufferTestPerformance *suite) {
+    delete suite;
+  }
+
+  MDEventStagingBufferTestPerformance() : m_nEvents(20000000) {}
+
+  /// All the threads add events to the same few boxes, one event at a time
+  void test_contended_addEvent() {
+    auto ws = createSplitWorkspace();
+    Kernel::Timer timer;
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < m_nEvents; ++i)
+      ws->addEvent(makeHotEvent(i));
+    std::cout << timer.elapsed() << " seconds to add " << m_nEvents
+              << " events with addEvent() from " << PARALLEL_GET_MAX_THREADS
+              << " threads.\n";
+    ws->refreshCache();
+    TS_ASSERT_EQUALS(ws->getNPoints(), m_nEvents);
+  }
+
+  /// The same events added through a staging buffer per thread
+  void test_contended_staging_buffer() {
+    auto ws = createSplitWorkspace();
+    Kernel::Timer timer;
+    PARALLEL {
+      MDEventStagingBuffer<MDLeanEvent<3>, 3> buffer(ws->getBox());
+      PRAGMA_OMP(for)
+      for (int64_t i = 0; i < m_nEvents; ++i)
+        buffer.addEvent(makeHotEvent(i));
+      buffer.flush();
+    }
+    std::cout << timer.elapsed() << " seconds to add " << m_nEvents
+              << " events with staging buffers from "
+              << PARALLEL_GET_MAX_THREADS << " threads.\n";
+    ws->refreshCache();
+    TS_ASSERT_EQUALS(ws->getNPoints(), m_nEvents);
+  }
+
+private:
+  /// Events in the 8 boxes at the origin, like the events of a Q-space
+  /// conversion close to Q=0
+  static MDLeanEvent<3> makeHotEvent(int64_t i) {
+    const coord_t centers[3] = {static_cast<coord_t>(i % 2) + 0.5f,
+                                static_cast<coord_t>((i / 2) % 2) + 0.5f,
+                                static_cast<coord_t>((i / 4) % 2) + 0.5f};
+    return MDLeanEvent<3>(1.0f, 1.0f, centers);
+  }
+
+  int64_t m_nEvents;
+};
@@ -233,6 +233,32 @@ public:
     //    TS_ASSERT_EQUALS( bc->getBoxesToSplit().size(), 1);
   }
 
+  void test_buildFromEvents() {
+    // SplitInto 4 suits the Morton ordering
+    MDEventWorkspace2Lean::sptr ws =
+        MDEventsTestHelper::makeMDEW<2>(4, 0.0, 8.0);
+    ws->splitBox();
+    addEvent(ws, 1.0, 1.0);
+    auto events = makeEvents(10000);
+    TS_ASSERT_EQUALS(ws->buildFromEvents(events), 100);
+    checkBuiltTree(ws, 10000 - 100 + 1);
+    TS_ASSERT(ws->isGridBox());
+    TS_ASSERT_EQUALS(ws->getBoxController()->getTotalNumMDBoxes() +
+                         ws->getBoxController()->getTotalNumMDGridBoxes(),
+                     ws->getBoxController()->getMaxId());
+  }
+
+  void test_buildFromEvents_falls_back_to_splitting_boxes() {
+    // SplitInto 3 can not be used with the Morton ordering
+    MDEventWorkspace2Lean::sptr ws =
+        MDEventsTestHelper::makeMDEW<2>(3, 0.0, 8.0);
+    ws->splitBox();
+    addEvent(ws, 1.0, 1.0);
+    auto events = makeEvents(10000);
+    TS_ASSERT_EQUALS(ws->buildFromEvents(events), 100);
+    checkBuiltTree(ws, 10000 - 100 + 1);
+  }
+
   //-------------------------------------------------------------------------------------
   /** Create an IMDIterator */
   void test_createIterator() {
@@ -479,6 +505,48 @@ public:
     TS_ASSERT_DELTA(ext[1].getMax(), ymax, 1e-4);
   }
 
+  /// Spread events over the workspace, with every 100th one out of bounds
+  std::vector<MDLeanEvent<2>> makeEvents(size_t numEvents) {
+    std::vector<MDLeanEvent<2>> events;
+    for (size_t i = 0; i < numEvents; i++) {
+      double centers[2] = {double((i * 7919) % 8000) / 1000.,
+                           double((i * 104729) % 7000) / 1000.};
+      if (i % 100 == 0)
+        centers[1] = 9.0;
+      events.emplace_back(MDLeanEvent<2>(1.0, 2.0, centers));
+    }
+    return events;
+  }
+
+  /// Check that every box holds its own events and is split when it should be
+  void checkBuiltTree(const MDEventWorkspace2Lean::sptr &ws,
+                      size_t numEvents) {
+    TS_ASSERT_EQUALS(ws->getNPoints(), numEvents);
+    TS_ASSERT_DELTA(ws->getBox()->getSignal(), double(numEvents), 1e-3);
+    TS_ASSERT_DELTA(ws->getBox()->getErrorSquared(), 2. * double(numEvents),
+                    1e-3);
+    auto bc = ws->getBoxController();
+    std::vector<API::IMDNode *> boxes;
+    ws->getBox()->getBoxes(boxes, 1000, true);
+    size_t total = 0;
+    for (auto node : boxes) {
+      auto box = dynamic_cast<MDBox<MDLeanEvent<2>, 2> *>(node);
+      TS_ASSERT(box);
+      const auto &events = box->getConstEvents();
+      total += events.size();
+      if (box->getDepth() < bc->getMaxDepth())
+        TS_ASSERT_LESS_THAN_EQUALS(events.size(), bc->getSplitThreshold());
+      for (const auto &event : events)
+        for (size_t d = 0; d < 2; d++) {
+          TS_ASSERT_LESS_THAN_EQUALS(box->getExtents(d).getMin() - 1e-5,
+                                     event.getCenter(d));
+          TS_ASSERT_LESS_THAN_EQUALS(event.getCenter(d),
+                                     box->getExtents(d).getMax() + 1e-5);
+        }
+    }
+    TS_ASSERT_EQUALS(total, numEvents);
+  }
+
   void addEvent(const MDEventWorkspace2Lean::sptr &b, double x, double y) {
     coord_t centers[2] = {static_cast<coord_t>(x), static_cast<coord_t>(y)};
     b->addEvent(MDLeanEvent<2>(2.0, 2.0, centers));
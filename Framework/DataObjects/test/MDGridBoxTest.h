@@ -1385,6 +1385,60 @@ public:
     delete box_ptr;
   }
 
+  //------------------------------------------------------------------------------------------------
+  void test_integrateSpheres_gives_the_same_result_as_integrateSphere() {
+    MDGridBox<MDLeanEvent<3>, 3> *box_ptr =
+        MDEventsTestHelper::makeMDGridBox<3>();
+    // 64 events per box
+    MDEventsTestHelper::feedMDBox<3>(box_ptr, 1, 40, 0.125f, 0.25f);
+    box_ptr->splitContents(0);
+    box_ptr->splitContents(555);
+    box_ptr->refreshCache();
+
+    // Overlapping spheres and shells, some off the edges
+    const double centers[5][3] = {{0.5, 0.5, 0.5},
+                                  {1.1, 0.7, 0.4},
+                                  {5.3, 5.6, 5.5},
+                                  {5.9, 5.1, 5.5},
+                                  {9.8, 0.2, 5.0}};
+    const double radii[4][2] = {{0.9, 0.0}, {1.7, 0.0}, {2.5, 1.2}, {0.3, 0.0}};
+    bool dimensionsUsed[3] = {true, true, true};
+    std::vector<std::unique_ptr<CoordTransformDistance>> transforms;
+    std::vector<IntegrationSphere> spheres;
+    for (const auto &position : centers) {
+      coord_t center[3] = {static_cast<coord_t>(position[0]),
+                           static_cast<coord_t>(position[1]),
+                           static_cast<coord_t>(position[2])};
+      transforms.emplace_back(
+          std::make_unique<CoordTransformDistance>(3, center, dimensionsUsed));
+      for (const auto &radius : radii)
+        spheres.emplace_back(
+            IntegrationSphere{transforms.back().get(),
+                              static_cast<coord_t>(radius[0] * radius[0]),
+                              static_cast<coord_t>(radius[1] * radius[1]), 0.0,
+                              0.0});
+    }
+    std::vector<IntegrationSphere *> spherePtrs;
+    for (auto &sphere : spheres)
+      spherePtrs.emplace_back(&sphere);
+
+    box_ptr->integrateSpheres(spherePtrs);
+
+    for (const auto &sphere : spheres) {
+      signal_t signal = 0;
+      signal_t errorSquared = 0;
+      box_ptr->integrateSphere(*sphere.radiusTransform, sphere.radiusSquared,
+                               signal, errorSquared, sphere.innerRadiusSquared);
+      TS_ASSERT_DELTA(sphere.signal, signal, 1e-5);
+      TS_ASSERT_DELTA(sphere.errorSquared, errorSquared, 1e-5);
+    }
+    // The first sphere contains at least the box it is centered on
+    TS_ASSERT_LESS_THAN(64.0, spheres[0].signal);
+
+    delete box_ptr->getBoxController();
+    delete box_ptr;
+  }
+
   //------------------------------------------------------------------------------------------------
   /** For test_integrateSphere
    *
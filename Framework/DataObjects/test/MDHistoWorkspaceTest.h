@@ -263,6 +263,46 @@ public:
     checkWorkspace(b, 1.23, 3.234, 123.);
   }
 
+  //--------------------------------------------------------------------------------------
+  void test_sparse_storage_starts_empty_and_keeps_values() {
+    auto &config = ConfigService::Instance();
+    const std::string oldValue =
+        config.getString("MDHistoWorkspace.SparseStorage");
+    config.setString("MDHistoWorkspace.SparseStorage", "1");
+    // Several bricks of bins, most of them left empty
+    Mantid::Geometry::GeneralFrame frame("m", "m");
+    MDHistoDimension_sptr dimX(
+        new MDHistoDimension("X", "x", frame, -10, 10, 200));
+    MDHistoDimension_sptr dimY(
+        new MDHistoDimension("Y", "y", frame, -10, 10, 100));
+    MDHistoWorkspace a(dimX, dimY);
+    config.setString("MDHistoWorkspace.SparseStorage", oldValue);
+    for (size_t i = 0; i < a.getNPoints(); i += 97)
+      TS_ASSERT_EQUALS(a.getSignalAt(i), 0.0);
+    a.setTo(0.0, 0.0, 0.0);
+    a.setSignalAt(10, 2.0);
+    a.setErrorSquaredAt(10, 4.0);
+    a.setSignalAt(15000, 3.0);
+    a.setMDMaskAt(15001, true);
+
+    MDHistoWorkspace_sptr b(new TestableMDHistoWorkspace(a));
+    TS_ASSERT_EQUALS(b->getSignalAt(10), 2.0);
+    TS_ASSERT_EQUALS(b->getErrorAt(10), 2.0);
+    TS_ASSERT_EQUALS(b->getSignalAt(15000), 3.0);
+    TS_ASSERT(b->getIsMaskedAt(15001));
+    TS_ASSERT_EQUALS(b->getSignalAt(5000), 0.0);
+    TS_ASSERT(!b->getIsMaskedAt(5000));
+
+    b->setSignalAt(5000, 1.0);
+    a += *b;
+    TS_ASSERT_EQUALS(a.getSignalAt(10), 4.0);
+    TS_ASSERT_EQUALS(a.getSignalAt(5000), 1.0);
+    TS_ASSERT_EQUALS(a.getSignalAt(15000), 6.0);
+    a -= *b;
+    TS_ASSERT_EQUALS(a.getSignalAt(5000), 0.0);
+    TS_ASSERT_EQUALS(a.getErrorAt(10), sqrt(8.0));
+  }
+
   //--------------------------------------------------------------------------------------
   void test_clone_clear_workspace_name() {
     auto ws =
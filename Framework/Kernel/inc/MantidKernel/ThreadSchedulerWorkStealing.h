@@ -0,0 +1,97 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : A ThreadScheduler with one queue per thread,
+ * for many short tasks and tasks that add more tasks.
+ *
+ * The other schedulers keep all the tasks in a single queue behind a single
+ * mutex, which all the threads fight for when the tasks are short. Here each
+ * thread pops tasks from the back of its own queue, so it runs the tasks it
+ * just added first, while their data is still in its cache. A task pushed
+ * from a thread of the pool goes to that thread's queue; tasks pushed from
+ * other threads are dealt out to the queues in turn.
+ *
+ * A thread whose queue is empty steals the oldest task of the queue with the
+ * largest total cost. When a task splits its work into subtasks, the oldest
+ * tasks are the largest pieces of work left, so few steals are needed to
+ * share the work out.
+ *
+ * Task mutexes are not taken into account when choosing a task; the thread
+ * pool still locks them while a task runs.
+ *
+ * As for the other schedulers, totalCost() is the cost of all the tasks
+ * pushed and totalCostExecuted() the cost of those popped since the last
+ * clear(). They are summed per queue, so m_cost and m_costExecuted are not
+ * used.
+ *
+ * @date 2020-06-22
+ */
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numQueues = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(std::shared_ptr<Task> newTask) override;
+  std::shared_ptr<Task> pop(size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+  double totalCost() override;
+  double totalCostExecuted() override;
+
+  /// @return the number of task queues
+  size_t numQueues() const { return m_queues.size(); }
+  /// @return the number of tasks taken from the queue of another thread
+  size_t numStolen() const { return m_numStolen; }
+
+private:
+  /// The tasks of one thread
+  struct TaskQueue {
+    /// Protects the tasks and their cost
+    std::mutex lock;
+    /// The tasks, oldest first
+    std::deque<std::shared_ptr<Task>> tasks;
+    /// Total cost of the tasks, readable without the lock
+    std::atomic<double> cost{0.};
+    /// Total cost of the tasks ever pushed to the queue
+    std::atomic<double> pushedCost{0.};
+    /// Total cost of the tasks ever popped or stolen from the queue
+    std::atomic<double> poppedCost{0.};
+    /// Number of tasks, readable without the lock
+    std::atomic<size_t> numTasks{0};
+  };
+
+  void pushTo(TaskQueue &queue, std::shared_ptr<Task> newTask);
+  std::shared_ptr<Task> steal(size_t thief);
+
+  /// Identifies this scheduler to the threads running its tasks
+  const size_t m_id;
+  /// One queue per thread
+  std::vector<std::unique_ptr<TaskQueue>> m_queues;
+  /// Number of tasks in all the queues
+  std::atomic<size_t> m_size;
+  /// Queue getting the next task pushed from outside of the thread pool
+  std::atomic<size_t> m_nextQueue;
+  /// Number of tasks stolen
+  std::atomic<size_t> m_numStolen;
+};
+
+} // namespace Kernel
+} // namespace Mantid
@@ -0,0 +1,320 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidKernel/cow_ptr.h"
+#include "MantidTypes/Core/DateAndTime.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** TimeSeriesColumns : The (time, value) entries of a TimeSeriesProperty,
+  stored as a column of times and a column of values.
+
+  The times are kept as nanoseconds since the GPS epoch, so an entry takes
+  8 bytes plus the size of the value instead of a padded (DateAndTime, TYPE)
+  pair, and boolean logs use one bit per value.
+
+  Copies share the columns until one of them is modified (copy on write), so
+  copying a property, e.g. into every workspace produced by splitting a run,
+  does not copy its entries.
+
+  A series is a window of consecutive entries of the columns, and the time of
+  its first entry may be moved forward. Removing entries from either end of
+  the series, as filtering by time does, or taking a range of the entries of
+  another series only moves the window: the columns are still shared, and
+  only copied when the entries are modified otherwise.
+
+  The running integral of the values over time, used for the time averages,
+  is calculated on first use and kept with the shared columns.
+
+  @date 2020-06-29
+*/
+template <typename TYPE> class TimeSeriesColumns {
+public:
+  using const_reference = typename std::vector<TYPE>::const_reference;
+  using const_iterator = typename std::vector<TYPE>::const_iterator;
+
+  /// @return the number of entries
+  size_t size() const { return m_size; }
+  /// @return true if there are no entries
+  bool empty() const { return m_size == 0; }
+
+  /// @return the time of entry i
+  Types::Core::DateAndTime time(size_t i) const {
+    return Types::Core::DateAndTime(nanoseconds(i));
+  }
+  /// @return the time of entry i, in nanoseconds since the GPS epoch
+  int64_t nanoseconds(size_t i) const {
+    return (i == 0 && m_movedFirstTime) ? m_firstTime
+                                        : m_data->times[m_first + i];
+  }
+  /// @return the value of entry i
+  const_reference value(size_t i) const { return m_data->values[m_first + i]; }
+  /// @return the value of the last entry
+  const_reference lastValue() const { return value(m_size - 1); }
+  /// @return the time of the last entry
+  Types::Core::DateAndTime lastTime() const { return time(m_size - 1); }
+  /// @return an iterator to the first value
+  const_iterator beginValues() const {
+    return m_data->values.cbegin() + m_first;
+  }
+  /// @return an iterator past the last value
+  const_iterator endValues() const { return beginValues() + m_size; }
+  /// @return a copy of all the values
+  std::vector<TYPE> values() const {
+    return std::vector<TYPE>(beginValues(), endValues());
+  }
+
+  /// Add an entry at the end
+  void emplace_back(const Types::Core::DateAndTime &time, const TYPE &value) {
+    auto &data = modify();
+    data.times.emplace_back(time.totalNanoseconds());
+    data.values.emplace_back(value);
+    ++m_size;
+  }
+
+  /// Add all the entries of another series at the end
+  void append(const TimeSeriesColumns &other) {
+    append(other, 0, other.size());
+  }
+
+  /**
+  Add the entries [first, last) of another series at the end. If this series
+  is empty, or already ends with the entry before first, it shares the
+  columns of the other series instead of copying the entries.
+  @param other :: the series to take the entries from
+  @param first :: index of the first entry to add
+  @param last :: index after the last entry to add
+  */
+  void append(const TimeSeriesColumns &other, size_t first, size_t last) {
+    if (first >= last)
+      return;
+    const bool firstTimeMoved = first == 0 && other.m_movedFirstTime;
+    if (empty()) {
+      m_data = other.m_data;
+      m_first = other.m_first + first;
+      m_size = last - first;
+      m_movedFirstTime = firstTimeMoved;
+      m_firstTime = other.m_firstTime;
+      return;
+    }
+    if (m_data == other.m_data && !firstTimeMoved &&
+        m_first + m_size == other.m_first + first) {
+      m_size += last - first;
+      return;
+    }
+    // Keep the other columns alive in case they are our own
+    const auto source = other;
+    auto &data = modify();
+    const auto times = source.m_data->times.cbegin() + source.m_first;
+    data.times.insert(data.times.end(), times + first, times + last);
+    if (firstTimeMoved)
+      data.times[m_size] = source.m_firstTime;
+    data.values.insert(data.values.end(), source.beginValues() + first,
+                       source.beginValues() + last);
+    m_size += last - first;
+  }
+
+  /// Reserve memory for n entries
+  void reserve(size_t n) {
+    auto &data = modify();
+    data.times.reserve(n);
+    data.values.reserve(n);
+  }
+
+  /// Remove all the entries, releasing the memory
+  void clear() {
+    m_data = cow_ptr<Columns>(std::make_shared<Columns>());
+    m_first = 0;
+    m_size = 0;
+    m_movedFirstTime = false;
+  }
+
+  /// Remove the entries [first, last)
+  void erase(size_t first, size_t last) {
+    if (first >= last)
+      return;
+    if (first == 0) {
+      m_first += last;
+      m_size -= last;
+      m_movedFirstTime = false;
+    } else if (last == m_size) {
+      m_size = first;
+    } else {
+      auto &data = modify();
+      data.times.erase(data.times.begin() + first, data.times.begin() + last);
+      data.values.erase(data.values.begin() + first,
+                        data.values.begin() + last);
+      m_size -= last - first;
+    }
+  }
+
+  /// Change the time of the first entry, which must not be after the second
+  void setFirstTime(const Types::Core::DateAndTime &time) {
+    if (empty())
+      return;
+    m_firstTime = time.totalNanoseconds();
+    m_movedFirstTime = m_firstTime != m_data->times[m_first];
+  }
+
+  /// @return true if the entries are in increasing time order
+  bool isSorted() const {
+    if (m_size < 2)
+      return true;
+    const auto begin = m_data->times.cbegin() + m_first;
+    return nanoseconds(0) <= begin[1] &&
+           std::is_sorted(begin + 1, begin + m_size);
+  }
+
+  /// Sort the entries by time, keeping the order of entries at equal times
+  void sort() {
+    std::vector<size_t> order(m_size);
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::stable_sort(order.begin(), order.end(),
+                     [this](const size_t lhs, const size_t rhs) {
+                       return nanoseconds(lhs) < nanoseconds(rhs);
+                     });
+    auto sorted = std::make_shared<Columns>();
+    sorted->times.reserve(order.size());
+    sorted->values.reserve(order.size());
+    for (const auto i : order) {
+      sorted->times.emplace_back(nanoseconds(i));
+      sorted->values.emplace_back(value(i));
+    }
+    m_data = cow_ptr<Columns>(std::move(sorted));
+    m_first = 0;
+    m_movedFirstTime = false;
+  }
+
+  /**
+  Find the first entry, within [first, last), whose time is not before t.
+  The entries must be sorted.
+  @param t :: the time to look for
+  @param first :: index of the first entry to search
+  @param last :: index after the last entry to search
+  @return the index of the entry, or last if all the entries are before t
+  */
+  size_t lowerBound(const Types::Core::DateAndTime &t, size_t first,
+                    size_t last) const {
+    const int64_t ns = t.totalNanoseconds();
+    if (first == 0 && last > 0 && m_movedFirstTime) {
+      if (m_firstTime >= ns)
+        return 0;
+      first = 1;
+    }
+    const auto begin = m_data->times.cbegin() + m_first;
+    return static_cast<size_t>(
+        std::lower_bound(begin + first, begin + last, ns) - begin);
+  }
+
+  /**
+  Integrate the values over time between two entries, each value holding
+  until the time of the next entry. The entries must be sorted.
+  @param first :: index of the first entry
+  @param last :: index of the last entry, not included
+  @return the integral, in value * seconds
+  */
+  double integral(size_t first, size_t last) const {
+    if (first >= last)
+      return 0.;
+    const auto &integrals = runningIntegral();
+    double result = integrals[m_first + last] - integrals[m_first + first];
+    if (first == 0 && m_movedFirstTime)
+      result -= static_cast<double>(m_firstTime - m_data->times[m_first]) *
+                1e-9 * static_cast<double>(value(0));
+    return result;
+  }
+
+  /// @return the memory used by the entries, in bytes
+  size_t memorySize() const {
+    return size() * (sizeof(int64_t) + sizeof(TYPE));
+  }
+
+  /// @return true if both series use the same columns
+  bool sharesStorageWith(const TimeSeriesColumns &other) const {
+    return m_data == other.m_data;
+  }
+
+private:
+  /// The columns, shared by the copies
+  struct Columns {
+    Columns() = default;
+    /// The running integral is not copied: the copy is about to be modified
+    Columns(const Columns &other)
+        : times(other.times), values(other.values) {}
+
+    /// Times, in nanoseconds since the GPS epoch
+    std::vector<int64_t> times;
+    /// Values
+    std::vector<TYPE> values;
+    /// Integral of the values from the first entry to each entry, in value *
+    /// seconds; empty until needed
+    mutable std::vector<double> integrals;
+    /// Protects the calculation of the integrals
+    mutable std::mutex integralsMutex;
+  };
+
+  /// @return the columns, holding only the entries of this series, copied
+  /// first if they are shared
+  Columns &modify() {
+    if (m_first != 0 || m_size != m_data->times.size() || m_movedFirstTime) {
+      auto window = std::make_shared<Columns>();
+      const auto times = m_data->times.cbegin() + m_first;
+      window->times.assign(times, times + m_size);
+      if (m_movedFirstTime)
+        window->times.front() = m_firstTime;
+      window->values.assign(beginValues(), endValues());
+      m_data = cow_ptr<Columns>(std::move(window));
+      m_first = 0;
+      m_movedFirstTime = false;
+    }
+    auto &data = m_data.access();
+    if (!data.integrals.empty())
+      std::vector<double>().swap(data.integrals);
+    return data;
+  }
+
+  /// @return the integral of the values up to each entry of the columns
+  const std::vector<double> &runningIntegral() const {
+    const Columns &data = *m_data;
+    std::lock_guard<std::mutex> lock(data.integralsMutex);
+    if (data.integrals.size() != data.times.size()) {
+      const size_t n = data.times.size();
+      data.integrals.resize(n);
+      double sum = 0.;
+      for (size_t i = 0; i < n; ++i) {
+        data.integrals[i] = sum;
+        if (i + 1 < n)
+          sum += static_cast<double>(data.times[i + 1] - data.times[i]) *
+                 1e-9 * static_cast<double>(data.values[i]);
+      }
+    }
+    return data.integrals;
+  }
+
+  /// The columns, shared by the copies
+  cow_ptr<Columns> m_data;
+  /// Index in the columns of the first entry
+  size_t m_first = 0;
+  /// Number of entries
+  size_t m_size = 0;
+  /// True if the first entry is at m_firstTime instead of its time in the
+  /// columns
+  bool m_movedFirstTime = false;
+  /// Time of the first entry if it has been moved, in nanoseconds
+  int64_t m_firstTime = 0;
+};
+
+} // namespace Kernel
+} // namespace Mantid
@@ -14,6 +14,7 @@
 #include "MantidKernel/ITimeSeriesProperty.h"
 #include "MantidKernel/Property.h"
 #include "MantidKernel/Statistics.h"
+#include "MantidKernel/TimeSeriesColumns.h"
 #include <cstdint>
 #include <utility>
 
@@ -322,6 +323,9 @@ private:
   void saveTimeVector(::NeXus::File *file);
   /// Sort the property into increasing times, if not already sorted
   void sortIfNecessary() const;
+  /// Add a range of the entries of another property, sharing their storage
+  void appendEntries(const TimeSeriesProperty<TYPE> &source, size_t first,
+                     size_t last);
   ///  Find the index of the entry of time t in the mP vector (sorted)
   int findIndex(Types::Core::DateAndTime t) const;
   ///  Find the upper_bound of time t in container.
@@ -338,8 +342,8 @@ private:
   /// Time weighted mean and standard deviation
   std::pair<double, double> timeAverageValueAndStdDev() const;
 
-  /// Holds the time series data
-  mutable std::vector<TimeValueUnit<TYPE>> m_values;
+  /// Holds the time series data, shared with the copies of the property
+  mutable TimeSeriesColumns<TYPE> m_values;
 
   /// The number of values (or time intervals) in the time series. It can be
   /// different from m_propertySeries.size()
@@ -173,6 +173,27 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert the values in [first, last) to TOF, in place. The unit must be
+   * initialized. The common units override this with a loop that the
+   * compiler can vectorise; by default singleToTOF() is called for each value.
+   * @param first :: pointer to the first value
+   * @param last :: pointer past the last value
+   */
+  virtual void multipleToTOF(double *first, double *last) const;
+
+  /** Convert the TOF values in [first, last) to this unit, in place. The unit
+   * must be initialized.
+   * @param first :: pointer to the first value
+   * @param last :: pointer past the last value
+   */
+  virtual void multipleFromTOF(double *first, double *last) const;
+
+  // Convert values of this unit to another unit through TOF, in place
+  void convertViaTOF(const Unit &destination, double *first,
+                     double *last) const;
+  void convertViaTOF(const Unit &destination, float *first,
+                     float *last) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
@@ -291,6 +312,8 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *first, double *last) const override;
+  void multipleFromTOF(double *first, double *last) const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -308,6 +331,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *first, double *last) const override;
+  void multipleFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -335,6 +360,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *first, double *last) const override;
+  void multipleFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -382,6 +409,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *first, double *last) const override;
+  void multipleFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -432,6 +461,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *first, double *last) const override;
+  void multipleFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -477,6 +508,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *first, double *last) const override;
+  void multipleFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -562,6 +595,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *first, double *last) const override;
+  void multipleFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -581,6 +616,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void multipleToTOF(double *first, double *last) const override;
+  void multipleFromTOF(double *first, double *last) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
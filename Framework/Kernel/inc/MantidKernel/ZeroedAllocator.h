@@ -0,0 +1,76 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Mantid {
+namespace Kernel {
+
+/** Allocator for large arrays of trivial values that start out as zero.
+
+  The memory comes from calloc, which for large blocks maps fresh pages from
+  the operating system. Those pages are zero already and only take up memory
+  once they are written to, so an array that is only partly written, such as
+  a histogram of mostly-empty space, only uses memory for the pages holding
+  data. Elements are default-initialised, so creating a container does not
+  write to, and so commit, every page of it.
+*/
+template <typename T> class ZeroedAllocator {
+  static_assert(std::is_trivial<T>::value,
+                "ZeroedAllocator is only for trivial types");
+
+public:
+  using value_type = T;
+
+  ZeroedAllocator() noexcept = default;
+  template <typename U>
+  ZeroedAllocator(const ZeroedAllocator<U> & /*unused*/) noexcept {}
+
+  T *allocate(std::size_t n) {
+    if (n == 0)
+      return nullptr;
+    auto data = static_cast<T *>(std::calloc(n, sizeof(T)));
+    if (!data)
+      throw std::bad_alloc();
+    return data;
+  }
+  void deallocate(T *data, std::size_t /*unused*/) noexcept {
+    std::free(data);
+  }
+
+  /// Leave new elements as they are: zero if the memory is fresh
+  template <typename U> void construct(U *p) noexcept {
+    ::new (static_cast<void *>(p)) U;
+  }
+  template <typename U, typename... Args>
+  void construct(U *p, Args &&... args) {
+    ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+  }
+
+  /// Deleter for arrays allocated with a ZeroedAllocator
+  struct Deleter {
+    void operator()(T *data) const noexcept { std::free(data); }
+  };
+};
+
+template <typename T, typename U>
+bool operator==(const ZeroedAllocator<T> & /*unused*/,
+                const ZeroedAllocator<U> & /*unused*/) noexcept {
+  return true;
+}
+template <typename T, typename U>
+bool operator!=(const ZeroedAllocator<T> & /*unused*/,
+                const ZeroedAllocator<U> & /*unused*/) noexcept {
+  return false;
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -0,0 +1,176 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+
+#include <limits>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// The scheduler the calling thread last popped a task from, and its queue
+struct CurrentQueue {
+  size_t schedulerId;
+  size_t index;
+};
+thread_local CurrentQueue currentQueue{0, 0};
+/// Identifies the schedulers, as a new one may reuse the address of an old one
+std::atomic<size_t> lastSchedulerId(0);
+} // namespace
+
+/** Constructor
+ *
+ * @param numQueues :: number of task queues; should be the number of threads
+ *        of the ThreadPool. Default 0 means one per physical core.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numQueues)
+    : ThreadScheduler(), m_id(++lastSchedulerId), m_size(0), m_nextQueue(0),
+      m_numStolen(0) {
+  if (numQueues == 0)
+    numQueues = ThreadPool::getNumPhysicalCores();
+  numQueues = std::max(numQueues, size_t(1));
+  m_queues.reserve(numQueues);
+  for (size_t i = 0; i < numQueues; ++i)
+    m_queues.emplace_back(std::make_unique<TaskQueue>());
+}
+
+/// Destructor
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() { clear(); }
+
+/** Add a Task to the queue of the calling thread, or to the next queue if the
+ * calling thread does not run tasks of this scheduler.
+ *
+ * @param newTask :: Task to add to queue
+ */
+void ThreadSchedulerWorkStealing::push(std::shared_ptr<Task> newTask) {
+  size_t index;
+  if (currentQueue.schedulerId == m_id)
+    index = currentQueue.index;
+  else
+    index = m_nextQueue++ % m_queues.size();
+  pushTo(*m_queues[index], std::move(newTask));
+}
+
+/** Retrieves the next Task to execute: the newest task of the thread's own
+ * queue, or else the oldest task of the most expensive other queue.
+ *
+ * @param threadnum :: ID of the calling thread.
+ * @return a Task pointer to execute, or nullptr if there are no tasks left.
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t index = threadnum % m_queues.size();
+  // Tasks this thread pushes from now on go to its own queue
+  currentQueue = {m_id, index};
+
+  TaskQueue &queue = *m_queues[index];
+  if (queue.numTasks > 0) {
+    std::lock_guard<std::mutex> lock(queue.lock);
+    if (!queue.tasks.empty()) {
+      auto task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      queue.cost = queue.cost - task->cost();
+      queue.poppedCost = queue.poppedCost + task->cost();
+      --queue.numTasks;
+      --m_size;
+      return task;
+    }
+  }
+  return steal(index);
+}
+
+/** Take the oldest task of the queue with the largest total cost.
+ *
+ * @param thief :: index of the queue of the calling thread
+ * @return the stolen task, or nullptr if all the other queues are empty.
+ */
+std::shared_ptr<Task> ThreadSchedulerWorkStealing::steal(size_t thief) {
+  // Other threads may empty the chosen queue before it is locked, so try
+  // again until all the queues are empty.
+  while (m_size > 0) {
+    TaskQueue *victim = nullptr;
+    double maxCost = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < m_queues.size(); ++i) {
+      TaskQueue &queue = *m_queues[i];
+      if (i == thief || queue.numTasks == 0)
+        continue;
+      const double cost = queue.cost;
+      if (!victim || cost > maxCost) {
+        victim = &queue;
+        maxCost = cost;
+      }
+    }
+    if (!victim)
+      return nullptr;
+
+    std::lock_guard<std::mutex> lock(victim->lock);
+    if (!victim->tasks.empty()) {
+      auto task = std::move(victim->tasks.front());
+      victim->tasks.pop_front();
+      victim->cost = victim->cost - task->cost();
+      victim->poppedCost = victim->poppedCost + task->cost();
+      --victim->numTasks;
+      --m_size;
+      ++m_numStolen;
+      return task;
+    }
+  }
+  return nullptr;
+}
+
+/** Add a Task to the back of a queue.
+ *
+ * @param queue :: the queue to add to
+ * @param newTask :: Task to add
+ */
+void ThreadSchedulerWorkStealing::pushTo(TaskQueue &queue,
+                                         std::shared_ptr<Task> newTask) {
+  std::lock_guard<std::mutex> lock(queue.lock);
+  queue.cost = queue.cost + newTask->cost();
+  queue.pushedCost = queue.pushedCost + newTask->cost();
+  queue.tasks.emplace_back(std::move(newTask));
+  ++queue.numTasks;
+  ++m_size;
+}
+
+/// @return the number of tasks in all the queues
+size_t ThreadSchedulerWorkStealing::size() { return m_size; }
+
+/// @return true if all the queues are empty
+bool ThreadSchedulerWorkStealing::empty() { return m_size == 0; }
+
+/// Empty out all the queues
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    m_size -= queue->tasks.size();
+    queue->tasks.clear();
+    queue->cost = 0.;
+    queue->pushedCost = 0.;
+    queue->poppedCost = 0.;
+    queue->numTasks = 0;
+  }
+}
+
+/// @return the total cost of the tasks pushed since the last clear()
+double ThreadSchedulerWorkStealing::totalCost() {
+  double cost = 0.;
+  for (const auto &queue : m_queues)
+    cost += queue->pushedCost;
+  return cost;
+}
+
+/// @return the total cost of the tasks popped since the last clear()
+double ThreadSchedulerWorkStealing::totalCostExecuted() {
+  double cost = 0.;
+  for (const auto &queue : m_queues)
+    cost += queue->poppedCost;
+  return cost;
+}
+
+} // namespace Kernel
+} // namespace Mantid
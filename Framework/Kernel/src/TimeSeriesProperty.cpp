@@ -97,17 +97,15 @@ TimeSeriesProperty<TYPE>::getDerivative() const {
   }
 
   this->sortIfNecessary();
-  auto it = this->m_values.begin();
-  int64_t t0 = it->time().totalNanoseconds();
-  TYPE v0 = it->value();
+  int64_t t0 = m_values.nanoseconds(0);
+  TYPE v0 = m_values.value(0);
 
-  it++;
   auto timeSeriesDeriv = std::make_unique<TimeSeriesProperty<double>>(
       this->name() + "_derivative");
   timeSeriesDeriv->reserve(this->m_values.size() - 1);
-  for (; it != m_values.end(); it++) {
-    TYPE v1 = it->value();
-    int64_t t1 = it->time().totalNanoseconds();
+  for (size_t i = 1; i < m_values.size(); i++) {
+    TYPE v1 = m_values.value(i);
+    int64_t t1 = m_values.nanoseconds(i);
     if (t1 != t0) {
       double deriv = 1.e+9 * (double(v1 - v0) / double(t1 - t0));
       auto tm = static_cast<int64_t>((t1 + t0) / 2);
@@ -131,8 +129,8 @@ TimeSeriesProperty<std::string>::getDerivative() const {
  * */
 template <typename TYPE>
 size_t TimeSeriesProperty<TYPE>::getMemorySize() const {
-  // Rough estimate
-  return m_values.size() * (sizeof(TYPE) + sizeof(DateAndTime));
+  // Rough estimate, counting the entries shared with copies of this property
+  return m_values.memorySize();
 }
 
 /**
@@ -157,8 +155,7 @@ operator+=(Property const *right) {
 
   if (rhs) {
     if (this->operator!=(*rhs)) {
-      m_values.insert(m_values.end(), rhs->m_values.begin(),
-                      rhs->m_values.end());
+      m_values.append(rhs->m_values);
       m_propSortedFlag = TimeSeriesSortStatus::TSUNKNOWN;
     } else {
       // Do nothing if appending yourself to yourself. The net result would be
@@ -290,25 +287,21 @@ void TimeSeriesProperty<TYPE>::filterByTime(
   if (m_values.size() <= 1)
     return;
 
-  typename std::vector<TimeValueUnit<TYPE>>::iterator iterhead, iterend;
-
   // 2. Determine index for start and remove  Note erase is [...)
   int istart = this->findIndex(start);
   if (istart >= 0 && static_cast<size_t>(istart) < m_values.size()) {
     // "start time" is behind time-series's starting time
-    iterhead = m_values.begin() + istart;
-
     // False - The filter time is on the mark.  Erase [begin(),  istart)
     // True - The filter time is larger than T[istart]. Erase[begin(), istart)
     // ...
     //       filter start(time) and move istart to filter startime
-    bool useprefiltertime = !(m_values[istart].time() == start);
+    bool useprefiltertime = !(m_values.time(istart) == start);
 
     // Remove the series
-    m_values.erase(m_values.begin(), iterhead);
+    m_values.erase(0, static_cast<size_t>(istart));
 
     if (useprefiltertime) {
-      m_values[0].setTime(start);
+      m_values.setFirstTime(start);
     }
   } else {
     // "start time" is before/after time-series's starting time: do nothing
@@ -318,15 +311,13 @@ void TimeSeriesProperty<TYPE>::filterByTime(
   // 3. Determine index for end and remove  Note erase is [...)
   int iend = this->findIndex(stop);
   if (static_cast<size_t>(iend) < m_values.size()) {
-    if (m_values[iend].time() == stop) {
+    if (m_values.time(iend) == stop) {
       // Filter stop is on a log.  Delete that log
-      iterend = m_values.begin() + iend;
+      m_values.erase(static_cast<size_t>(iend), m_values.size());
     } else {
       // Filter stop is behind iend. Keep iend
-      iterend = m_values.begin() + iend + 1;
+      m_values.erase(static_cast<size_t>(iend) + 1, m_values.size());
     }
-    // Delete from [iend to mp.end)
-    m_values.erase(iterend, m_values.end());
   }
 
   // 4. Make size consistent
@@ -350,7 +341,7 @@ void TimeSeriesProperty<TYPE>::filterByTimes(
   }
 
   // 3. Prepare a copy
-  std::vector<TimeValueUnit<TYPE>> mp_copy;
+  TimeSeriesColumns<TYPE> mp_copy;
 
   g_log.debug() << "DB541  mp_copy Size = " << mp_copy.size()
                 << "  Original MP Size = " << m_values.size() << "\n";
@@ -376,7 +367,7 @@ void TimeSeriesProperty<TYPE>::filterByTimes(
     } else if (tstopindex >= int(m_values.size())) {
       tstopindex = int(m_values.size()) - 1;
     } else {
-      if (t_stop == m_values[size_t(tstopindex)].time() &&
+      if (t_stop == m_values.time(size_t(tstopindex)) &&
           size_t(tstopindex) > 0) {
         tstopindex--;
       }
@@ -388,12 +379,11 @@ void TimeSeriesProperty<TYPE>::filterByTimes(
     }
 
     if (tstartindex == tstopindex) {
-      TimeValueUnit<TYPE> temp(t_start, m_values[tstartindex].value());
-      mp_copy.emplace_back(temp);
+      mp_copy.emplace_back(t_start, m_values.value(tstartindex));
     } else {
-      mp_copy.emplace_back(t_start, m_values[tstartindex].value());
+      mp_copy.emplace_back(t_start, m_values.value(tstartindex));
       for (auto im = size_t(tstartindex + 1); im <= size_t(tstopindex); ++im) {
-        mp_copy.emplace_back(m_values[im].time(), m_values[im].value());
+        mp_copy.emplace_back(m_values.time(im), m_values.value(im));
       }
     }
   } // ENDFOR
@@ -402,9 +392,7 @@ void TimeSeriesProperty<TYPE>::filterByTimes(
                 << "  Original Log Size = " << m_values.size() << "\n";
 
   // 5. Clear
-  m_values.clear();
   m_values = mp_copy;
-  mp_copy.clear();
 
   m_size = static_cast<int>(m_values.size());
 }
@@ -486,13 +474,13 @@ void TimeSeriesProperty<TYPE>::splitByTime(
     }
 
     // Skip the events before the start of the time
-    while (i_property < m_values.size() && m_values[i_property].time() < start)
+    while (i_property < m_values.size() && m_values.time(i_property) < start)
       ++i_property;
 
     if (i_property == m_values.size()) {
       // i_property is out of the range. Then use the last entry
-      myOutput->addValue(m_values[i_property - 1].time(),
-                         m_values[i_property - 1].value());
+      myOutput->addValue(m_values.time(i_property - 1),
+                         m_values.value(i_property - 1));
 
       ++itspl;
       ++counter;
@@ -500,23 +488,22 @@ void TimeSeriesProperty<TYPE>::splitByTime(
     }
 
     // The current entry is within an interval. Record them until out
-    if (m_values[i_property].time() > start && i_property > 0 && !isPeriodic) {
+    size_t i_first = i_property;
+    if (m_values.time(i_property) > start && i_property > 0 && !isPeriodic) {
       // Record the previous oneif this property is not exactly on start time
       //   and this entry is not recorded
       size_t i_prev = i_property - 1;
       if (myOutput->size() == 0 ||
-          m_values[i_prev].time() != myOutput->lastTime())
-        myOutput->addValue(m_values[i_prev].time(), m_values[i_prev].value());
+          m_values.time(i_prev) != myOutput->lastTime())
+        i_first = i_prev;
     }
 
     // Loop through all the entries until out.
-    while (i_property < m_values.size() && m_values[i_property].time() < stop) {
-
-      // Copy the log out to the output
-      myOutput->addValue(m_values[i_property].time(),
-                         m_values[i_property].value());
+    while (i_property < m_values.size() && m_values.time(i_property) < stop)
       ++i_property;
-    }
+
+    // Copy the log out to the output
+    myOutput->appendEntries(*this, i_first, i_property);
 
     // Go to the next interval
     ++itspl;
@@ -563,14 +550,11 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
 
   sortIfNecessary();
 
-  // work on m_values, m_size, and m_time
-  auto const currentTimes = timesAsVector();
-  auto const currentValues = valuesAsVector();
   size_t index_splitter = 0;
 
   // move splitter index such that the first entry of TSP is before the stop
   // time of a splitter
-  DateAndTime firstPropTime = currentTimes[0];
+  DateAndTime firstPropTime = m_values.time(0);
   auto firstFilterTime = std::lower_bound(timeToFilterTo.begin(),
                                           timeToFilterTo.end(), firstPropTime);
   if (firstFilterTime == timeToFilterTo.end()) {
@@ -586,9 +570,9 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
   DateAndTime filterEndTime = timeToFilterTo[index_splitter + 1];
 
   // move along the entries to find the entry inside the current splitter
-  auto firstEntryInSplitter = std::lower_bound(
-      currentTimes.begin(), currentTimes.end(), filterStartTime);
-  if (firstEntryInSplitter == currentTimes.end()) {
+  const size_t numEntries = m_values.size();
+  size_t timeIndex = m_values.lowerBound(filterStartTime, 0, numEntries);
+  if (timeIndex == numEntries) {
     // the first splitter's start time is LATER than the last TSP entry, then
     // there won't be any
     // TSP entry to be split into any wsIndex splitter.
@@ -603,8 +587,7 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
   // first splitter start time is between firstEntryInSplitter and the one
   // before it. so the index for firstEntryInSplitter is the first TSP entry
   // in the splitter
-  size_t timeIndex = firstEntryInSplitter - currentTimes.begin();
-  firstPropTime = *firstEntryInSplitter;
+  firstPropTime = m_values.time(timeIndex);
 
   for (; index_splitter < timeToFilterTo.size() - 1; ++index_splitter) {
     int wsIndex = inputWorkspaceIndicies[index_splitter];
@@ -616,30 +599,46 @@ void TimeSeriesProperty<TYPE>::splitByTimeVector(
     if (timeIndex > 0)
       --timeIndex;
 
-    // add the continuous entries to same wsIndex time series property
-    const size_t numEntries = currentTimes.size();
-
     // Add properties to the current wsIndex.
+    auto *currentOutput = output[wsIndex];
     if (timeIndex >= numEntries) {
       // We have run out of TSP entries, so use the last TSP value
       // for all remaining outputs
-      auto currentTime = currentTimes.back();
-      if (output[wsIndex]->size() == 0 ||
-          output[wsIndex]->lastTime() != currentTime) {
-        output[wsIndex]->addValue(currentTime, currentValues.back());
+      auto currentTime = m_values.lastTime();
+      if (currentOutput->size() == 0 ||
+          currentOutput->lastTime() != currentTime) {
+        currentOutput->addValue(currentTime, m_values.lastValue());
       }
     } else {
       // Add TSP values until we run out or go past the current filter
-      // end time.
-      for (; timeIndex < numEntries; ++timeIndex) {
-        auto currentTime = currentTimes[timeIndex];
-        if (output[wsIndex]->size() == 0 ||
-            output[wsIndex]->lastTime() < currentTime) {
+      // end time, skipping those already in the output.
+      size_t last = timeIndex;
+      while (last < numEntries && m_values.time(last) <= filterEndTime)
+        ++last;
+      const size_t next = last;
+      if (last < numEntries)
+        ++last;
+      size_t first = timeIndex;
+      if (currentOutput->size() > 0) {
+        const auto outputEnd = currentOutput->lastTime();
+        while (first < last && m_values.time(first) <= outputEnd)
+          ++first;
+      }
+      bool noDuplicates = true;
+      for (size_t i = first + 1; i < last && noDuplicates; ++i)
+        noDuplicates = m_values.nanoseconds(i) != m_values.nanoseconds(i - 1);
+      timeIndex = next;
+
+      if (noDuplicates) {
+        // The entries are contiguous, so the output can share them
+        currentOutput->appendEntries(*this, first, last);
+      } else {
+        for (size_t i = first; i < last; ++i) {
           // avoid to add duplicate entry
-          output[wsIndex]->addValue(currentTime, currentValues[timeIndex]);
+          if (currentOutput->size() == 0 ||
+              currentOutput->lastTime() < m_values.time(i))
+            currentOutput->addValue(m_values.time(i), m_values.value(i));
         }
-        if (currentTime > filterEndTime)
-          break;
       }
     }
   }
@@ -726,8 +725,8 @@ void TimeSeriesProperty<TYPE>::makeFilterByValue(
   for (size_t i = 0; i < m_values.size(); ++i) {
     const DateAndTime lastTime = t;
     // The new entry
-    t = m_values[i].time();
-    TYPE val = m_values[i].value();
+    t = m_values.time(i);
+    TYPE val = m_values.value(i);
 
     // A good value?
     const bool isGood = ((val >= min) && (val <= max));
@@ -873,7 +872,7 @@ double TimeSeriesProperty<TYPE>::averageValueInFilter(
 
   // If there's just a single value in the log, return that.
   if (realSize() == 1) {
-    return static_cast<double>(m_values.front().value());
+    return static_cast<double>(m_values.value(0));
   }
 
   sortIfNecessary();
@@ -889,13 +888,18 @@ double TimeSeriesProperty<TYPE>::averageValueInFilter(
     double value = getSingleValue(time.start(), index);
     DateAndTime startTime = time.start();
 
-    while (index < realSize() - 1 && m_values[index + 1].time() < time.stop()) {
-      ++index;
-      numerator +=
-          DateAndTime::secondsFromDuration(m_values[index].time() - startTime) *
-          value;
-      startTime = m_values[index].time();
-      value = static_cast<double>(m_values[index].value());
+    // The last entry before the end of the filter range
+    const auto end = m_values.lowerBound(time.stop(), 0, m_values.size());
+    const int last = static_cast<int>(end) - 1;
+    if (last > index) {
+      // Up to the next entry, then over the entries in the range, using the
+      // running integral of the log
+      numerator += DateAndTime::secondsFromDuration(m_values.time(index + 1) -
+                                                    startTime) *
+                   value;
+      numerator += m_values.integral(index + 1, last);
+      startTime = m_values.time(last);
+      value = static_cast<double>(m_values.value(last));
     }
 
     // Now close off with the end of the current filter range
@@ -958,14 +962,14 @@ std::pair<double, double> TimeSeriesProperty<TYPE>::averageAndStdDevInFilter(
     double valuestddev = (value - mean) * (value - mean);
     DateAndTime startTime = time.start();
 
-    while (index < realSize() - 1 && m_values[index + 1].time() < time.stop()) {
+    while (index < realSize() - 1 && m_values.time(index + 1) < time.stop()) {
       ++index;
 
       numerator +=
-          DateAndTime::secondsFromDuration(m_values[index].time() - startTime) *
+          DateAndTime::secondsFromDuration(m_values.time(index) - startTime) *
           valuestddev;
-      startTime = m_values[index].time();
-      value = static_cast<double>(m_values[index].value());
+      startTime = m_values.time(index);
+      value = static_cast<double>(m_values.value(index));
       valuestddev = (value - mean) * (value - mean);
     }
 
@@ -1015,7 +1019,7 @@ TimeSeriesProperty<TYPE>::valueAsCorrectMap() const {
 
   if (!m_values.empty()) {
     for (size_t i = 0; i < m_values.size(); i++)
-      asMap[m_values[i].time()] = m_values[i].value();
+      asMap[m_values.time(i)] = m_values.value(i);
   }
 
   return asMap;
@@ -1029,13 +1033,7 @@ template <typename TYPE>
 std::vector<TYPE> TimeSeriesProperty<TYPE>::valuesAsVector() const {
   sortIfNecessary();
 
-  std::vector<TYPE> out;
-  out.reserve(m_values.size());
-
-  for (size_t i = 0; i < m_values.size(); i++)
-    out.emplace_back(m_values[i].value());
-
-  return out;
+  return m_values.values();
 }
 
 /**
@@ -1052,7 +1050,7 @@ TimeSeriesProperty<TYPE>::valueAsMultiMap() const {
   if (!m_values.empty()) {
     for (size_t i = 0; i < m_values.size(); i++)
       asMultiMap.insert(
-          std::make_pair(m_values[i].time(), m_values[i].value()));
+          std::make_pair(m_values.time(i), m_values.value(i)));
   }
 
   return asMultiMap;
@@ -1070,7 +1068,7 @@ std::vector<DateAndTime> TimeSeriesProperty<TYPE>::timesAsVector() const {
   out.reserve(m_values.size());
 
   for (size_t i = 0; i < m_values.size(); i++) {
-    out.emplace_back(m_values[i].time());
+    out.emplace_back(m_values.time(i));
   }
 
   return out;
@@ -1093,9 +1091,9 @@ TimeSeriesProperty<TYPE>::filteredTimesAsVector() const {
 
   std::vector<DateAndTime> out;
 
-  for (const auto &value : m_values) {
-    if (isTimeFiltered(value.time())) {
-      out.emplace_back(value.time());
+  for (size_t i = 0; i < m_values.size(); i++) {
+    if (isTimeFiltered(m_values.time(i))) {
+      out.emplace_back(m_values.time(i));
     }
   }
 
@@ -1115,10 +1113,10 @@ std::vector<double> TimeSeriesProperty<TYPE>::timesAsVectorSeconds() const {
   std::vector<double> out;
   out.reserve(m_values.size());
 
-  Types::Core::DateAndTime start = m_values[0].time();
+  Types::Core::DateAndTime start = m_values.time(0);
   for (size_t i = 0; i < m_values.size(); i++) {
     out.emplace_back(
-        DateAndTime::secondsFromDuration(m_values[i].time() - start));
+        DateAndTime::secondsFromDuration(m_values.time(i) - start));
   }
 
   return out;
@@ -1132,9 +1130,8 @@ std::vector<double> TimeSeriesProperty<TYPE>::timesAsVectorSeconds() const {
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::addValue(const Types::Core::DateAndTime &time,
                                         const TYPE value) {
-  TimeValueUnit<TYPE> newvalue(time, value);
   // Add the value to the back of the vector
-  m_values.emplace_back(newvalue);
+  m_values.emplace_back(time, value);
   // Increment the separate record of the property's size
   m_size++;
 
@@ -1145,11 +1142,11 @@ void TimeSeriesProperty<TYPE>::addValue(const Types::Core::DateAndTime &time,
     // First item, must be sorted.
     m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   } else if (m_propSortedFlag == TimeSeriesSortStatus::TSUNKNOWN &&
-             m_values.back() < *(m_values.rbegin() + 1)) {
+             m_values.lastTime() < m_values.time(m_values.size() - 2)) {
     // Previously unknown and still unknown
     m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
   } else if (m_propSortedFlag == TimeSeriesSortStatus::TSSORTED &&
-             m_values.back() < *(m_values.rbegin() + 1)) {
+             m_values.lastTime() < m_values.time(m_values.size() - 2)) {
     // Previously sorted but last added is not in order
     m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
   }
@@ -1202,6 +1199,30 @@ void TimeSeriesProperty<TYPE>::addValues(
     m_propSortedFlag = TimeSeriesSortStatus::TSUNKNOWN;
 }
 
+/**
+ * Add the entries [first, last) of another property at the end. The entries
+ * are shared with the other property, rather than copied, when this property
+ * is empty or already ends with the entry before first.
+ * @param source :: the property to take the entries from; must be sorted
+ * @param first :: index of the first entry to add
+ * @param last :: index after the last entry to add
+ */
+template <typename TYPE>
+void TimeSeriesProperty<TYPE>::appendEntries(
+    const TimeSeriesProperty<TYPE> &source, size_t first, size_t last) {
+  if (first >= last)
+    return;
+  if (m_values.empty()) {
+    m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
+  } else if (m_propSortedFlag != TimeSeriesSortStatus::TSUNSORTED &&
+             source.m_values.time(first) < m_values.lastTime()) {
+    m_propSortedFlag = TimeSeriesSortStatus::TSUNSORTED;
+  }
+  m_values.append(source.m_values, first, last);
+  m_size += static_cast<int>(last - first);
+  m_filterApplied = false;
+}
+
 /** replace vectors of values to the map. First we clear the vectors
  * and then we run addValues
  *  @param times :: The time as a boost::posix_time::ptime value
@@ -1230,7 +1251,7 @@ DateAndTime TimeSeriesProperty<TYPE>::lastTime() const {
 
   sortIfNecessary();
 
-  return m_values.rbegin()->time();
+  return m_values.lastTime();
 }
 
 /** Returns the first value regardless of filter
@@ -1246,7 +1267,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::firstValue() const {
 
   sortIfNecessary();
 
-  return m_values[0].value();
+  return m_values.value(0);
 }
 
 /** Returns the first time regardless of filter
@@ -1263,7 +1284,7 @@ DateAndTime TimeSeriesProperty<TYPE>::firstTime() const {
 
   sortIfNecessary();
 
-  return m_values[0].time();
+  return m_values.time(0);
 }
 
 /**
@@ -1280,19 +1301,15 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::lastValue() const {
 
   sortIfNecessary();
 
-  return m_values.rbegin()->value();
+  return m_values.lastValue();
 }
 
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::minValue() const {
-  return std::min_element(m_values.begin(), m_values.end(),
-                          TimeValueUnit<TYPE>::valueCmp)
-      ->value();
+  return *std::min_element(m_values.beginValues(), m_values.endValues());
 }
 
 template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::maxValue() const {
-  return std::max_element(m_values.begin(), m_values.end(),
-                          TimeValueUnit<TYPE>::valueCmp)
-      ->value();
+  return *std::max_element(m_values.beginValues(), m_values.endValues());
 }
 
 template <typename TYPE> double TimeSeriesProperty<TYPE>::mean() const {
@@ -1325,8 +1342,8 @@ template <typename TYPE> std::string TimeSeriesProperty<TYPE>::value() const {
   std::stringstream ins;
   for (size_t i = 0; i < m_values.size(); i++) {
     try {
-      ins << m_values[i].time().toSimpleString();
-      ins << "  " << m_values[i].value() << "\n";
+      ins << m_values.time(i).toSimpleString();
+      ins << "  " << m_values.value(i) << "\n";
     } catch (...) {
       // Some kind of error; for example, invalid year, can occur when
       // converting boost time.
@@ -1351,7 +1368,7 @@ std::vector<std::string> TimeSeriesProperty<TYPE>::time_tValue() const {
 
   for (size_t i = 0; i < m_values.size(); i++) {
     std::stringstream line;
-    line << m_values[i].time().toSimpleString() << " " << m_values[i].value();
+    line << m_values.time(i).toSimpleString() << " " << m_values.value(i);
     values.emplace_back(line.str());
   }
 
@@ -1376,14 +1393,14 @@ std::map<DateAndTime, TYPE> TimeSeriesProperty<TYPE>::valueAsMap() const {
   if (m_values.empty())
     return asMap;
 
-  TYPE d = m_values[0].value();
-  asMap[m_values[0].time()] = d;
+  TYPE d = m_values.value(0);
+  asMap[m_values.time(0)] = d;
 
   for (size_t i = 1; i < m_values.size(); i++) {
-    if (m_values[i].value() != d) {
+    if (m_values.value(i) != d) {
       // Only put entry with different value from last entry to map
-      asMap[m_values[i].time()] = m_values[i].value();
-      d = m_values[i].value();
+      asMap[m_values.time(i)] = m_values.value(i);
+      d = m_values.value(i);
     }
   }
   return asMap;
@@ -1445,9 +1462,10 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::clear() {
  */
 template <typename TYPE> void TimeSeriesProperty<TYPE>::clearOutdated() {
   if (realSize() > 1) {
-    auto lastValue = m_values.back();
+    const DateAndTime lastTime = m_values.lastTime();
+    const TYPE lastValue = m_values.lastValue();
     clear();
-    m_values.emplace_back(lastValue);
+    m_values.emplace_back(lastTime, lastValue);
     m_size = 1;
   }
 }
@@ -1499,8 +1517,7 @@ void TimeSeriesProperty<TYPE>::create(
 
   m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   for (std::size_t i = 0; i < num; i++) {
-    TimeValueUnit<TYPE> newentry(new_times[i], new_values[i]);
-    m_values.emplace_back(newentry);
+    m_values.emplace_back(new_times[i], new_values[i]);
     if (m_propSortedFlag == TimeSeriesSortStatus::TSSORTED && i > 0 &&
         new_times[i - 1] > new_times[i]) {
       // Status gets to unsorted
@@ -1531,12 +1548,12 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(
 
   // 2.
   TYPE value;
-  if (t < m_values[0].time()) {
+  if (t < m_values.time(0)) {
     // 1. Out side of lower bound
-    value = m_values[0].value();
-  } else if (t >= m_values.back().time()) {
+    value = m_values.value(0);
+  } else if (t >= m_values.lastTime()) {
     // 2. Out side of upper bound
-    value = m_values.back().value();
+    value = m_values.lastValue();
   } else {
     // 3. Within boundary
     int index = this->findIndex(t);
@@ -1554,7 +1571,7 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(
       throw std::logic_error(errss.str());
     }
 
-    value = m_values[static_cast<size_t>(index)].value();
+    value = m_values.value(static_cast<size_t>(index));
   }
 
   return value;
@@ -1580,13 +1597,13 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(const Types::Core::DateAndTime &t,
 
   // 2.
   TYPE value;
-  if (t < m_values[0].time()) {
+  if (t < m_values.time(0)) {
     // 1. Out side of lower bound
-    value = m_values[0].value();
+    value = m_values.value(0);
     index = 0;
-  } else if (t >= m_values.back().time()) {
+  } else if (t >= m_values.lastTime()) {
     // 2. Out side of upper bound
-    value = m_values.back().value();
+    value = m_values.lastValue();
     index = int(m_values.size()) - 1;
   } else {
     // 3. Within boundary
@@ -1605,7 +1622,7 @@ TYPE TimeSeriesProperty<TYPE>::getSingleValue(const Types::Core::DateAndTime &t,
       throw std::logic_error(errss.str());
     }
 
-    value = m_values[static_cast<size_t>(index)].value();
+    value = m_values.value(static_cast<size_t>(index));
   }
 
   return value;
@@ -1647,14 +1664,14 @@ TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
     } else if (n == static_cast<int>(m_values.size()) - 1) {
       // 2. Last one by making up an end time.
       time_duration d =
-          m_values.rbegin()->time() - (m_values.rbegin() + 1)->time();
-      DateAndTime endTime = m_values.rbegin()->time() + d;
-      Kernel::TimeInterval dt(m_values.rbegin()->time(), endTime);
+          m_values.lastTime() - m_values.time(m_values.size() - 2);
+      DateAndTime endTime = m_values.lastTime() + d;
+      Kernel::TimeInterval dt(m_values.lastTime(), endTime);
       deltaT = dt;
     } else {
       // 3. Regular
-      DateAndTime startT = m_values[static_cast<std::size_t>(n)].time();
-      DateAndTime endT = m_values[static_cast<std::size_t>(n) + 1].time();
+      DateAndTime startT = m_values.time(static_cast<std::size_t>(n));
+      DateAndTime endT = m_values.time(static_cast<std::size_t>(n) + 1);
       TimeInterval dt(startT, endT);
       deltaT = dt;
     }
@@ -1670,8 +1687,8 @@ TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
       // 2. n = size of the allowed region, duplicate the last one
       auto ind_t1 = static_cast<long>(m_filterQuickRef.back().first);
       long ind_t2 = ind_t1 - 1;
-      Types::Core::DateAndTime t1 = (m_values.begin() + ind_t1)->time();
-      Types::Core::DateAndTime t2 = (m_values.begin() + ind_t2)->time();
+      Types::Core::DateAndTime t1 = m_values.time(ind_t1);
+      Types::Core::DateAndTime t2 = m_values.time(ind_t2);
       time_duration d = t1 - t2;
       Types::Core::DateAndTime t3 = t1 + d;
       Kernel::TimeInterval dt(t1, t3);
@@ -1694,7 +1711,7 @@ TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
           m_filter[m_filterQuickRef[refindex].first].first;
       size_t iStartIndex =
           m_filterQuickRef[refindex + 1].first + static_cast<size_t>(diff);
-      Types::Core::DateAndTime ltime0 = m_values[iStartIndex].time();
+      Types::Core::DateAndTime ltime0 = m_values.time(iStartIndex);
       if (iStartIndex == 0 && ftime0 < ltime0) {
         // a) Special case that True-filter time starts before log time
         t0 = ltime0;
@@ -1716,7 +1733,7 @@ TimeInterval TimeSeriesProperty<TYPE>::nthInterval(int n) const {
         tf = ftimef;
       } else {
         // b) Using the earlier value of next log entry and next filter entry
-        Types::Core::DateAndTime ltimef = m_values[iStopIndex].time();
+        Types::Core::DateAndTime ltimef = m_values.time(iStopIndex);
         Types::Core::DateAndTime ftimef =
             m_filter[m_filterQuickRef[refindex + 3].first].first;
         if (ltimef < ftimef)
@@ -1756,12 +1773,9 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::nthValue(int n) const {
   if (m_filter.empty()) {
     // 3. Situation 1:  No filter
     if (static_cast<size_t>(n) < m_values.size()) {
-      TimeValueUnit<TYPE> entry = m_values[static_cast<std::size_t>(n)];
-      value = entry.value();
+      value = m_values.value(static_cast<std::size_t>(n));
     } else {
-      TimeValueUnit<TYPE> entry =
-          m_values[static_cast<std::size_t>(m_size) - 1];
-      value = entry.value();
+      value = m_values.value(static_cast<std::size_t>(m_size) - 1);
     }
   } else {
     // 4. Situation 2: There is filter
@@ -1770,7 +1784,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::nthValue(int n) const {
     if (static_cast<size_t>(n) > m_filterQuickRef.back().second + 1) {
       // 1. n >= size of the allowed region
       size_t ilog = (m_filterQuickRef.rbegin() + 1)->first;
-      value = m_values[ilog].value();
+      value = m_values.value(ilog);
     } else {
       // 2. n < size
       Types::Core::DateAndTime t0;
@@ -1783,7 +1797,7 @@ template <typename TYPE> TYPE TimeSeriesProperty<TYPE>::nthValue(int n) const {
       size_t ilog =
           m_filterQuickRef[refindex + 1].first +
           (static_cast<std::size_t>(n) - m_filterQuickRef[refindex].second);
-      value = m_values[ilog].value();
+      value = m_values.value(ilog);
     } // END-IF-ELSE Cases
   }
 
@@ -1809,7 +1823,7 @@ Types::Core::DateAndTime TimeSeriesProperty<TYPE>::nthTime(int n) const {
   if (n < 0 || n >= static_cast<int>(m_values.size()))
     n = static_cast<int>(m_values.size()) - 1;
 
-  return m_values[static_cast<size_t>(n)].time();
+  return m_values.time(static_cast<size_t>(n));
 }
 
 /* Divide the property into  allowed and disallowed time intervals according to
@@ -1867,12 +1881,12 @@ void TimeSeriesProperty<TYPE>::filterWith(
   // 2b) Get a clean finish
   if (filtervalues.back()) {
     DateAndTime lastTime, nextLastT;
-    if (m_values.back().time() > filtertimes.back()) {
+    if (m_values.lastTime() > filtertimes.back()) {
       const size_t nvalues(m_values.size());
       // Last log time is later than last filter time
-      lastTime = m_values.back().time();
-      if (nvalues > 1 && m_values[nvalues - 2].time() > filtertimes.back())
-        nextLastT = m_values[nvalues - 2].time();
+      lastTime = m_values.lastTime();
+      if (nvalues > 1 && m_values.time(nvalues - 2) > filtertimes.back())
+        nextLastT = m_values.time(nvalues - 2);
       else
         nextLastT = filtertimes.back();
     } else {
@@ -1883,10 +1897,10 @@ void TimeSeriesProperty<TYPE>::filterWith(
       // this
       // else it is the last value time
       if (nfilterValues > 1 &&
-          m_values.back().time() > filtertimes[nfilterValues - 2])
+          m_values.lastTime() > filtertimes[nfilterValues - 2])
         nextLastT = filtertimes[nfilterValues - 2];
       else
-        nextLastT = m_values.back().time();
+        nextLastT = m_values.lastTime();
     }
 
     time_duration dtime = lastTime - nextLastT;
@@ -2014,27 +2028,23 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::eliminateDuplicates() {
   // 2. Detect and Remove Duplicated
   size_t numremoved = 0;
 
-  typename std::vector<TimeValueUnit<TYPE>>::iterator vit;
-  vit = m_values.begin() + 1;
-  Types::Core::DateAndTime prevtime = m_values.begin()->time();
-  while (vit != m_values.end()) {
-    Types::Core::DateAndTime currtime = vit->time();
-    if (prevtime == currtime) {
+  // Of the entries with the same time, keep the last one
+  TimeSeriesColumns<TYPE> unique;
+  unique.reserve(m_values.size());
+  for (size_t i = 0; i < m_values.size(); ++i) {
+    if (i + 1 < m_values.size() &&
+        m_values.nanoseconds(i) == m_values.nanoseconds(i + 1)) {
       // Print out warning
-      g_log.debug() << "Entry @ Time = " << prevtime
+      g_log.debug() << "Entry @ Time = " << m_values.time(i)
                     << "has duplicate time stamp.  Remove entry with Value = "
-                    << (vit - 1)->value() << "\n";
-
-      // A duplicated entry!
-      vit = m_values.erase(vit - 1);
-
+                    << m_values.value(i) << "\n";
       numremoved++;
+    } else {
+      unique.emplace_back(m_values.time(i), m_values.value(i));
     }
-
-    // b) progress
-    prevtime = currtime;
-    ++vit;
   }
+  if (numremoved > 0)
+    m_values = unique;
 
   // update m_size
   countSize();
@@ -2052,7 +2062,7 @@ template <typename TYPE>
 std::string TimeSeriesProperty<TYPE>::toString() const {
   std::stringstream ss;
   for (size_t i = 0; i < m_values.size(); ++i)
-    ss << m_values[i].time() << "\t\t" << m_values[i].value() << "\n";
+    ss << m_values.time(i) << "\t\t" << m_values.value(i) << "\n";
 
   return ss.str();
 }
@@ -2069,7 +2079,7 @@ std::string TimeSeriesProperty<TYPE>::toString() const {
 template <typename TYPE>
 void TimeSeriesProperty<TYPE>::sortIfNecessary() const {
   if (m_propSortedFlag == TimeSeriesSortStatus::TSUNKNOWN) {
-    bool sorted = is_sorted(m_values.begin(), m_values.end());
+    bool sorted = m_values.isSorted();
     if (sorted)
       m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
     else
@@ -2079,7 +2089,7 @@ void TimeSeriesProperty<TYPE>::sortIfNecessary() const {
   if (m_propSortedFlag == TimeSeriesSortStatus::TSUNSORTED) {
     g_log.information(
         "TimeSeriesProperty is not sorted.  Sorting is operated on it. ");
-    std::stable_sort(m_values.begin(), m_values.end());
+    m_values.sort();
     m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   }
 }
@@ -2100,19 +2110,15 @@ int TimeSeriesProperty<TYPE>::findIndex(Types::Core::DateAndTime t) const {
   sortIfNecessary();
 
   // 2. Extreme value
-  if (t <= m_values[0].time()) {
+  if (t <= m_values.time(0)) {
     return -1;
-  } else if (t >= m_values.back().time()) {
+  } else if (t >= m_values.lastTime()) {
     return (int(m_values.size()));
   }
 
   // 3. Find by lower_bound()
-  typename std::vector<TimeValueUnit<TYPE>>::const_iterator fid;
-  TimeValueUnit<TYPE> temp(t, m_values[0].value());
-  fid = std::lower_bound(m_values.begin(), m_values.end(), temp);
-
-  int newindex = int(fid - m_values.begin());
-  if (fid->time() > t)
+  int newindex = int(m_values.lowerBound(t, 0, m_values.size()));
+  if (m_values.time(newindex) > t)
     newindex--;
 
   return newindex;
@@ -2139,27 +2145,21 @@ int TimeSeriesProperty<TYPE>::upperBound(Types::Core::DateAndTime t, int istart,
   }
 
   // 1. Return instantly if it is out of boundary
-  if (t < (m_values.begin() + istart)->time()) {
+  if (t < m_values.time(istart)) {
     return -1;
   }
-  if (t > (m_values.begin() + iend)->time()) {
+  if (t > m_values.time(iend)) {
     return static_cast<int>(m_values.size());
   }
 
   // 2. Sort
   sortIfNecessary();
 
-  // 3. Construct the pair for comparison and do lower_bound()
-  TimeValueUnit<TYPE> temppair(t, m_values[0].value());
-  typename std::vector<TimeValueUnit<TYPE>>::iterator fid;
-  fid = std::lower_bound((m_values.begin() + istart),
-                         (m_values.begin() + iend + 1), temppair);
-  if (fid == m_values.end())
+  // 3. Do lower_bound()
+  size_t index = m_values.lowerBound(t, istart, iend + 1);
+  if (index == m_values.size())
     throw std::runtime_error("Cannot find data");
 
-  // 4. Calculate return value
-  size_t index = size_t(fid - m_values.begin());
-
   return int(index);
 }
 
@@ -2218,7 +2218,7 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::applyFilter() const {
           numintervals = m_filterQuickRef.back().second;
         }
         if (m_filter[ift].first <
-            m_values[static_cast<std::size_t>(icurlog)].time()) {
+            m_values.time(static_cast<std::size_t>(icurlog))) {
           if (icurlog == 0) {
             throw std::logic_error("In this case, icurlog won't be zero! ");
           }
@@ -2455,12 +2455,12 @@ void TimeSeriesProperty<TYPE>::histogramData(
 
   double dt = (t1 - t0) / static_cast<double>(nPoints);
 
-  for (auto &ev : m_values) {
-    auto time = static_cast<double>(ev.time().totalNanoseconds());
+  for (size_t i = 0; i < m_values.size(); ++i) {
+    auto time = static_cast<double>(m_values.nanoseconds(i));
     if (time < t0 || time >= t1)
       continue;
     auto ind = static_cast<size_t>((time - t0) / dt);
-    counts[ind] += static_cast<double>(ev.value());
+    counts[ind] += static_cast<double>(m_values.value(i));
   }
 }
 
@@ -2492,9 +2492,9 @@ std::vector<TYPE> TimeSeriesProperty<TYPE>::filteredValuesAsVector() const {
   sortIfNecessary();
 
   std::vector<TYPE> filteredValues;
-  for (const auto &value : m_values) {
-    if (isTimeFiltered(value.time())) {
-      filteredValues.emplace_back(value.value());
+  for (size_t i = 0; i < m_values.size(); ++i) {
+    if (isTimeFiltered(m_values.time(i))) {
+      filteredValues.emplace_back(m_values.value(i));
     }
   }
 
@@ -11,11 +11,19 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/UnitLabelTypes.h"
+#include <algorithm>
+#include <array>
 #include <cfloat>
 
 namespace Mantid {
 namespace Kernel {
 
+namespace {
+/// Number of values converted at a time by Unit::convertViaTOF, few enough
+/// for them to stay in the cache between the conversion to TOF and back
+constexpr size_t CONVERSION_BLOCK_SIZE = 1024;
+} // namespace
+
 /**
  * Default constructor
  * Gives the unit an empty UnitLabel
@@ -138,9 +146,7 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                  const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->multipleToTOF(xdata.data(), xdata.data() + xdata.size());
 }
 
 /** Convert a single value to TOF
@@ -169,9 +175,7 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                    const double &_efixed, const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->multipleFromTOF(xdata.data(), xdata.data() + xdata.size());
 }
 
 /** Convert a single value from TOF
@@ -191,6 +195,58 @@ double Unit::convertSingleFromTOF(const double xvalue, const double &l1,
   return this->singleFromTOF(xvalue);
 }
 
+void Unit::multipleToTOF(double *first, double *last) const {
+  for (; first != last; ++first)
+    *first = this->singleToTOF(*first);
+}
+
+void Unit::multipleFromTOF(double *first, double *last) const {
+  for (; first != last; ++first)
+    *first = this->singleFromTOF(*first);
+}
+
+/** Convert values of this unit to another unit through TOF, in place. The
+ * values are converted in blocks, each block to TOF and then to the
+ * destination unit, so that they are read from memory only once.
+ * Both units must be initialized.
+ * @param destination :: The unit to convert to
+ * @param first :: pointer to the first value
+ * @param last :: pointer past the last value
+ */
+void Unit::convertViaTOF(const Unit &destination, double *first,
+                         double *last) const {
+  while (first != last) {
+    const auto blockSize = std::min(CONVERSION_BLOCK_SIZE,
+                                    static_cast<size_t>(last - first));
+    this->multipleToTOF(first, first + blockSize);
+    destination.multipleFromTOF(first, first + blockSize);
+    first += blockSize;
+  }
+}
+
+/** Convert single precision values of this unit to another unit through TOF,
+ * in place. The conversion itself is done in double precision.
+ * Both units must be initialized.
+ * @param destination :: The unit to convert to
+ * @param first :: pointer to the first value
+ * @param last :: pointer past the last value
+ */
+void Unit::convertViaTOF(const Unit &destination, float *first,
+                         float *last) const {
+  std::array<double, CONVERSION_BLOCK_SIZE> block;
+  while (first != last) {
+    const auto blockSize = std::min(CONVERSION_BLOCK_SIZE,
+                                    static_cast<size_t>(last - first));
+    const auto blockEnd = block.data() + blockSize;
+    std::copy(first, first + blockSize, block.data());
+    this->multipleToTOF(block.data(), blockEnd);
+    destination.multipleFromTOF(block.data(), blockEnd);
+    std::transform(block.data(), blockEnd, first,
+                   [](const double x) { return static_cast<float>(x); });
+    first += blockSize;
+  }
+}
+
 std::pair<double, double> Unit::conversionRange() const {
   double u1 = this->singleFromTOF(this->conversionTOFMin());
   double u2 = this->singleFromTOF(this->conversionTOFMax());
@@ -287,6 +343,18 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+void TOF::multipleToTOF(double *first, double *last) const {
+  // Nothing to do
+  UNUSED_ARG(first);
+  UNUSED_ARG(last);
+}
+
+void TOF::multipleFromTOF(double *first, double *last) const {
+  // Nothing to do
+  UNUSED_ARG(first);
+  UNUSED_ARG(last);
+}
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -388,6 +456,24 @@ double Wavelength::singleFromTOF(const double tof) const {
   x *= factorFrom;
   return x;
 }
+void Wavelength::multipleToTOF(double *first, double *last) const {
+  if (emode == 1 || emode == 2) {
+    for (; first != last; ++first)
+      *first = *first * factorTo + sfpTo;
+  } else {
+    for (; first != last; ++first)
+      *first *= factorTo;
+  }
+}
+void Wavelength::multipleFromTOF(double *first, double *last) const {
+  if (do_sfpFrom) {
+    for (; first != last; ++first)
+      *first = (*first - sfpFrom) * factorFrom;
+  } else {
+    for (; first != last; ++first)
+      *first *= factorFrom;
+  }
+}
 ///@return  Minimal time of flight, which can be reversively converted into
 /// wavelength
 double Wavelength::conversionTOFMin() const {
@@ -464,6 +550,22 @@ double Energy::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+void Energy::multipleToTOF(double *first, double *last) const {
+  for (; first != last; ++first) {
+    // Protect against divide by zero
+    const double temp = *first == 0.0 ? DBL_MIN : *first;
+    *first = factorTo / sqrt(temp);
+  }
+}
+
+void Energy::multipleFromTOF(double *first, double *last) const {
+  for (; first != last; ++first) {
+    // Protect against divide by zero
+    const double temp = *first == 0.0 ? DBL_MIN : *first;
+    *first = factorFrom / (temp * temp);
+  }
+}
+
 Unit *Energy::clone() const { return new Energy(*this); }
 
 // ============================================================================================
@@ -570,6 +672,14 @@ double dSpacing::singleToTOF(const double x) const { return x * factorTo; }
 double dSpacing::singleFromTOF(const double tof) const {
   return tof / factorFrom;
 }
+void dSpacing::multipleToTOF(double *first, double *last) const {
+  for (; first != last; ++first)
+    *first *= factorTo;
+}
+void dSpacing::multipleFromTOF(double *first, double *last) const {
+  for (; first != last; ++first)
+    *first /= factorFrom;
+}
 double dSpacing::conversionTOFMin() const { return 0; }
 double dSpacing::conversionTOFMax() const { return DBL_MAX / factorTo; }
 
@@ -681,6 +791,22 @@ double MomentumTransfer::singleFromTOF(const double tof) const {
   return factorFrom / temp;
 }
 
+void MomentumTransfer::multipleToTOF(double *first, double *last) const {
+  for (; first != last; ++first) {
+    // Protect against divide by zero
+    const double temp = *first == 0.0 ? DBL_MIN : *first;
+    *first = factorTo / temp;
+  }
+}
+
+void MomentumTransfer::multipleFromTOF(double *first, double *last) const {
+  for (; first != last; ++first) {
+    // Protect against divide by zero
+    const double temp = *first == 0.0 ? DBL_MIN : *first;
+    *first = factorFrom / temp;
+  }
+}
+
 double MomentumTransfer::conversionTOFMin() const {
   return factorFrom / DBL_MAX;
 }
@@ -854,6 +980,42 @@ double DeltaE::singleFromTOF(const double tof) const {
     return DBL_MAX;
 }
 
+void DeltaE::multipleToTOF(double *first, double *last) const {
+  const double tofMax = DeltaE::conversionTOFMax();
+  if (emode == 1 || emode == 2) {
+    // efixed - x for the final energy (direct), efixed + x for the initial
+    // energy (indirect)
+    const double sign = emode == 1 ? -1. : 1.;
+    for (; first != last; ++first) {
+      const double e = efixed + sign * (*first / unitScaling);
+      // e <= 0 shouldn't ever happen (unless the efixed value is wrong)
+      *first = e <= 0.0 ? tofMax : factorTo / sqrt(e) + t_other;
+    }
+  } else {
+    std::fill(first, last, tofMax);
+  }
+}
+
+void DeltaE::multipleFromTOF(double *first, double *last) const {
+  if (emode == 1) {
+    for (; first != last; ++first) {
+      // This is t2
+      const double this_t = *first - t_otherFrom;
+      const double e2 = factorFrom / (this_t * this_t);
+      *first = this_t <= 0.0 ? -DBL_MAX : (efixed - e2) * unitScaling;
+    }
+  } else if (emode == 2) {
+    for (; first != last; ++first) {
+      // This is t1
+      const double this_t = *first - t_otherFrom;
+      const double e1 = factorFrom / (this_t * this_t);
+      *first = this_t <= 0.0 ? DBL_MAX : (e1 - efixed) * unitScaling;
+    }
+  } else {
+    std::fill(first, last, DBL_MAX);
+  }
+}
+
 double DeltaE::conversionTOFMin() const {
   double time(
       DBL_MAX); // impossible for elastic, this units do not work for elastic
@@ -1101,6 +1263,15 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
   return x;
 }
 
+void SpinEchoLength::multipleToTOF(double *first, double *last) const {
+  // Not the conversion of Wavelength
+  Unit::multipleToTOF(first, last);
+}
+
+void SpinEchoLength::multipleFromTOF(double *first, double *last) const {
+  Unit::multipleFromTOF(first, last);
+}
+
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
 // ============================================================================================
@@ -1146,6 +1317,15 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
   return x;
 }
 
+void SpinEchoTime::multipleToTOF(double *first, double *last) const {
+  // Not the conversion of Wavelength
+  Unit::multipleToTOF(first, last);
+}
+
+void SpinEchoTime::multipleFromTOF(double *first, double *last) const {
+  Unit::multipleFromTOF(first, last);
+}
+
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
 // ================================================================================
@@ -13,6 +13,7 @@
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidKernel/Timer.h"
 
 #include <Poco/Thread.h>
@@ -375,6 +376,10 @@ public:
     do_StressTest_scheduler(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_ThreadSchedulerWorkStealing() {
+    do_StressTest_scheduler(new ThreadSchedulerWorkStealing());
+  }
+
   //--------------------------------------------------------------------
   /** Perform a stress test on the given scheduler.
    * This one creates tasks that create new tasks; e.g. 10 tasks each add
@@ -413,6 +418,10 @@ public:
     do_StressTest_TasksThatCreateTasks(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_TasksThatCreateTasks_ThreadSchedulerWorkStealing() {
+    do_StressTest_TasksThatCreateTasks(new ThreadSchedulerWorkStealing());
+  }
+
   //=======================================================================================
   /** Task that throws an exception */
   class TaskThatThrows : public Task {
@@ -436,3 +445,89 @@ public:
     TS_ASSERT_EQUALS(ThreadPoolTest_TaskThatThrows_counter, 1);
   }
 };
+
+//=======================================================================================
+/** Task that adds tasks to its scheduler, down to a depth, like the splitting
+ * of an MDBox structure. Each task only does a little work. */
+class TaskThatSplits : public Task {
+public:
+  TaskThatSplits(ThreadScheduler *scheduler, size_t depth,
+                 std::atomic<size_t> &counter)
+      : Task(static_cast<double>(1 << (2 * (6 - depth)))),
+        m_scheduler(scheduler), m_depth(depth), m_counter(counter) {}
+
+  void run() override {
+    double x = 1.1;
+    for (int j = 0; j < 1000; j++)
+      x = x * x / 1.1;
+    m_counter += x > 0. ? 1 : 0;
+    if (m_depth < 6) {
+      for (size_t i = 0; i < 4; i++)
+        m_scheduler->push(std::make_shared<TaskThatSplits>(
+            m_scheduler, m_depth + 1, m_counter));
+    }
+  }
+
+private:
+  ThreadScheduler *m_scheduler;
+  size_t m_depth;
+  std::atomic<size_t> &m_counter;
+};
+
+class ThreadPoolTestPerformance : public CxxTest::TestSuite {
+public:
+  static ThreadPoolTestPerformance *createSuite() {
+    return new ThreadPoolTestPerformance();
+  }
+  static void destroySuite(ThreadPoolTestPerformance *suite) { delete suite; }
+
+  /// Many tiny independent tasks, all pushed before the threads start
+  void do_test_many_small_tasks(ThreadScheduler *sched,
+                                const std::string &name) {
+    ThreadPool p(sched, 0);
+    const size_t num = 1000000;
+    std::atomic<size_t> counter(0);
+    for (size_t i = 0; i < num; i++)
+      p.schedule(std::make_shared<FunctionTask>([&counter]() { ++counter; }));
+    Timer timer;
+    TS_ASSERT_THROWS_NOTHING(p.joinAll());
+    std::cout << "\n" << name << ": " << timer.elapsed() << " s to run " << num
+              << " small tasks on " << ThreadPool::getNumPhysicalCores()
+              << " threads.\n";
+    TS_ASSERT_EQUALS(counter.load(), num);
+  }
+
+  /// Tasks that add smaller tasks, like the splitting of boxes
+  void do_test_tasks_that_split(ThreadScheduler *sched,
+                                const std::string &name) {
+    ThreadPool p(sched, 0);
+    std::atomic<size_t> counter(0);
+    Timer timer;
+    for (size_t i = 0; i < 64; i++)
+      p.schedule(std::make_shared<TaskThatSplits>(sched, 0, counter));
+    TS_ASSERT_THROWS_NOTHING(p.joinAll());
+    std::cout << "\n" << name << ": " << timer.elapsed() << " s to run "
+              << counter << " splitting tasks on "
+              << ThreadPool::getNumPhysicalCores() << " threads.\n";
+    // 64 * (1 + 4 + ... + 4^6) tasks
+    TS_ASSERT_EQUALS(counter.load(), 64 * 5461);
+  }
+
+  void test_many_small_tasks_ThreadSchedulerFIFO() {
+    do_test_many_small_tasks(new ThreadSchedulerFIFO(), "FIFO");
+  }
+
+  void test_many_small_tasks_ThreadSchedulerWorkStealing() {
+    do_test_many_small_tasks(new ThreadSchedulerWorkStealing(),
+                             "WorkStealing");
+  }
+
+  void test_tasks_that_split_ThreadSchedulerFIFO() {
+    do_test_tasks_that_split(new ThreadSchedulerFIFO(), "FIFO");
+  }
+
+  void test_tasks_that_split_ThreadSchedulerWorkStealing() {
+    do_test_tasks_that_split(new ThreadSchedulerWorkStealing(),
+                             "WorkStealing");
+  }
+};
@@ -0,0 +1,98 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/Task.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+
+using namespace Mantid::Kernel;
+
+namespace {
+class TaskWithCost : public Task {
+public:
+  explicit TaskWithCost(double cost) : Task(cost) {}
+  void run() override {}
+};
+} // namespace
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  void test_push_and_clear() {
+    ThreadSchedulerWorkStealing sc(4);
+    TS_ASSERT_EQUALS(sc.numQueues(), 4);
+    TS_ASSERT(sc.empty());
+    sc.push(std::make_shared<TaskWithCost>(1.5));
+    sc.push(std::make_shared<TaskWithCost>(2.0));
+    TS_ASSERT_EQUALS(sc.size(), 2);
+    TS_ASSERT(!sc.empty());
+    TS_ASSERT_DELTA(sc.totalCost(), 3.5, 1e-12);
+    sc.clear();
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    TS_ASSERT(sc.empty());
+    TS_ASSERT_DELTA(sc.totalCost(), 0.0, 1e-12);
+    TS_ASSERT_DELTA(sc.totalCostExecuted(), 0.0, 1e-12);
+  }
+
+  void test_default_number_of_queues() {
+    ThreadSchedulerWorkStealing sc;
+    TS_ASSERT_LESS_THAN(0, sc.numQueues());
+  }
+
+  void test_outside_tasks_are_dealt_out_and_stolen() {
+    ThreadSchedulerWorkStealing sc(2);
+    auto task1 = std::make_shared<TaskWithCost>(1.0);
+    auto task2 = std::make_shared<TaskWithCost>(2.0);
+    auto task3 = std::make_shared<TaskWithCost>(3.0);
+    // This thread has not popped any task yet, so the tasks go to queues 0, 1
+    // and 0.
+    sc.push(task1);
+    sc.push(task2);
+    sc.push(task3);
+    // Thread 1 takes the only task of its own queue
+    TS_ASSERT_EQUALS(sc.pop(1), task2);
+    TS_ASSERT_DELTA(sc.totalCostExecuted(), 2.0, 1e-12);
+    // then steals the oldest tasks of queue 0
+    TS_ASSERT_EQUALS(sc.pop(1), task1);
+    TS_ASSERT_EQUALS(sc.pop(1), task3);
+    TS_ASSERT(!sc.pop(1));
+    TS_ASSERT_EQUALS(sc.numStolen(), 2);
+    TS_ASSERT(sc.empty());
+    // Like the other schedulers, the cost of all the tasks pushed
+    TS_ASSERT_DELTA(sc.totalCost(), 6.0, 1e-12);
+    TS_ASSERT_DELTA(sc.totalCostExecuted(), 6.0, 1e-12);
+  }
+
+  void test_own_queue_is_last_in_first_out() {
+    ThreadSchedulerWorkStealing sc(2);
+    auto first = std::make_shared<TaskWithCost>(1.0);
+    auto second = std::make_shared<TaskWithCost>(1.0);
+    // A thread that popped pushes to its own queue, like a running task
+    // adding subtasks
+    TS_ASSERT(!sc.pop(1));
+    sc.push(first);
+    sc.push(second);
+    TS_ASSERT_EQUALS(sc.pop(1), second);
+    TS_ASSERT_EQUALS(sc.pop(1), first);
+    TS_ASSERT_EQUALS(sc.numStolen(), 0);
+  }
+
+  void test_steals_from_the_most_expensive_queue() {
+    ThreadSchedulerWorkStealing sc(3);
+    auto cheap1 = std::make_shared<TaskWithCost>(1.0);
+    auto expensive = std::make_shared<TaskWithCost>(10.0);
+    auto cheap2 = std::make_shared<TaskWithCost>(1.0);
+    // Queues 0, 1 and 2
+    sc.push(cheap1);
+    sc.push(expensive);
+    sc.push(cheap2);
+    TS_ASSERT_EQUALS(sc.pop(2), cheap2);
+    TS_ASSERT_EQUALS(sc.pop(2), expensive);
+    TS_ASSERT_EQUALS(sc.numStolen(), 1);
+  }
+};
@@ -0,0 +1,142 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/TimeSeriesColumns.h"
+
+using namespace Mantid::Kernel;
+using Mantid::Types::Core::DateAndTime;
+
+class TimeSeriesColumnsTest : public CxxTest::TestSuite {
+public:
+  void test_entries_are_kept_in_order() {
+    TimeSeriesColumns<double> columns;
+    TS_ASSERT(columns.empty());
+    columns.emplace_back(DateAndTime(20), 2.0);
+    columns.emplace_back(DateAndTime(10), 1.0);
+    TS_ASSERT_EQUALS(columns.size(), 2);
+    TS_ASSERT_EQUALS(columns.time(0), DateAndTime(20));
+    TS_ASSERT_EQUALS(columns.value(1), 1.0);
+    TS_ASSERT_EQUALS(columns.lastTime(), DateAndTime(10));
+    TS_ASSERT_EQUALS(columns.memorySize(), 32);
+  }
+
+  void test_sort_keeps_the_order_of_equal_times() {
+    TimeSeriesColumns<int> columns;
+    columns.emplace_back(DateAndTime(30), 0);
+    columns.emplace_back(DateAndTime(10), 1);
+    columns.emplace_back(DateAndTime(30), 2);
+    columns.emplace_back(DateAndTime(20), 3);
+    TS_ASSERT(!columns.isSorted());
+    columns.sort();
+    TS_ASSERT(columns.isSorted());
+    const std::vector<int> expected{1, 3, 0, 2};
+    TS_ASSERT_EQUALS(columns.values(), expected);
+    TS_ASSERT_EQUALS(columns.lowerBound(DateAndTime(30), 0, 4), 2);
+    TS_ASSERT_EQUALS(columns.lowerBound(DateAndTime(40), 0, 4), 4);
+  }
+
+  void test_copies_share_the_columns_until_modified() {
+    TimeSeriesColumns<bool> columns;
+    columns.emplace_back(DateAndTime(10), true);
+    columns.emplace_back(DateAndTime(20), false);
+    auto copy = columns;
+    TS_ASSERT(copy.sharesStorageWith(columns));
+    copy.emplace_back(DateAndTime(30), true);
+    TS_ASSERT(!copy.sharesStorageWith(columns));
+    TS_ASSERT_EQUALS(columns.size(), 2);
+    TS_ASSERT_EQUALS(copy.size(), 3);
+    TS_ASSERT_EQUALS(copy.value(0), true);
+  }
+
+  void test_erasing_either_end_keeps_sharing_the_columns() {
+    TimeSeriesColumns<int> columns;
+    for (int i = 0; i < 5; ++i)
+      columns.emplace_back(DateAndTime(10 * i), i);
+    auto copy = columns;
+    copy.erase(0, 1);
+    copy.erase(3, 4);
+    copy.setFirstTime(DateAndTime(15));
+    TS_ASSERT(copy.sharesStorageWith(columns));
+    TS_ASSERT_EQUALS(copy.size(), 3);
+    TS_ASSERT_EQUALS(copy.time(0), DateAndTime(15));
+    TS_ASSERT_EQUALS(copy.value(0), 1);
+    TS_ASSERT_EQUALS(copy.lastValue(), 3);
+    TS_ASSERT_EQUALS(copy.lowerBound(DateAndTime(12), 0, 3), 0);
+    TS_ASSERT_EQUALS(copy.lowerBound(DateAndTime(16), 0, 3), 1);
+    TS_ASSERT_EQUALS(columns.time(1), DateAndTime(10));
+
+    // Adding an entry copies the window only
+    copy.emplace_back(DateAndTime(50), 7);
+    TS_ASSERT(!copy.sharesStorageWith(columns));
+    const std::vector<int> expected{1, 2, 3, 7};
+    TS_ASSERT_EQUALS(copy.values(), expected);
+    TS_ASSERT_EQUALS(copy.time(0), DateAndTime(15));
+    TS_ASSERT_EQUALS(columns.size(), 5);
+  }
+
+  void test_append_a_range() {
+    TimeSeriesColumns<int> columns;
+    for (int i = 0; i < 6; ++i)
+      columns.emplace_back(DateAndTime(10 * i), i);
+    TimeSeriesColumns<int> part;
+    part.append(columns, 1, 3);
+    part.append(columns, 3, 4);
+    TS_ASSERT(part.sharesStorageWith(columns));
+    TS_ASSERT_EQUALS(part.size(), 3);
+    TS_ASSERT_EQUALS(part.value(2), 3);
+    // Not following on: the entries are copied
+    part.append(columns, 5, 6);
+    TS_ASSERT(!part.sharesStorageWith(columns));
+    const std::vector<int> expected{1, 2, 3, 5};
+    TS_ASSERT_EQUALS(part.values(), expected);
+    TS_ASSERT_EQUALS(part.lastTime(), DateAndTime(50));
+  }
+
+  void test_append_to_itself() {
+    TimeSeriesColumns<int> columns;
+    columns.emplace_back(DateAndTime(10), 1);
+    columns.append(columns);
+    TS_ASSERT_EQUALS(columns.size(), 2);
+    TS_ASSERT_EQUALS(columns.value(1), 1);
+  }
+
+  void test_integral() {
+    TimeSeriesColumns<int> columns;
+    // 1 for 1s, 2 for 2s, 3 for 3s
+    columns.emplace_back(DateAndTime(0, 0), 1);
+    columns.emplace_back(DateAndTime(1, 0), 2);
+    columns.emplace_back(DateAndTime(3, 0), 3);
+    columns.emplace_back(DateAndTime(6, 0), 4);
+    TS_ASSERT_DELTA(columns.integral(0, 3), 14.0, 1e-12);
+    TS_ASSERT_DELTA(columns.integral(1, 2), 4.0, 1e-12);
+    TS_ASSERT_DELTA(columns.integral(2, 2), 0.0, 1e-12);
+
+    // Modifying the series updates the integral, but not that of a copy
+    const auto copy = columns;
+    columns.erase(0, 1);
+    TS_ASSERT_DELTA(columns.integral(0, 2), 13.0, 1e-12);
+    TS_ASSERT_DELTA(copy.integral(0, 3), 14.0, 1e-12);
+
+    // Moving the first time forward shortens the first interval
+    auto moved = copy;
+    moved.setFirstTime(DateAndTime(0, 500000000));
+    TS_ASSERT_DELTA(moved.integral(0, 3), 13.5, 1e-12);
+    TS_ASSERT_DELTA(moved.integral(1, 3), 13.0, 1e-12);
+  }
+
+  void test_clear() {
+    TimeSeriesColumns<std::string> columns;
+    columns.emplace_back(DateAndTime(10), "a");
+    const auto copy = columns;
+    columns.clear();
+    TS_ASSERT(columns.empty());
+    TS_ASSERT_EQUALS(copy.value(0), "a");
+  }
+};
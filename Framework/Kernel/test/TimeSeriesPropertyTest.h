@@ -708,6 +708,83 @@ public:
                      const Exception::NotImplementedError &);
   }
 
+  void test_averageValueInFilter_of_a_long_log() {
+    // Many entries per filter range, some of them at the same time
+    TimeSeriesProperty<int> log("intProp");
+    DateAndTime startTime("2007-11-30T16:17:00");
+    for (int i = 0; i < 1000; ++i)
+      log.addValue(startTime + 0.1 * (i - i % 7), i % 13);
+
+    TimeSplitterType filter;
+    filter.emplace_back(SplittingInterval(startTime - 5.0, startTime + 20.05));
+    filter.emplace_back(SplittingInterval(startTime + 30.0, startTime + 30.0));
+    filter.emplace_back(SplittingInterval(startTime + 42.3, startTime + 95.0));
+    filter.emplace_back(SplittingInterval(startTime + 98.0, startTime + 120.));
+
+    // Integrate the log value by value
+    const auto times = log.timesAsVector();
+    const auto values = log.valuesAsVector();
+    double numerator(0.), totalTime(0.);
+    for (const auto &interval : filter) {
+      totalTime += interval.duration();
+      for (size_t i = 0; i < times.size(); ++i) {
+        const DateAndTime from =
+            i == 0 ? std::min(interval.start(), times[0]) : times[i];
+        const DateAndTime to = i + 1 == times.size()
+                                   ? std::max(interval.stop(), times[i])
+                                   : times[i + 1];
+        const DateAndTime overlapStart = std::max(from, interval.start());
+        const DateAndTime overlapStop = std::min(to, interval.stop());
+        if (overlapStart < overlapStop)
+          numerator += DateAndTime::secondsFromDuration(overlapStop -
+                                                        overlapStart) *
+                       values[i];
+      }
+    }
+    TS_ASSERT_DELTA(log.averageValueInFilter(filter), numerator / totalTime,
+                    1e-10);
+  }
+
+  void test_copies_are_independent() {
+    auto dblLog = std::unique_ptr<TimeSeriesProperty<double>>(
+        createDoubleTSP());
+    auto copy = std::unique_ptr<TimeSeriesProperty<double>>(dblLog->clone());
+    TS_ASSERT_EQUALS(*copy, *dblLog);
+    // Modifying the copy leaves the original as it was
+    copy->addValue("2007-11-30T16:17:40", 1.0);
+    copy->filterByTime(DateAndTime("2007-11-30T16:17:05"),
+                       DateAndTime("2007-11-30T16:17:45"));
+    TS_ASSERT_EQUALS(dblLog->realSize(), 4);
+    TS_ASSERT_EQUALS(dblLog->firstTime(), DateAndTime("2007-11-30T16:17:00"));
+    TS_ASSERT_DELTA(dblLog->lastValue(), 10.55, 1e-12);
+    TS_ASSERT_EQUALS(copy->realSize(), 5);
+    TS_ASSERT_EQUALS(copy->firstTime(), DateAndTime("2007-11-30T16:17:05"));
+    TS_ASSERT_DELTA(copy->lastValue(), 1.0, 1e-12);
+    // and the other way around
+    dblLog->clear();
+    TS_ASSERT_EQUALS(copy->realSize(), 5);
+  }
+
+  void test_time_filtered_copy_leaves_the_original_unchanged() {
+    auto dblLog = std::unique_ptr<TimeSeriesProperty<double>>(
+        createDoubleTSP());
+    auto copy = std::unique_ptr<TimeSeriesProperty<double>>(dblLog->clone());
+    copy->filterByTime(DateAndTime("2007-11-30T16:17:05"),
+                       DateAndTime("2007-11-30T16:17:25"));
+    TS_ASSERT_EQUALS(copy->realSize(), 3);
+    TS_ASSERT_EQUALS(copy->firstTime(), DateAndTime("2007-11-30T16:17:05"));
+    TS_ASSERT_DELTA(copy->firstValue(), 9.99, 1e-12);
+    TS_ASSERT_DELTA(copy->lastValue(), 5.55, 1e-12);
+    TS_ASSERT_EQUALS(dblLog->realSize(), 4);
+    TS_ASSERT_EQUALS(dblLog->firstTime(), DateAndTime("2007-11-30T16:17:00"));
+
+    // Adding to the filtered copy keeps its first time
+    copy->addValue("2007-11-30T16:17:40", 1.0);
+    TS_ASSERT_EQUALS(copy->realSize(), 4);
+    TS_ASSERT_EQUALS(copy->firstTime(), DateAndTime("2007-11-30T16:17:05"));
+    TS_ASSERT_EQUALS(dblLog->realSize(), 4);
+  }
+
   //----------------------------------------------------------------------------
   void test_splitByTime_and_getTotalValue() {
     TimeSeriesProperty<int> *log = createIntegerTSP(12);
@@ -1516,7 +1516,65 @@ public:
     TS_ASSERT(check_vector_conversion(vec, 1.0));
   }
 
+  //----------------------------------------------------------------------
+  // Conversion of many values
+  //----------------------------------------------------------------------
+
+  void test_multiple_conversions_match_single_conversions() {
+    const std::vector<double> values{0.,   0.1,  0.5,   1.,     2.5,
+                                     7.,   100., 1000., 5000.,  20000.,
+                                     -1.5, 3.2,  1e-5,  12345., 0.75};
+    std::vector<Unit *> units{&tof, &lambda, &energy, &d,   &q,
+                              &dE,  &dEk,    &dEf,    &delta, &tau};
+    for (auto unit : units) {
+      for (int emode = 0; emode <= 2; ++emode) {
+        try {
+          unit->initialize(11.0, 2.5, 0.6, emode, 4.0, 0.0);
+        } catch (std::exception &) {
+          // Not every unit is defined for every energy mode
+          continue;
+        }
+        auto toTOF = values;
+        unit->multipleToTOF(toTOF.data(), toTOF.data() + toTOF.size());
+        auto fromTOF = values;
+        unit->multipleFromTOF(fromTOF.data(), fromTOF.data() + fromTOF.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+          TSM_ASSERT(unit->unitID(), sameValue(toTOF[i],
+                                               unit->singleToTOF(values[i])));
+          TSM_ASSERT(unit->unitID(),
+                     sameValue(fromTOF[i], unit->singleFromTOF(values[i])));
+        }
+      }
+    }
+  }
+
+  void test_convertViaTOF() {
+    lambda.initialize(11.0, 2.5, 0.6, 0, 0.0, 0.0);
+    d.initialize(11.0, 2.5, 0.6, 0, 0.0, 0.0);
+    // More values than are converted at a time
+    std::vector<double> values(3000);
+    std::vector<float> floatValues(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = 0.5 + 0.001 * static_cast<double>(i);
+      floatValues[i] = static_cast<float>(values[i]);
+    }
+    auto expected = values;
+    lambda.convertViaTOF(d, values.data(), values.data() + values.size());
+    lambda.convertViaTOF(d, floatValues.data(),
+                         floatValues.data() + floatValues.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      const double x = d.singleFromTOF(lambda.singleToTOF(expected[i]));
+      TS_ASSERT_EQUALS(values[i], x);
+      TS_ASSERT_DELTA(floatValues[i], x, 1e-6 * x);
+    }
+  }
+
 private:
+  /// @return true if the values are equal or both NaN
+  static bool sameValue(const double lhs, const double rhs) {
+    return lhs == rhs || (std::isnan(lhs) && std::isnan(rhs));
+  }
+
   Units::Label label;
   Units::TOF tof;
   Units::Wavelength lambda;
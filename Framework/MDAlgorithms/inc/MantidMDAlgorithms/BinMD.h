@@ -85,6 +85,8 @@ private:
   signal_t *errors;
   signal_t *numEvents;
   bool m_accumulate{false};
+  /// Only events with at least this run index are binned
+  uint16_t m_firstRunIndex{0};
 };
 
 } // namespace MDAlgorithms
@@ -48,11 +48,13 @@ protected:
 private:
   // function runs the conversion on
   size_t conversionChunk(size_t workspaceIndex) override;
+  size_t conversionChunk(size_t workspaceIndex, MDTransfInterface &qConverter);
   // the pointer to the source event workspace as event ws does not work through
   // the public Matrix WS interface
   /**function converts particular type of events into MD space and add these
    * events to the workspace itself    */
-  template <class T> size_t convertEventList(size_t workspaceIndex);
+  template <class T>
+  size_t convertEventList(size_t workspaceIndex, MDTransfInterface &qConverter);
 
   virtual void appendEventsFromInputWS(API::Progress *pProgress,
                                        const API::BoxController_sptr &bc);
@@ -7,7 +7,6 @@
 #pragma once
 
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
-#include "MantidMDAlgorithms/MDEventTreeBuilder.h"
 #include <mutex>
 #include <queue>
 #include <thread>
@@ -177,36 +176,17 @@ std::vector<MDEventType<ND>> ConvToMDEventsWSIndexing::convertEvents() {
 template <typename EventType, size_t ND, template <size_t> class MDEventType>
 void ConvToMDEventsWSIndexing::appendEvents(API::Progress *pProgress,
                                             const API::BoxController_sptr &bc) {
-  bc->clearBoxesCounter(1);
-  bc->clearGridBoxesCounter(0);
+  UNUSED_ARG(bc);
   pProgress->resetNumSteps(2, 0, 1);
 
   std::vector<MDEventType<ND>> mdEvents =
       convertEvents<EventType, ND, MDEventType>();
-
-  morton_index::MDSpaceBounds<ND> space;
-  const auto &pws = m_OutWSWrapper->pWorkspace();
-  for (size_t ax = 0; ax < ND; ++ax) {
-    space(ax, 0) = pws->getDimension(ax)->getMinimum();
-    space(ax, 1) = pws->getDimension(ax)->getMaximum();
-  }
-
   pProgress->report(0);
 
-  auto nThreads = numWorkers();
-  using EventDistributor =
-      MDEventTreeBuilder<ND, MDEventType,
-                         typename std::vector<MDEventType<ND>>::iterator>;
-  EventDistributor distributor(nThreads, mdEvents.size() / nThreads / 10, bc,
-                               space);
-
-  auto rootAndErr = distributor.distribute(mdEvents);
-  m_OutWSWrapper->pWorkspace()->setBox(rootAndErr.root);
-  rootAndErr.root->calculateGridCaches();
-
-  std::stringstream ss;
-  ss << rootAndErr.err;
-  g_Log.information("Error with using Morton indexes is:\n" + ss.str());
+  auto pws = std::dynamic_pointer_cast<
+      DataObjects::MDEventWorkspace<MDEventType<ND>, ND>>(
+      m_OutWSWrapper->pWorkspace());
+  pws->buildFromEvents(mdEvents, numWorkers());
   pProgress->report(1);
 }
 
@@ -52,9 +52,11 @@ private:
 
   template <class T>
   void convertEventList(int workspaceIndex, const API::SpectrumInfo &specInfo,
-                        DataObjects::EventList &el);
+                        DataObjects::EventList &el,
+                        std::vector<DataObjects::MDLeanEvent<3>> &events);
 
-  void convertSpectrum(const API::SpectrumInfo &specInfo, int workspaceIndex);
+  void convertSpectrum(const API::SpectrumInfo &specInfo, int workspaceIndex,
+                       std::vector<DataObjects::MDLeanEvent<3>> &events);
 
   /// The input MatrixWorkspace
   API::MatrixWorkspace_sptr m_inWS;
@@ -9,6 +9,7 @@
 #include "MantidAPI/Algorithm.h"
 #include "MantidAPI/CompositeFunction.h"
 #include "MantidAPI/IMDEventWorkspace_fwd.h"
+#include "MantidAPI/Progress.h"
 #include "MantidDataObjects/MDEventWorkspace.h"
 #include "MantidDataObjects/PeaksWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
@@ -55,6 +56,13 @@ private:
   template <typename MDE, size_t nd>
   void integrate(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Integrate spheres in batches of neighbouring spheres
+  template <typename MDE, size_t nd>
+  void integrateSpheres(
+      typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws,
+      const std::vector<DataObjects::IntegrationSphere *> &spheres,
+      const bool useOnePercentBackgroundCorrection, API::Progress &progress);
+
   /// Input MDEventWorkspace
   Mantid::API::IMDEventWorkspace_sptr inWS;
 
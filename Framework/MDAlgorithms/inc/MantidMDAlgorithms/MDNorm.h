@@ -7,7 +7,9 @@
 #pragma once
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidAPI/ExperimentInfo.h"
 #include "MantidGeometry/Crystal/SymmetryOperationFactory.h"
+#include "MantidKernel/ZeroedAllocator.h"
 #include "MantidMDAlgorithms/DllConfig.h"
 #include "MantidMDAlgorithms/SlicingAlgorithm.h"
 
@@ -46,9 +48,12 @@ private:
   getValuesFromOtherDimensions(bool &skipNormalization,
                                uint16_t expInfoIndex = 0) const;
   void cacheDimensionXValues();
-  void calculateNormalization(const std::vector<coord_t> &otherValues,
-                              const Geometry::SymmetryOperation &so,
-                              uint16_t expInfoIndex, size_t soIndex);
+  void cacheDetectors(const API::ExperimentInfo_const_sptr &exptInfo);
+  void calculateNormalization(
+      const std::vector<coord_t> &otherValues,
+      const std::vector<Geometry::SymmetryOperation> &symmetryOps,
+      uint16_t expInfoIndex);
+  void addThreadNormalizations();
   void calculateIntersections(std::vector<std::array<double, 4>> &intersections,
                               const double theta, const double phi,
                               const Kernel::DblMatrix &transform,
@@ -85,8 +90,29 @@ private:
   double m_Ei;
   /// Flag indicating if the input workspace is from diffraction
   bool m_diffraction;
-  /// Flag to accumulate normalization
-  bool m_accumulate;
+
+  /// Values of a spectrum that are the same for all runs sharing the
+  /// instrument and for all symmetry operations
+  struct DetectorValues {
+    /// false for spectra that are not normalized: monitors, masked...
+    bool use;
+    /// polar angle of the detector
+    double theta;
+    /// azimuthal angle of the detector
+    double phi;
+    /// workspace index of the detector in the flux workspace
+    size_t fluxIndex;
+    /// solid angle of the detector, 1 without a SolidAngleWorkspace
+    double solidAngle;
+  };
+  /// Values of each spectrum of m_detectorCacheSource
+  std::vector<DetectorValues> m_detectorCache;
+  /// The experiment info m_detectorCache was made for
+  API::ExperimentInfo_const_sptr m_detectorCacheSource;
+  /// Normalization of the runs, summed separately by the threads that have
+  /// a grid
+  std::vector<std::vector<signal_t, Kernel::ZeroedAllocator<signal_t>>>
+      m_threadNormalization;
   /// Flag to indicate that the energy dimension is integrated
   bool m_dEIntegrated;
   /// Sample position
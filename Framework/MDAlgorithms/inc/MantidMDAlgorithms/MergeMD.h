@@ -38,7 +38,8 @@ private:
   void createOutputWorkspace(std::vector<std::string> &inputs);
 
   template <typename MDE, size_t nd>
-  void doPlus(typename Mantid::DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
+  void
+  doMerge(typename Mantid::DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
   /// Vector of input MDWorkspaces
   std::vector<Mantid::API::IMDEventWorkspace_sptr> m_workspaces;
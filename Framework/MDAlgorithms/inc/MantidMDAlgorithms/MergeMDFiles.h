@@ -61,6 +61,10 @@ private:
 
   uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
 
+  void mergeBoxes(size_t nReaders, uint64_t readAheadBytes);
+
+  void saveBox(API::IMDNode *box);
+
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
   // the vector of box structures for contributing files components
@@ -83,6 +87,10 @@ protected:
 
   /// Vector of file handles to each input file //TODO unique?
   std::vector<API::IBoxControllerIO *> m_EventLoader;
+  /// true for the input files whose events are in a memory-mapped event file
+  std::vector<bool> m_mappedInput;
+  /// true if the output events go to a memory-mapped event file
+  bool m_mappedOutput;
 
   /// Output IMDEventWorkspace
   Mantid::API::IMDEventWorkspace_sptr m_OutIWS;
@@ -93,7 +101,7 @@ protected:
   /// # of events loaded from all tasks
   uint64_t m_totalLoaded;
 
-  /// Mutex for file access
+  /// Mutex for file access, serialising all the NeXus (HDF5) IO
   std::mutex m_fileMutex;
 
   /// Mutex for modifying stats
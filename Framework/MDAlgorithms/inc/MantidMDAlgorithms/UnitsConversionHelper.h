@@ -64,6 +64,7 @@ public:
                   int Emode, bool forceViaTOF = false);
   void updateConversion(size_t i);
   double convertUnits(double val) const;
+  void convertUnits(double *first, double *last) const;
 
   bool isUnitConverted() const;
   std::pair<double, double> getConversionRange(double x1, double x2) const;
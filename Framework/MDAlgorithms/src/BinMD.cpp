@@ -16,6 +16,7 @@
 #include "MantidDataObjects/MDHistoWorkspace.h"
 #include "MantidGeometry/MDGeometry/MDBoxImplicitFunction.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
+#include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CPUTimer.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/Strings.h"
@@ -23,12 +24,19 @@
 #include "MantidKernel/Utils.h"
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+
 namespace Mantid {
 namespace MDAlgorithms {
 
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(BinMD)
 
+namespace {
+/// Number of events transformed at once when binning the events of a box
+constexpr size_t EVENT_BLOCK_SIZE = 1024;
+} // namespace
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using namespace Mantid::Geometry;
@@ -85,6 +93,15 @@ void BinMD::init() {
                   "multiple MDEventWorkspaces. If unspecified a blank "
                   "MDHistoWorkspace will be created.");
 
+  auto runIndexValidator = std::make_shared<BoundedValidator<int>>(
+      0, std::numeric_limits<uint16_t>::max());
+  declareProperty("FirstRunIndex", 0, runIndexValidator,
+                  "Only bin the events with at least this run index, i.e. "
+                  "the runs added to the InputWorkspace from this experiment "
+                  "info on. Together with a TemporaryDataWorkspace holding "
+                  "the binned earlier runs, this bins only the runs appended "
+                  "since. Needs MDEvents, which record their run index.");
+
   declareProperty(std::make_unique<WorkspaceProperty<Workspace>>(
                       "OutputWorkspace", "", Direction::Output),
                   "A name for the output MDHistoWorkspace.");
@@ -105,8 +122,9 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
   // An array to hold the rotated/transformed coordinates
   auto outCenter = std::vector<coord_t>(m_outD);
 
-  // Evaluate whether the entire box is in the same bin
-  if (box->getNPoints() > (1 << nd) * 2) {
+  // Evaluate whether the entire box is in the same bin. Not when only some
+  // runs are binned, since the box signal includes all of them
+  if (m_firstRunIndex == 0 && box->getNPoints() > (1 << nd) * 2) {
     // There is a check that the number of events is enough for it to make sense
     // to do all this processing.
     size_t numVertexes = 0;
@@ -178,43 +196,56 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
 
   // If you get here, you could not determine that the entire box was in the
   // same bin.
-  // So you need to iterate through events.
+  // So you need to go through the events. They are binned in blocks: the
+  // centres of a block are gathered one dimension after the other and
+  // transformed at once, which keeps the loops below free of virtual calls
+  // and lets the compiler vectorise them.
   const std::vector<MDE> &events = box->getConstEvents();
-  for (auto it = events.begin(); it != events.end(); ++it) {
-    // Cache the center of the event (again for speed)
-    const coord_t *inCenter = it->getCenter();
+  const size_t nEvents = events.size();
+  const size_t blockSize = std::min(nEvents, EVENT_BLOCK_SIZE);
+  std::vector<coord_t> inBlock(nd * blockSize);
+  std::vector<coord_t> outBlock(m_outD * blockSize);
+  std::vector<size_t> linearIndex(blockSize);
+  std::vector<char> inRange(blockSize);
+  for (size_t start = 0; start < nEvents; start += blockSize) {
+    const size_t n = std::min(blockSize, nEvents - start);
+    for (size_t i = 0; i < n; ++i) {
+      const coord_t *inCenter = events[start + i].getCenter();
+      for (size_t d = 0; d < nd; ++d)
+        inBlock[d * n + i] = inCenter[d];
+    }
 
     // Now transform to the output dimensions
-    m_transform->apply(inCenter, outCenter.data());
-
-    // To build up the linear index
-    size_t linearIndex = 0;
-    // To mark events outside range
-    bool badOne = false;
+    m_transform->applyBatch(inBlock.data(), outBlock.data(), n);
 
+    std::fill_n(linearIndex.begin(), n, 0);
+    std::fill_n(inRange.begin(), n, 1);
     /// Loop through the dimensions on which we bin
     for (size_t bd = 0; bd < m_outD; bd++) {
-      // What is the bin index in that dimension
-      coord_t x = outCenter[bd];
-      auto ix = size_t(x);
-      // Within range (for this chunk)?
-      if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
+      const coord_t *x = outBlock.data() + bd * n;
+      // Within range (for this chunk)? With integer limits, comparing the
+      // coordinate is the same as comparing the bin index in that dimension
+      const auto lower = static_cast<coord_t>(chunkMin[bd]);
+      const auto upper = static_cast<coord_t>(chunkMax[bd]);
+      const size_t multiplier = indexMultiplier[bd];
+      for (size_t i = 0; i < n; ++i) {
+        const bool inside = (x[i] >= lower) && (x[i] < upper);
+        inRange[i] &= static_cast<char>(inside);
         // Build up the linear index
-        linearIndex += indexMultiplier[bd] * ix;
-      } else {
-        // Outside the range
-        badOne = true;
-        break;
+        linearIndex[i] += multiplier * static_cast<size_t>(inside ? x[i] : 0);
       }
     } // (for each dim in MDHisto)
 
-    if (!badOne) {
+    for (size_t i = 0; i < n; ++i) {
+      const MDE &event = events[start + i];
+      if (!inRange[i] || event.getRunIndex() < m_firstRunIndex)
+        continue;
       // Sum the signals as doubles to preserve precision
-      signals[linearIndex] += static_cast<signal_t>(it->getSignal());
-      errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
+      signals[linearIndex[i]] += static_cast<signal_t>(event.getSignal());
+      errors[linearIndex[i]] += static_cast<signal_t>(event.getErrorSquared());
       // TODO: If DataObjects get a weight, this would need to get the summed
       // weight.
-      numEvents[linearIndex] += 1.0;
+      numEvents[linearIndex[i]] += 1.0;
     }
   }
   // Done with the events list
@@ -424,6 +455,16 @@ void BinMD::exec() {
         "Reprocess the input so that it contains full MDEvents.");
   }
 
+  m_firstRunIndex = static_cast<uint16_t>(static_cast<int>(
+      getProperty("FirstRunIndex")));
+  if (m_firstRunIndex > 0) {
+    auto inEWS = std::dynamic_pointer_cast<IMDEventWorkspace>(m_inWS);
+    if (inEWS && inEWS->getEventTypeName() != MDEvent<3>::getTypeName())
+      throw std::invalid_argument(
+          "FirstRunIndex needs an InputWorkspace of MDEvents: " +
+          inEWS->getEventTypeName() + "s do not record their run index.");
+  }
+
   CALL_MDEVENT_FUNCTION(this->binByIterating, m_inWS);
 
   // Copy the coordinate system & experiment infos to the output
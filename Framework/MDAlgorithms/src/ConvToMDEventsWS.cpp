@@ -6,14 +6,28 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
 
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 
+#include <algorithm>
+#include <exception>
+
 namespace Mantid {
 namespace MDAlgorithms {
+namespace {
+/// Number of spectra each thread converts between checks for box splitting
+constexpr size_t SPECTRA_PER_WORKER_BLOCK = 16;
+} // namespace
+
 /**function converts particular list of events of type T into MD workspace and
- * adds these events to the workspace itself  */
+ * adds these events to the workspace itself
+ * @param workspaceIndex -- the spectrum to convert
+ * @param qConverter -- the transformation to use; each thread needs its own
+ */
 template <class T>
-size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
+size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex,
+                                          MDTransfInterface &qConverter) {
 
   const Mantid::DataObjects::EventList &el =
       m_EventWS->getSpectrum(workspaceIndex);
@@ -30,7 +44,7 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
   std::vector<coord_t> locCoord(m_Coord);
   // set up unit conversion and calculate up all coordinates, which depend on
   // spectra index only
-  if (!m_QConverter->calcYDepCoordinates(locCoord, workspaceIndex))
+  if (!qConverter.calcYDepCoordinates(locCoord, workspaceIndex))
     return 0; // skip if any y outsize of the range of interest;
   localUnitConv.updateConversion(workspaceIndex);
   //
@@ -52,12 +66,17 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
   getEventsFrom(el, events_ptr);
   const typename std::vector<T> &events = *events_ptr;
 
-  // Iterators to start/end
-  for (auto it = events.cbegin(); it != events.cend(); it++) {
-    double val = localUnitConv.convertUnits(it->tof());
-    double signal = it->weight();
-    double errorSq = it->errorSquared();
-    if (!m_QConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
+  // Convert the times-of-flight of all the events at once
+  std::vector<double> values(events.size());
+  std::transform(events.cbegin(), events.cend(), values.begin(),
+                 [](const T &event) { return event.tof(); });
+  localUnitConv.convertUnits(values.data(), values.data() + values.size());
+
+  for (size_t i = 0; i < events.size(); ++i) {
+    double val = values[i];
+    double signal = events[i].weight();
+    double errorSq = events[i].errorSquared();
+    if (!qConverter.calcMatrixCoord(val, locCoord, signal, errorSq))
       continue; // skip ND outside the range
 
     sig_err.emplace_back(static_cast<float>(signal));
@@ -77,17 +96,24 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
 /** The method runs conversion for a single event list, corresponding to a
  * particular workspace index */
 size_t ConvToMDEventsWS::conversionChunk(size_t workspaceIndex) {
+  return conversionChunk(workspaceIndex, *m_QConverter);
+}
+
+/** The method runs conversion for a single event list using the given
+ * transformation, so that several spectra can be converted at once */
+size_t ConvToMDEventsWS::conversionChunk(size_t workspaceIndex,
+                                         MDTransfInterface &qConverter) {
 
   switch (m_EventWS->getSpectrum(workspaceIndex).getEventType()) {
   case Mantid::API::TOF:
     return this->convertEventList<Mantid::Types::Event::TofEvent>(
-        workspaceIndex);
+        workspaceIndex, qConverter);
   case Mantid::API::WEIGHTED:
     return this->convertEventList<Mantid::DataObjects::WeightedEvent>(
-        workspaceIndex);
+        workspaceIndex, qConverter);
   case Mantid::API::WEIGHTED_NOTIME:
     return this->convertEventList<Mantid::DataObjects::WeightedEventNoTime>(
-        workspaceIndex);
+        workspaceIndex, qConverter);
   default:
     throw std::runtime_error("EventList had an unexpected data type!");
   }
@@ -145,7 +171,7 @@ void ConvToMDEventsWS::appendEventsFromInputWS(
   size_t lastNumBoxes = bc->getTotalNumMDBoxes();
   size_t nEventsInWS = m_OutWSWrapper->pWorkspace()->getNPoints();
   //--->>> Thread control stuff
-  Kernel::ThreadSchedulerFIFO *ts(nullptr);
+  Kernel::ThreadScheduler *ts(nullptr);
 
   int nThreads(m_NumThreads);
   if (nThreads < 0)
@@ -155,8 +181,9 @@ void ConvToMDEventsWS::appendEventsFromInputWS(
   if (m_NumThreads != 0) {
     runMultithreaded = true;
     // Create the thread pool that will run all of these. It will be deleted by
-    // the threadpool
-    ts = new Kernel::ThreadSchedulerFIFO();
+    // the threadpool. The splitting tasks add more splitting tasks, so each
+    // thread keeps its own queue of tasks
+    ts = new Kernel::ThreadSchedulerWorkStealing(static_cast<size_t>(nThreads));
     // it will initiate thread pool with number threads or machine's cores (0 in
     // tp constructor)
     pProgress->resetNumSteps(m_NSpectra, 0, 1);
@@ -164,10 +191,38 @@ void ConvToMDEventsWS::appendEventsFromInputWS(
   Kernel::ThreadPool tp(ts, nThreads, new API::Progress(*pProgress));
   //<<<--  Thread control stuff
 
-  size_t eventsAdded = 0;
-  for (size_t wi = 0; wi < m_NSpectra; wi++) {
+  // Spectra are converted in parallel in blocks; the boxes are only split
+  // between blocks. Each thread needs its own transformation
+  const int nWorkers =
+      runMultithreaded ? (nThreads > 0 ? nThreads : PARALLEL_GET_MAX_THREADS)
+                       : 1;
+  std::vector<MDTransf_sptr> qConverters;
+  for (int i = 0; i < nWorkers; ++i)
+    qConverters.emplace_back(m_QConverter->clone());
+  const size_t blockSize =
+      runMultithreaded
+          ? SPECTRA_PER_WORKER_BLOCK * static_cast<size_t>(nWorkers)
+          : 1;
 
-    size_t nConverted = conversionChunk(wi);
+  size_t eventsAdded = 0;
+  for (size_t wi = 0; wi < m_NSpectra; wi += blockSize) {
+    const auto blockEnd = static_cast<int64_t>(
+        std::min(wi + blockSize, static_cast<size_t>(m_NSpectra)));
+    size_t nConverted = 0;
+    std::exception_ptr error;
+    PRAGMA_OMP(parallel for num_threads(nWorkers) schedule(dynamic) reduction(+ : nConverted))
+    for (auto i = static_cast<int64_t>(wi); i < blockEnd; ++i) {
+      try {
+        nConverted += conversionChunk(static_cast<size_t>(i),
+                                      *qConverters[PARALLEL_THREAD_NUMBER]);
+      } catch (...) {
+        PARALLEL_CRITICAL(ConvToMDEventsWS_error)
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+    if (error)
+      std::rethrow_exception(error);
     eventsAdded += nConverted;
     nEventsInWS += nConverted;
     // Keep a running total of how many events we've added
@@ -136,14 +136,16 @@ using MDE = DataObjects::MDLeanEvent<3>;
 /** Convert one spectrum to DataObjects.
  * Depending on options, it uses the histogram view or the
  * pure event view.
- * Then another method converts to 3D q-space and adds it to the
- * MDEventWorkspace
+ * Then another method converts to 3D q-space and appends it to the
+ * vector of MDEvents
  *
  * @param specInfo :: input workspace spectrum info
  * @param workspaceIndex :: index into the workspace
+ * @param events :: vector the converted events are appended to
  */
 void ConvertToDiffractionMDWorkspace::convertSpectrum(
-    const API::SpectrumInfo &specInfo, int workspaceIndex) {
+    const API::SpectrumInfo &specInfo, int workspaceIndex,
+    std::vector<MDE> &events) {
   if (m_inEventWS && !OneEventPerBin) {
     // ---------- Convert events directly -------------------------
     EventList &el = m_inEventWS->getSpectrum(workspaceIndex);
@@ -151,13 +153,15 @@ void ConvertToDiffractionMDWorkspace::convertSpectrum(
     // Call the right templated function
     switch (el.getEventType()) {
     case TOF:
-      this->convertEventList<TofEvent>(workspaceIndex, specInfo, el);
+      this->convertEventList<TofEvent>(workspaceIndex, specInfo, el, events);
       break;
     case WEIGHTED:
-      this->convertEventList<WeightedEvent>(workspaceIndex, specInfo, el);
+      this->convertEventList<WeightedEvent>(workspaceIndex, specInfo, el,
+                                            events);
       break;
     case WEIGHTED_NOTIME:
-      this->convertEventList<WeightedEventNoTime>(workspaceIndex, specInfo, el);
+      this->convertEventList<WeightedEventNoTime>(workspaceIndex, specInfo, el,
+                                                  events);
       break;
     default:
       throw std::runtime_error("EventList had an unexpected data type!");
@@ -178,24 +182,26 @@ void ConvertToDiffractionMDWorkspace::convertSpectrum(
         (OneEventPerBin ? 1 : 10) /* Max of this many events per bin */);
 
     // Perform the conversion on this temporary event list
-    this->convertEventList<WeightedEventNoTime>(workspaceIndex, specInfo, el);
+    this->convertEventList<WeightedEventNoTime>(workspaceIndex, specInfo, el,
+                                                events);
   }
 }
 
 //----------------------------------------------------------------------------------------------
-/** Convert an event list to 3D q-space and add it to the MDEventWorkspace
+/** Convert an event list to 3D q-space and append it to a vector of MDEvents
  *
  * @tparam T :: the type of event in the input EventList (TofEvent,
  * WeightedEvent, etc.)
  * @param workspaceIndex :: the workspace index
  * @param specInfo :: input workspace spectrum info
  * @param el :: reference to the event list
+ * @param events :: vector the converted events are appended to
  */
 template <class T>
 void ConvertToDiffractionMDWorkspace::convertEventList(
-    int workspaceIndex, const API::SpectrumInfo &specInfo, EventList &el) {
+    int workspaceIndex, const API::SpectrumInfo &specInfo, EventList &el,
+    std::vector<MDE> &events) {
   size_t numEvents = el.getNumberEvents();
-  DataObjects::MDBoxBase<DataObjects::MDLeanEvent<3>, 3> *box = ws->getBox();
 
   // Get the position of the detector there.
   const auto &detectors = el.getDetectorIDs();
@@ -260,11 +266,12 @@ void ConvertToDiffractionMDWorkspace::convertEventList(
     // you can't overload by return type).
     typename std::vector<T> *events_ptr;
     getEventsFrom(el, events_ptr);
-    typename std::vector<T> &events = *events_ptr;
+    typename std::vector<T> &tofEvents = *events_ptr;
+    events.reserve(events.size() + tofEvents.size());
 
     // Iterators to start/end
-    auto it = events.begin();
-    auto it_end = events.end();
+    auto it = tofEvents.begin();
+    auto it_end = tofEvents.end();
 
     for (; it != it_end; it++) {
       // Get the wavenumber in ang^-1 using the previously calculated constant.
@@ -290,13 +297,13 @@ void ConvertToDiffractionMDWorkspace::convertEventList(
         auto correct = float(sin_theta_squared * wavenumber * wavenumber *
                              wavenumber * wavenumber);
         // Push the MDLeanEvent but correct the weight.
-        box->addEvent(MDE(float(it->weight() * correct),
-                          float(it->errorSquared() * correct * correct),
-                          center));
+        events.emplace_back(float(it->weight() * correct),
+                            float(it->errorSquared() * correct * correct),
+                            center);
       } else {
         // Push the MDLeanEvent with the same weight
-        box->addEvent(
-            MDE(float(it->weight()), float(it->errorSquared()), center));
+        events.emplace_back(float(it->weight()), float(it->errorSquared()),
+                            center);
       }
     }
 
@@ -497,6 +504,13 @@ void ConvertToDiffractionMDWorkspace::exec() {
     totalEvents = m_inEventWS->getNumberEvents();
   prog = std::make_shared<Progress>(this, 0.0, 1.0, totalEvents);
 
+  // Without a minimum recursion depth to keep, all the events are converted
+  // first and the boxes are built for all of them at once.
+  const int minDepth = this->getProperty("MinRecursionDepth");
+  const bool buildAtOnce = minDepth == 0;
+  std::vector<std::vector<MDE>> threadEvents(
+      buildAtOnce ? PARALLEL_GET_MAX_THREADS : 0);
+
   // Create the thread pool that will run all of these.
   ThreadScheduler *ts = new ThreadSchedulerFIFO();
   ThreadPool tp(ts, 0);
@@ -524,7 +538,8 @@ void ConvertToDiffractionMDWorkspace::exec() {
       eventsAdded += eventsAdding;
       approxEventsInOutput += eventsAdding;
 
-      if (bc->shouldSplitBoxes(approxEventsInOutput, eventsAdded, lastNumBoxes))
+      if (!buildAtOnce &&
+          bc->shouldSplitBoxes(approxEventsInOutput, eventsAdded, lastNumBoxes))
         break;
     }
 
@@ -532,11 +547,32 @@ void ConvertToDiffractionMDWorkspace::exec() {
     PARALLEL_FOR_IF(Kernel::threadSafe(*m_inWS))
     for (int i = start; i < static_cast<int>(wi); ++i) {
       PARALLEL_START_INTERUPT_REGION
-      this->convertSpectrum(specInfo, static_cast<int>(i));
+      if (buildAtOnce) {
+        this->convertSpectrum(specInfo, i,
+                              threadEvents[PARALLEL_THREAD_NUMBER]);
+      } else {
+        std::vector<MDE> events;
+        this->convertSpectrum(specInfo, i, events);
+        auto *box = ws->getBox();
+        for (const auto &event : events)
+          box->addEvent(event);
+      }
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
 
+    if (buildAtOnce) {
+      std::vector<MDE> events;
+      events.reserve(eventsAdded);
+      for (auto &chunk : threadEvents) {
+        events.insert(events.end(), chunk.cbegin(), chunk.cend());
+        std::vector<MDE>().swap(chunk);
+      }
+      prog->doReport("Building Boxes");
+      ws->buildFromEvents(events);
+      break;
+    }
+
     // 3. Split boxes
     if (DODEBUG) {
       g_log.information() << cputim << ": Added tasks worth " << eventsAdded
@@ -36,6 +36,7 @@
 
 #include <cmath>
 #include <fstream>
+#include <tuple>
 #include <gsl/gsl_integration.h>
 
 namespace Mantid {
@@ -51,6 +52,55 @@ using namespace Mantid::DataObjects;
 using namespace Mantid::DataObjects;
 using namespace Mantid::Geometry;
 
+namespace {
+/// Number of spheres integrated together in one walk of the box tree
+constexpr size_t SPHERES_PER_BATCH = 256;
+
+/// The sphere or ellipsoid integration of one peak
+struct SphereIntegration {
+  /// Index of the peak in the peaks workspace
+  int peakIndex;
+  /// Center of the peak in the dimensions of the workspace
+  V3D pos;
+  /// Distance to the edge of the detector
+  double edge;
+  /// Transformation to the distance (squared) from the center of the peak
+  std::unique_ptr<CoordTransformDistance> radiusTransform;
+  /// Ratio of the peak volume to the background shell volume
+  double scaleFactor;
+  /// The peak sphere
+  IntegrationSphere peak;
+  /// The background shell
+  IntegrationSphere background;
+};
+
+/**
+ * Sort the peaks so that neighbouring peaks follow each other, by ordering
+ * them along a grid with cells the size of the largest integration region.
+ *
+ * @param integrations :: the peaks to sort
+ */
+void sortSpatially(std::vector<SphereIntegration> &integrations) {
+  double cellSize = 0.;
+  for (const auto &integration : integrations)
+    cellSize = std::max(
+        {cellSize, std::sqrt(double(integration.peak.radiusSquared)),
+         std::sqrt(double(integration.background.radiusSquared))});
+  if (cellSize <= 0.)
+    return;
+  auto cellOf = [cellSize](const V3D &pos) {
+    return std::make_tuple(std::floor(pos.X() / cellSize),
+                           std::floor(pos.Y() / cellSize),
+                           std::floor(pos.Z() / cellSize));
+  };
+  std::stable_sort(
+      integrations.begin(), integrations.end(),
+      [&cellOf](const SphereIntegration &lhs, const SphereIntegration &rhs) {
+        return cellOf(lhs.pos) < cellOf(rhs.pos);
+      });
+}
+} // namespace
+
 /** Initialize the algorithm's properties.
  */
 void IntegratePeaksMD2::init() {
@@ -305,9 +355,63 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   // 5-10% speedup.  Perhaps is should just be removed permanantly, but for
   // now it is commented out to avoid the seg faults.  Refs #5533
   // PRAGMA_OMP(parallel for schedule(dynamic, 10) )
+  // Spheres and ellipsoids are instead integrated after this loop, in
+  // batches of neighbouring peaks (see integrateSpheres()).
   // Initialize progress reporting
   int nPeaks = peakWS->getNumberPeaks();
-  Progress progress(this, 0., 1., nPeaks);
+  Progress progress(this, 0., cylinderBool ? 1. : 0.1, nPeaks);
+
+  // Save the integrated intensity of peak i back in the peak object
+  auto savePeak = [&](int i, const V3D &pos, const double edge,
+                      const signal_t signal, const signal_t errorSquared,
+                      const signal_t bgSignal, const signal_t bgErrorSquared,
+                      const double background_total) {
+    IPeak &p = peakWS->getPeak(i);
+    checkOverlap(
+        i, peakWS, CoordinatesToUse,
+        2.0 * std::max(PeakRadiusVector[i], BackgroundOuterRadiusVector[i]));
+    // Save it back in the peak object.
+    if (signal != 0. || replaceIntensity) {
+      double edgeMultiplier = 1.0;
+      double peakMultiplier = 1.0;
+      if (correctEdge) {
+        if (edge < BackgroundOuterRadius) {
+          double e1 = BackgroundOuterRadius - edge;
+          // volume of cap of sphere with h = edge
+          double f1 =
+              M_PI * std::pow(e1, 2) / 3 * (3 * BackgroundOuterRadius - e1);
+          edgeMultiplier = volumeBkg / (volumeBkg - f1);
+        }
+        if (edge < PeakRadius) {
+          double sigma = PeakRadius / 3.0;
+          // assume gaussian peak
+          double e1 =
+              std::exp(-std::pow(edge, 2) / (2 * sigma * sigma)) * PeakRadius;
+          // volume of cap of sphere with h = edge
+          double f1 = M_PI * std::pow(e1, 2) / 3 * (3 * PeakRadius - e1);
+          peakMultiplier = volumeRadius / (volumeRadius - f1);
+        }
+      }
+
+      p.setIntensity(peakMultiplier * signal -
+                     edgeMultiplier * (ratio * background_total + bgSignal));
+      p.setSigmaIntensity(
+          sqrt(peakMultiplier * errorSquared +
+               edgeMultiplier * (ratio * ratio * std::fabs(background_total) +
+                                 bgErrorSquared)));
+    }
+
+    g_log.information() << "Peak " << i << " at " << pos << ": signal "
+                        << signal << " (sig^2 " << errorSquared
+                        << "), with background "
+                        << bgSignal + ratio * background_total << " (sig^2 "
+                        << bgErrorSquared +
+                               ratio * ratio * std::fabs(background_total)
+                        << ") subtracted.\n";
+  };
+
+  // The peaks to integrate in a sphere or an ellipsoid
+  std::vector<SphereIntegration> sphereIntegrations;
   for (int i = 0; i < nPeaks; ++i) {
     if (this->getCancel())
       break; // User cancellation
@@ -381,8 +485,6 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
           adaptiveQBackgroundMultiplier * lenQpeak + BackgroundInnerRadius;
       BackgroundOuterRadiusVector[i] =
           adaptiveQBackgroundMultiplier * lenQpeak + BackgroundOuterRadius;
-      // define the radius squared for a sphere intially
-      CoordTransformDistance getRadiusSq(nd, center, dimensionsUsed);
       // set spherical shape
       if (auto *shapeablePeak = dynamic_cast<Peak *>(&p)) {
         PeakShape *sphereShape = new PeakShapeSpherical(
@@ -391,80 +493,26 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
             this->version());
         shapeablePeak->setPeakShape(sphereShape);
       }
-      const double scaleFactor = pow(PeakRadiusVector[i], 3) /
-                                 (pow(BackgroundOuterRadiusVector[i], 3) -
-                                  pow(BackgroundInnerRadiusVector[i], 3));
-      // Integrate spherical background shell if specified
-      if (BackgroundOuterRadius > PeakRadius) {
-        // Get the total signal inside background shell
-        ws->getBox()->integrateSphere(
-            getRadiusSq,
-            static_cast<coord_t>(pow(BackgroundOuterRadiusVector[i], 2)),
-            bgSignal, bgErrorSquared,
-            static_cast<coord_t>(pow(BackgroundInnerRadiusVector[i], 2)),
-            useOnePercentBackgroundCorrection);
-        // correct bg signal by Vpeak/Vshell (same for sphere and ellipse)
-        bgSignal *= scaleFactor;
-        bgErrorSquared *= scaleFactor * scaleFactor;
-      }
-      // if ellipsoid find covariance and centroid in spherical region
-      // using one-pass algorithm from https://doi.org/10.1145/359146.359153
-      if (isEllipse) {
-        // flat bg to subtract
-        const auto bgDensity =
-            bgSignal / (4 * M_PI * pow(PeakRadiusVector[i], 3) / 3);
-        std::vector<V3D> eigenvects;
-        std::vector<double> eigenvals;
-        findEllipsoid<MDE, nd>(
-            ws, getRadiusSq, pos,
-            static_cast<coord_t>(pow(PeakRadiusVector[i], 2)), qAxisIsFixed,
-            bgDensity, eigenvects, eigenvals);
-
-        // transform ellispoid onto sphere of radius = R
-        getRadiusSq =
-            CoordTransformDistance(nd, center, dimensionsUsed, 1, /* outD */
-                                   eigenvects, eigenvals);
-        // Integrate ellipsoid background shell if specified
-        if (BackgroundOuterRadius > PeakRadius) {
-          // Get the total signal inside "BackgroundOuterRadius"
-          bgSignal = 0;
-          bgErrorSquared = 0;
-          ws->getBox()->integrateSphere(
-              getRadiusSq,
-              static_cast<coord_t>(pow(BackgroundOuterRadiusVector[i], 2)),
-              bgSignal, bgErrorSquared,
-              static_cast<coord_t>(pow(BackgroundInnerRadiusVector[i], 2)),
-              useOnePercentBackgroundCorrection);
-          // correct bg signal by Vpeak/Vshell (same as previously
-          // calculated for sphere)
-          bgSignal *= scaleFactor;
-          bgErrorSquared *= scaleFactor * scaleFactor;
-        }
-        // set peak shape
-        if (auto *shapeablePeak = dynamic_cast<Peak *>(&p)) {
-          // get radii in same proprtion as eigenvalues
-          auto max_stdev =
-              pow(*std::max_element(eigenvals.begin(), eigenvals.end()), 0.5);
-          std::vector<double> peakRadii(3, 0.0);
-          std::vector<double> backgroundInnerRadii(3, 0.0);
-          std::vector<double> backgroundOuterRadii(3, 0.0);
-          for (size_t irad = 0; irad < peakRadii.size(); irad++) {
-            auto scale = pow(eigenvals[irad], 0.5) / max_stdev;
-            peakRadii[irad] = PeakRadiusVector[i] * scale;
-            backgroundInnerRadii[irad] = BackgroundInnerRadiusVector[i] * scale;
-            backgroundOuterRadii[irad] = BackgroundOuterRadiusVector[i] * scale;
-          }
-          PeakShape *ellipsoidShape = new PeakShapeEllipsoid(
-              eigenvects, peakRadii, backgroundInnerRadii, backgroundOuterRadii,
-              CoordinatesToUse, this->name(), this->version());
-          shapeablePeak->setPeakShape(ellipsoidShape);
-        }
-      }
-      // spherical integration of signal
-      ws->getBox()->integrateSphere(
-          getRadiusSq, static_cast<coord_t>(adaptiveRadius * adaptiveRadius),
-          signal, errorSquared, 0.0 /* innerRadiusSquared */,
-          useOnePercentBackgroundCorrection);
+      // define the radius squared for a sphere intially
+      SphereIntegration integration;
+      integration.peakIndex = i;
+      integration.pos = pos;
+      integration.edge = edge;
+      integration.radiusTransform =
+          std::make_unique<CoordTransformDistance>(nd, center, dimensionsUsed);
+      integration.scaleFactor = pow(PeakRadiusVector[i], 3) /
+                                (pow(BackgroundOuterRadiusVector[i], 3) -
+                                 pow(BackgroundInnerRadiusVector[i], 3));
+      integration.peak = {
+          integration.radiusTransform.get(),
+          static_cast<coord_t>(adaptiveRadius * adaptiveRadius),
+          0.0 /* innerRadiusSquared */, 0.0, 0.0};
+      integration.background = {
+          integration.radiusTransform.get(),
+          static_cast<coord_t>(pow(BackgroundOuterRadiusVector[i], 2)),
+          static_cast<coord_t>(pow(BackgroundInnerRadiusVector[i], 2)), 0.0,
+          0.0};
+      sphereIntegrations.emplace_back(std::move(integration));
     } else {
       CoordTransformDistance cylinder(nd, center, dimensionsUsed, 2);
 
@@ -642,48 +690,121 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         }
       }
     }
-    checkOverlap(
-        i, peakWS, CoordinatesToUse,
-        2.0 * std::max(PeakRadiusVector[i], BackgroundOuterRadiusVector[i]));
-    // Save it back in the peak object.
-    if (signal != 0. || replaceIntensity) {
-      double edgeMultiplier = 1.0;
-      double peakMultiplier = 1.0;
-      if (correctEdge) {
-        if (edge < BackgroundOuterRadius) {
-          double e1 = BackgroundOuterRadius - edge;
-          // volume of cap of sphere with h = edge
-          double f1 =
-              M_PI * std::pow(e1, 2) / 3 * (3 * BackgroundOuterRadius - e1);
-          edgeMultiplier = volumeBkg / (volumeBkg - f1);
+    // The spheres and ellipsoids are saved once they are integrated
+    if (cylinderBool)
+      savePeak(i, pos, edge, signal, errorSquared, bgSignal, bgErrorSquared,
+               background_total);
+  }
+
+  // Nothing more to integrate if the user cancelled the loop above
+  if (!sphereIntegrations.empty() && !this->getCancel()) {
+    const bool integrateBackground = BackgroundOuterRadius > PeakRadius;
+    // Neighbouring peaks share most of the boxes they touch, so batches of
+    // neighbours load and traverse them once for the whole batch.
+    sortSpatially(sphereIntegrations);
+    const size_t nIntegrations = sphereIntegrations.size();
+    const size_t spheresPerPeak = integrateBackground ? 2 : 1;
+    Progress sphereProgress(this, 0.1, 1.,
+                            (isEllipse ? 2 : 1) * spheresPerPeak *
+                                nIntegrations);
+
+    // Integrate the background shells. Unless the ellipsoids need the
+    // background density first, integrate the peaks at the same time.
+    std::vector<IntegrationSphere *> spheres;
+    spheres.reserve(spheresPerPeak * nIntegrations);
+    for (auto &integration : sphereIntegrations) {
+      if (integrateBackground)
+        spheres.emplace_back(&integration.background);
+      if (!isEllipse)
+        spheres.emplace_back(&integration.peak);
+    }
+    integrateSpheres<MDE, nd>(ws, spheres, useOnePercentBackgroundCorrection,
+                              sphereProgress);
+
+    // if ellipsoid find covariance and centroid in spherical region
+    // using one-pass algorithm from https://doi.org/10.1145/359146.359153
+    if (isEllipse) {
+      spheres.clear();
+      for (auto &integration : sphereIntegrations) {
+        interruption_point();
+        const int i = integration.peakIndex;
+        // flat bg to subtract, corrected by Vpeak/Vshell
+        const auto bgSignal =
+            integration.background.signal * integration.scaleFactor;
+        const auto bgDensity =
+            bgSignal / (4 * M_PI * pow(PeakRadiusVector[i], 3) / 3);
+        std::vector<V3D> eigenvects;
+        std::vector<double> eigenvals;
+        findEllipsoid<MDE, nd>(
+            ws, *integration.radiusTransform, integration.pos,
+            static_cast<coord_t>(pow(PeakRadiusVector[i], 2)), qAxisIsFixed,
+            bgDensity, eigenvects, eigenvals);
+
+        // transform ellispoid onto sphere of radius = R
+        bool dimensionsUsed[nd];
+        coord_t center[nd];
+        for (size_t d = 0; d < nd; ++d) {
+          dimensionsUsed[d] = true; // Use all dimensions
+          center[d] = static_cast<coord_t>(integration.pos[d]);
         }
-        if (edge < PeakRadius) {
-          double sigma = PeakRadius / 3.0;
-          // assume gaussian peak
-          double e1 =
-              std::exp(-std::pow(edge, 2) / (2 * sigma * sigma)) * PeakRadius;
-          // volume of cap of sphere with h = edge
-          double f1 = M_PI * std::pow(e1, 2) / 3 * (3 * PeakRadius - e1);
-          peakMultiplier = volumeRadius / (volumeRadius - f1);
+        integration.radiusTransform = std::make_unique<CoordTransformDistance>(
+            nd, center, dimensionsUsed, 1, /* outD */
+            eigenvects, eigenvals);
+        integration.peak.radiusTransform = integration.radiusTransform.get();
+        // Integrate ellipsoid background shell if specified
+        integration.background.radiusTransform =
+            integration.radiusTransform.get();
+        integration.background.signal = 0;
+        integration.background.errorSquared = 0;
+        if (integrateBackground)
+          spheres.emplace_back(&integration.background);
+        spheres.emplace_back(&integration.peak);
+
+        // set peak shape
+        if (auto *shapeablePeak = dynamic_cast<Peak *>(&peakWS->getPeak(i))) {
+          // get radii in same proprtion as eigenvalues
+          auto max_stdev =
+              pow(*std::max_element(eigenvals.begin(), eigenvals.end()), 0.5);
+          std::vector<double> peakRadii(3, 0.0);
+          std::vector<double> backgroundInnerRadii(3, 0.0);
+          std::vector<double> backgroundOuterRadii(3, 0.0);
+          for (size_t irad = 0; irad < peakRadii.size(); irad++) {
+            auto scale = pow(eigenvals[irad], 0.5) / max_stdev;
+            peakRadii[irad] = PeakRadiusVector[i] * scale;
+            backgroundInnerRadii[irad] = BackgroundInnerRadiusVector[i] * scale;
+            backgroundOuterRadii[irad] = BackgroundOuterRadiusVector[i] * scale;
+          }
+          PeakShape *ellipsoidShape = new PeakShapeEllipsoid(
+              eigenvects, peakRadii, backgroundInnerRadii, backgroundOuterRadii,
+              CoordinatesToUse, this->name(), this->version());
+          shapeablePeak->setPeakShape(ellipsoidShape);
         }
       }
-
-      p.setIntensity(peakMultiplier * signal -
-                     edgeMultiplier * (ratio * background_total + bgSignal));
-      p.setSigmaIntensity(
-          sqrt(peakMultiplier * errorSquared +
-               edgeMultiplier * (ratio * ratio * std::fabs(background_total) +
-                                 bgErrorSquared)));
+      integrateSpheres<MDE, nd>(ws, spheres, useOnePercentBackgroundCorrection,
+                                sphereProgress);
     }
 
-    g_log.information() << "Peak " << i << " at " << pos << ": signal "
-                        << signal << " (sig^2 " << errorSquared
-                        << "), with background "
-                        << bgSignal + ratio * background_total << " (sig^2 "
-                        << bgErrorSquared +
-                               ratio * ratio * std::fabs(background_total)
-                        << ") subtracted.\n";
+    // Save the peaks in their original order
+    std::sort(sphereIntegrations.begin(), sphereIntegrations.end(),
+              [](const SphereIntegration &lhs, const SphereIntegration &rhs) {
+                return lhs.peakIndex < rhs.peakIndex;
+              });
+    for (const auto &integration : sphereIntegrations) {
+      // correct bg signal by Vpeak/Vshell (same for sphere and ellipse)
+      const double scaleFactor = integration.scaleFactor;
+      signal_t bgSignal = 0;
+      signal_t bgErrorSquared = 0;
+      if (integrateBackground) {
+        bgSignal = integration.background.signal * scaleFactor;
+        bgErrorSquared =
+            integration.background.errorSquared * scaleFactor * scaleFactor;
+      }
+      savePeak(integration.peakIndex, integration.pos, integration.edge,
+               integration.peak.signal, integration.peak.errorSquared, bgSignal,
+               bgErrorSquared, 0.0);
+    }
   }
+
   // This flag is used by the PeaksWorkspace to evaluate whether it has
   // been integrated.
   peakWS->mutableRun().addProperty("PeaksIntegrated", 1, true);
@@ -713,6 +834,36 @@ void IntegratePeaksMD2::integrate(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   setProperty("OutputWorkspace", peakWS);
 }
 
+/**
+ * Integrate spheres in batches of neighbouring spheres. Each batch walks the
+ * box tree once (see MDBoxBase::integrateSpheres()). The batches are
+ * integrated one after the other, like the peaks in exec (see Refs #5533).
+ *
+ * @param ws :: input workspace
+ * @param spheres :: the spheres to integrate, sorted spatially
+ * @param useOnePercentBackgroundCorrection :: if one percent correction
+ *        should be applied to background
+ * @param progress :: reported once per sphere
+ */
+template <typename MDE, size_t nd>
+void IntegratePeaksMD2::integrateSpheres(
+    typename MDEventWorkspace<MDE, nd>::sptr ws,
+    const std::vector<IntegrationSphere *> &spheres,
+    const bool useOnePercentBackgroundCorrection, Progress &progress) {
+  const auto nBatches = static_cast<int64_t>(
+      (spheres.size() + SPHERES_PER_BATCH - 1) / SPHERES_PER_BATCH);
+  MDBoxBase<MDE, nd> *box = ws->getBox();
+  for (int64_t batch = 0; batch < nBatches; ++batch) {
+    interruption_point();
+    const auto first = static_cast<size_t>(batch) * SPHERES_PER_BATCH;
+    const auto last = std::min(first + SPHERES_PER_BATCH, spheres.size());
+    box->integrateSpheres(std::vector<IntegrationSphere *>(
+                              spheres.begin() + first, spheres.begin() + last),
+                          useOnePercentBackgroundCorrection);
+    progress.reportIncrement(last - first);
+  }
+}
+
 /**
  * Calculate the covariance matrix of a spherical region and store the
  * eigenvectors and eigenvalues that diagonalise the covariance matrix in the
@@ -11,6 +11,7 @@
 #include "MantidAPI/IMDWorkspace.h"
 #include "MantidAPI/RegisterFileLoader.h"
 #include "MantidAPI/WorkspaceHistory.h"
+#include "MantidDataObjects/BoxControllerMappedIO.h"
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/CoordTransformAffine.h"
 #include "MantidDataObjects/MDBoxFlatTree.h"
@@ -28,6 +29,7 @@
 #include "MantidKernel/MDUnit.h"
 #include "MantidKernel/MDUnitFactory.h"
 #include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/System.h"
 #include "MantidMDAlgorithms/SetMDFrame.h"
@@ -551,9 +553,18 @@ void LoadMD::doLoad(typename MDEventWorkspace<MDE, nd>::sptr ws) {
 
   // ---------------------------------------- DEAL WITH BOXES
   // ------------------------------------
+  // Events saved to a separate event file are memory-mapped, which lets many
+  // threads load them at once
+  const bool mappedEvents =
+      (fileBackEnd || !m_BoxStructureAndMethadata) &&
+      BoxControllerMappedIO::hasEventFile(m_filename, nDims,
+                                          MDE::getTypeName());
   if (fileBackEnd) { // TODO:: call to the file format factory
-    auto loader = std::shared_ptr<API::IBoxControllerIO>(
-        new DataObjects::BoxControllerNeXusIO(bc.get()));
+    std::shared_ptr<API::IBoxControllerIO> loader;
+    if (mappedEvents)
+      loader = std::make_shared<DataObjects::BoxControllerMappedIO>(bc.get());
+    else
+      loader = std::make_shared<DataObjects::BoxControllerNeXusIO>(bc.get());
     loader->setDataType(sizeof(coord_t), MDE::getTypeName());
     bc->setFileBacked(loader, m_filename);
     // boxes have been already made file-backed when restoring the boxTree;
@@ -583,8 +594,11 @@ void LoadMD::doLoad(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     // ---------------------------------------- READ IN THE BOXES
     // ------------------------------------
     // TODO:: call to the file format factory
-    auto loader =
-        file_holder_type(new DataObjects::BoxControllerNeXusIO(bc.get()));
+    file_holder_type loader;
+    if (mappedEvents)
+      loader.reset(new DataObjects::BoxControllerMappedIO(bc.get()));
+    else
+      loader.reset(new DataObjects::BoxControllerNeXusIO(bc.get()));
     loader->setDataType(sizeof(coord_t), MDE::getTypeName());
 
     loader->openFile(m_filename, "r");
@@ -592,7 +606,8 @@ void LoadMD::doLoad(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     const std::vector<uint64_t> &BoxEventIndex = FlatBoxTree.getEventIndex();
     prog->setNumSteps(numBoxes);
 
-    for (size_t i = 0; i < numBoxes; i++) {
+    PARALLEL_FOR_IF(mappedEvents)
+    for (int64_t i = 0; i < static_cast<int64_t>(numBoxes); i++) {
       prog->report();
       auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxTree[i]);
       if (!box)
@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include <utility>
 
+#include "MantidDataObjects/MDEventStagingBuffer.h"
 #include "MantidGeometry/MDGeometry/MDTypes.h"
 #include "MantidMDAlgorithms/MDEventWSWrapper.h"
 
@@ -92,15 +93,25 @@ void MDEventWSWrapper::addMDDataND(float *sigErr, uint16_t *runIndex,
                                    uint32_t *detId, coord_t *Coord,
                                    size_t dataSize) const {
 
+  // This is called once per spectrum, so the buffers hold no more than the
+  // events of the call
+  const size_t bufferCapacity = std::min(
+      dataSize,
+      DataObjects::MDEventStagingBuffer<DataObjects::MDEvent<nd>,
+                                        nd>::DEFAULT_CAPACITY);
   auto *const pWs = dynamic_cast<
       DataObjects::MDEventWorkspace<DataObjects::MDEvent<nd>, nd> *>(
       m_Workspace.get());
   if (pWs) {
+    // add the events box by box, so each box is locked once
+    DataObjects::MDEventStagingBuffer<DataObjects::MDEvent<nd>, nd> buffer(
+        pWs->getBox(), bufferCapacity);
     for (size_t i = 0; i < dataSize; i++) {
-      pWs->addEvent(DataObjects::MDEvent<nd>(
+      buffer.addEvent(DataObjects::MDEvent<nd>(
           *(sigErr + 2 * i), *(sigErr + 2 * i + 1), *(runIndex + i),
           *(detId + i), (Coord + i * nd)));
     }
+    buffer.flush();
   } else {
     auto *const pLWs = dynamic_cast<
         DataObjects::MDEventWorkspace<DataObjects::MDLeanEvent<nd>, nd> *>(
@@ -111,10 +122,13 @@ void MDEventWSWrapper::addMDDataND(float *sigErr, uint16_t *runIndex,
                                "does not correspond to type of events you try "
                                "to add to it");
 
+    DataObjects::MDEventStagingBuffer<DataObjects::MDLeanEvent<nd>, nd> buffer(
+        pLWs->getBox(), bufferCapacity);
     for (size_t i = 0; i < dataSize; i++) {
-      pLWs->addEvent(DataObjects::MDLeanEvent<nd>(
+      buffer.addEvent(DataObjects::MDLeanEvent<nd>(
           *(sigErr + 2 * i), *(sigErr + 2 * i + 1), (Coord + i * nd)));
     }
+    buffer.flush();
   }
 }
 
@@ -17,14 +17,18 @@
 #include "MantidGeometry/Crystal/SpaceGroupFactory.h"
 #include "MantidGeometry/Crystal/SymmetryOperationFactory.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/MDGeometry/HKL.h"
 #include "MantidGeometry/MDGeometry/MDFrameFactory.h"
 #include "MantidGeometry/MDGeometry/QSample.h"
 #include "MantidKernel/ArrayLengthValidator.h"
 #include "MantidKernel/ArrayProperty.h"
+#include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/UnitLabelTypes.h"
 #include "MantidKernel/VectorHelper.h"
@@ -70,8 +74,8 @@ MDNorm::MDNorm()
     : m_normWS(), m_inputWS(), m_isRLU(false), m_UB(3, 3, true),
       m_W(3, 3, true), m_transformation(), m_hX(), m_kX(), m_lX(), m_eX(),
       m_hIdx(-1), m_kIdx(-1), m_lIdx(-1), m_eIdx(-1), m_numExptInfos(0),
-      m_Ei(0.0), m_diffraction(true), m_accumulate(false), m_dEIntegrated(true),
-      m_samplePos(), m_beamDir(), convention("") {}
+      m_Ei(0.0), m_diffraction(true), m_dEIntegrated(true), m_samplePos(),
+      m_beamDir(), convention("") {}
 
 /// Algorithms name for identification. @see Algorithm::name
 const std::string MDNorm::name() const { return "MDNorm"; }
@@ -199,8 +203,17 @@ void MDNorm::init() {
                   "An input MDHistoWorkspace used to accumulate normalization "
                   "from multiple MDEventWorkspaces. If unspecified a blank "
                   "MDHistoWorkspace will be created.");
+  auto runIndexValidator = std::make_shared<BoundedValidator<int>>(
+      0, std::numeric_limits<uint16_t>::max());
+  declareProperty("FirstRunIndex", 0, runIndexValidator,
+                  "Only add the runs from this experiment info on to the "
+                  "temporary workspaces, which hold the earlier runs already. "
+                  "Both the data and the normalization of the runs appended "
+                  "to the InputWorkspace since are added, without redoing the "
+                  "earlier ones.");
   setPropertyGroup("TemporaryDataWorkspace", "Temporary workspaces");
   setPropertyGroup("TemporaryNormalizationWorkspace", "Temporary workspaces");
+  setPropertyGroup("FirstRunIndex", "Temporary workspaces");
 
   declareProperty(std::make_unique<WorkspaceProperty<API::Workspace>>(
                       "OutputWorkspace", "", Kernel::Direction::Output),
@@ -383,6 +396,18 @@ std::map<std::string, std::string> MDNorm::validateInputs() {
         "Must provide either no accumulation workspaces or,"
         "both TemporaryNormalizationWorkspaces and TemporaryDataWorkspace");
   }
+  // only add new runs to the runs accumulated already
+  const int firstRunIndex = getProperty("FirstRunIndex");
+  if (firstRunIndex > 0) {
+    if (!tempDataWS)
+      errorMessage.emplace("FirstRunIndex",
+                           "Needs the temporary workspaces holding the runs "
+                           "before FirstRunIndex");
+    if (static_cast<size_t>(firstRunIndex) >= nExperimentInfos)
+      errorMessage.emplace("FirstRunIndex",
+                           "Must be less than the number of experiment infos "
+                           "of the InputWorkspace");
+  }
   // check that both accumulation workspaces are on the same grid
   if (tempNormWS && tempDataWS) {
     size_t numNormDims = tempNormWS->getNumDims();
@@ -416,6 +441,12 @@ std::map<std::string, std::string> MDNorm::validateInputs() {
 /** Execute the algorithm.
  */
 void MDNorm::exec() {
+  // Nothing is kept from an earlier execution: the workspaces may differ, and
+  // a failed execution may leave partial sums behind
+  m_detectorCache.clear();
+  m_detectorCacheSource.reset();
+  m_threadNormalization.clear();
+
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
   // symmetry operations
   std::string symOps = this->getProperty("SymmetryOperations");
@@ -476,9 +507,21 @@ void MDNorm::exec() {
   this->setProperty("OutputDataWorkspace", outputDataWS);
 
   m_numExptInfos = outputDataWS->getNumExperimentInfo();
-  // loop over all experiment infos
-  for (uint16_t expInfoIndex = 0; expInfoIndex < m_numExptInfos;
-       expInfoIndex++) {
+  // Each thread sums the normalization into its own grid, as long as the
+  // grids fit into half of the available memory. Only the parts of the grids
+  // that are written to take up memory. The threads without a grid add to the
+  // normalization workspace atomically
+  const size_t gridKiB = m_normWS->getNPoints() * sizeof(signal_t) / 1024 + 1;
+  Kernel::MemoryStats memory;
+  m_threadNormalization.resize(
+      std::min(static_cast<size_t>(PARALLEL_GET_MAX_THREADS),
+               memory.availMem() / 2 / gridKiB));
+  for (auto &normalization : m_threadNormalization)
+    normalization.resize(m_normWS->getNPoints());
+  // loop over all experiment infos, or the ones not accumulated yet
+  const int firstRunIndex = getProperty("FirstRunIndex");
+  for (auto expInfoIndex = static_cast<uint16_t>(firstRunIndex);
+       expInfoIndex < m_numExptInfos; expInfoIndex++) {
     // Check for other dimensions if we could measure anything in the original
     // data
     bool skipNormalization = false;
@@ -488,19 +531,13 @@ void MDNorm::exec() {
     cacheDimensionXValues();
 
     if (!skipNormalization) {
-      size_t symmOpsIndex = 0;
-      for (const auto &so : symmetryOps) {
-        calculateNormalization(otherValues, so, expInfoIndex, symmOpsIndex);
-        symmOpsIndex++;
-      }
-
+      calculateNormalization(otherValues, symmetryOps, expInfoIndex);
     } else {
       g_log.warning("Binning limits are outside the limits of the MDWorkspace. "
                     "Not applying normalization.");
     }
-    // if more than one experiment info, keep accumulating
-    m_accumulate = true;
   }
+  addThreadNormalizations();
 
   IAlgorithm_sptr divideMD = createChildAlgorithm("DivideMD", 0.99, 1.);
   divideMD->setProperty("LHSWorkspace", outputDataWS);
@@ -731,8 +768,6 @@ void MDNorm::createNormalizationWS(
   if (!m_normWS) {
     m_normWS = dataWS.clone();
     m_normWS->setTo(0., 0., 0.);
-  } else {
-    m_accumulate = true;
   }
 }
 
@@ -958,6 +993,7 @@ DataObjects::MDHistoWorkspace_sptr MDNorm::binInputWS(
     binMD->setPropertyValue("AxisAligned", "0");
     binMD->setProperty("InputWorkspace", m_inputWS);
     binMD->setProperty("TemporaryDataWorkspace", tempDataWS);
+    binMD->setPropertyValue("FirstRunIndex", getPropertyValue("FirstRunIndex"));
     binMD->setPropertyValue("NormalizeBasisVectors", "0");
     binMD->setPropertyValue("OutputWorkspace",
                             getPropertyValue("OutputDataWorkspace"));
@@ -1134,17 +1170,89 @@ void MDNorm::cacheDimensionXValues() {
 }
 
 /**
- * Computed the normalization for the input workspace. Results are stored in
- * m_normWS
+ * Cache the values of each spectrum of an experiment info that do not depend
+ * on the run or the symmetry operation. The cache is kept for the following
+ * experiment infos as long as they have the same detectors and spectra.
+ * @param exptInfo - the experiment info to normalize next
+ */
+void MDNorm::cacheDetectors(const API::ExperimentInfo_const_sptr &exptInfo) {
+  const auto &spectrumInfo = exptInfo->spectrumInfo();
+  if (m_detectorCacheSource) {
+    if (m_detectorCacheSource == exptInfo)
+      return;
+    const auto &cachedSpectrumInfo = m_detectorCacheSource->spectrumInfo();
+    bool same = spectrumInfo.size() == cachedSpectrumInfo.size() &&
+                exptInfo->detectorInfo().isEquivalent(
+                    m_detectorCacheSource->detectorInfo());
+    for (size_t i = 0; same && i < spectrumInfo.size(); ++i)
+      same = spectrumInfo.spectrumDefinition(i) ==
+             cachedSpectrumInfo.spectrumDefinition(i);
+    if (same)
+      return;
+  }
+
+  API::MatrixWorkspace_const_sptr solidAngleWS =
+      getProperty("SolidAngleWorkspace");
+  API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
+  const detid2index_map solidAngDetToIdx =
+      (solidAngleWS) ? solidAngleWS->getDetectorIDToWorkspaceIndexMap()
+                     : detid2index_map();
+  const detid2index_map fluxDetToIdx =
+      (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap()
+                      : detid2index_map();
+
+  const auto ndets = static_cast<int64_t>(spectrumInfo.size());
+  m_detectorCache.assign(spectrumInfo.size(), DetectorValues{false, 0., 0., 0,
+                                                             1.});
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < ndets; i++) {
+    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
+        spectrumInfo.isMasked(i)) {
+      continue;
+    }
+    auto &values = m_detectorCache[i];
+    const auto &detector = spectrumInfo.detector(i);
+    values.theta = detector.getTwoTheta(m_samplePos, m_beamDir);
+    values.phi = detector.getPhi();
+    // If the detector is a group, this should be the ID of the first detector
+    const auto detID = detector.getID();
+
+    // get the flux spectrum number
+    if (m_diffraction) {
+      auto index = fluxDetToIdx.find(detID);
+      if (index == fluxDetToIdx.end()) {
+        // masked detector in flux, but not in input workspace
+        continue;
+      }
+      values.fluxIndex = index->second;
+    }
+    // Get solid angle for this contribution
+    if (solidAngleWS) {
+      auto index = solidAngDetToIdx.find(detID);
+      if (index == solidAngDetToIdx.end())
+        continue;
+      values.solidAngle = solidAngleWS->y(index->second)[0];
+    }
+    values.use = true;
+  }
+  m_detectorCacheSource = exptInfo;
+}
+
+/**
+ * Computed the normalization for the input workspace, for all the symmetry
+ * operations at once. Results are added to the normalization grids of the
+ * threads, m_threadNormalization, or to the normalization workspace by the
+ * threads without a grid.
  * @param otherValues - values for dimensions other than Q or DeltaE
- * @param so - symmetry operation
+ * @param symmetryOps - symmetry operations
  * @param expInfoIndex - current experiment info index
- * @param soIndex - the index of symmetry operation (for progress purposes)
  */
-void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
-                                    const Geometry::SymmetryOperation &so,
-                                    uint16_t expInfoIndex, size_t soIndex) {
-  const auto &currentExptInfo = *(m_inputWS->getExperimentInfo(expInfoIndex));
+void MDNorm::calculateNormalization(
+    const std::vector<coord_t> &otherValues,
+    const std::vector<Geometry::SymmetryOperation> &symmetryOps,
+    uint16_t expInfoIndex) {
+  const auto exptInfo = m_inputWS->getExperimentInfo(expInfoIndex);
+  const auto &currentExptInfo = *exptInfo;
   std::vector<double> lowValues, highValues;
   auto *lowValuesLog = dynamic_cast<VectorDoubleProperty *>(
       currentExptInfo.getLog("MDNorm_low"));
@@ -1154,151 +1262,131 @@ void MDNorm::calculateNormalization(const std::vector<coord_t> &otherValues,
   highValues = (*highValuesLog)();
 
   DblMatrix R = currentExptInfo.run().getGoniometerMatrix();
-  DblMatrix soMatrix(3, 3);
-  auto v = so.transformHKL(V3D(1, 0, 0));
-  soMatrix.setColumn(0, v);
-  v = so.transformHKL(V3D(0, 1, 0));
-  soMatrix.setColumn(1, v);
-  v = so.transformHKL(V3D(0, 0, 1));
-  soMatrix.setColumn(2, v);
-  soMatrix.Invert();
-  DblMatrix Qtransform = R * m_UB * soMatrix * m_W;
-  Qtransform.Invert();
+  std::vector<DblMatrix> Qtransforms;
+  Qtransforms.reserve(symmetryOps.size());
+  for (const auto &so : symmetryOps) {
+    DblMatrix soMatrix(3, 3);
+    auto v = so.transformHKL(V3D(1, 0, 0));
+    soMatrix.setColumn(0, v);
+    v = so.transformHKL(V3D(0, 1, 0));
+    soMatrix.setColumn(1, v);
+    v = so.transformHKL(V3D(0, 0, 1));
+    soMatrix.setColumn(2, v);
+    soMatrix.Invert();
+    DblMatrix Qtransform = R * m_UB * soMatrix * m_W;
+    Qtransform.Invert();
+    Qtransforms.emplace_back(Qtransform);
+  }
   const double protonCharge = currentExptInfo.run().getProtonCharge();
-  const auto &spectrumInfo = currentExptInfo.spectrumInfo();
 
-  // Mappings
-  const auto ndets = static_cast<int64_t>(spectrumInfo.size());
-  bool haveSA = false;
-  API::MatrixWorkspace_const_sptr solidAngleWS =
-      getProperty("SolidAngleWorkspace");
+  cacheDetectors(exptInfo);
+  const auto ndets = static_cast<int64_t>(m_detectorCache.size());
   API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
-  if (solidAngleWS != nullptr) {
-    haveSA = true;
-  }
-  const detid2index_map solidAngDetToIdx =
-      (haveSA) ? solidAngleWS->getDetectorIDToWorkspaceIndexMap()
-               : detid2index_map();
-  const detid2index_map fluxDetToIdx =
-      (m_diffraction) ? integrFlux->getDetectorIDToWorkspaceIndexMap()
-                      : detid2index_map();
 
   const size_t vmdDims = (m_diffraction) ? 3 : 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
   std::vector<std::array<double, 4>> intersections;
   std::vector<double> xValues, yValues;
   std::vector<coord_t> pos, posNew;
 
-  double progStep = 0.7 / static_cast<double>(m_numExptInfos * m_numSymmOps);
-  auto progIndex = static_cast<double>(soIndex + expInfoIndex * m_numSymmOps);
-  auto prog =
-      std::make_unique<API::Progress>(this, 0.3 + progStep * progIndex,
-                                      0.3 + progStep * (1. + progIndex), ndets);
+  double progStep = 0.7 / static_cast<double>(m_numExptInfos);
+  auto prog = std::make_unique<API::Progress>(
+      this, 0.3 + progStep * expInfoIndex, 0.3 + progStep * (expInfoIndex + 1),
+      ndets);
   bool safe = true;
   if (m_diffraction) {
     safe = Kernel::threadSafe(*integrFlux);
   }
+  signal_t *normSignals = m_normWS->mutableSignalArray();
   // cppcheck-suppress syntaxError
-PRAGMA_OMP(parallel for private(intersections, xValues, yValues, pos, posNew) if (safe))
+PRAGMA_OMP(parallel for schedule(dynamic, 64) private(intersections, xValues, yValues, pos, posNew) if (safe))
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERUPT_REGION
 
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
-      spectrumInfo.isMasked(i)) {
+  const auto &detector = m_detectorCache[i];
+  if (!detector.use) {
     continue;
   }
-
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the dtefctor is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
-
-  // get the flux spectrum number
-  size_t wsIdx = 0;
-  if (m_diffraction) {
-    auto index = fluxDetToIdx.find(detID);
-    if (index != fluxDetToIdx.end()) {
-      wsIdx = index->second;
-    } else { // masked detector in flux, but not in input workspace
+  const double solid = detector.solidAngle * protonCharge;
+  const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+  signal_t *normalization = (thread < m_threadNormalization.size())
+                                ? m_threadNormalization[thread].data()
+                                : nullptr;
+
+  for (const auto &Qtransform : Qtransforms) {
+    // Intersections
+    this->calculateIntersections(intersections, detector.theta, detector.phi,
+                                 Qtransform, lowValues[i], highValues[i]);
+    if (intersections.empty())
       continue;
+    if (m_diffraction) {
+      // -- calculate integrals for the intersection --
+      // momentum values at intersections
+      auto intersectionsBegin = intersections.begin();
+      // copy momenta to xValues
+      xValues.resize(intersections.size());
+      yValues.resize(intersections.size());
+      auto x = xValues.begin();
+      for (auto it = intersectionsBegin; it != intersections.end(); ++it, ++x) {
+        *x = (*it)[3];
+      }
+      // calculate integrals at momenta from xValues by interpolating between
+      // points in spectrum sp
+      // of workspace integrFlux. The result is stored in yValues
+      calcIntegralsForIntersections(xValues, *integrFlux, detector.fluxIndex,
+                                    yValues);
     }
-  }
 
-  // Intersections
-  this->calculateIntersections(intersections, theta, phi, Qtransform,
-                               lowValues[i], highValues[i]);
-  if (intersections.empty())
-    continue;
-  // Get solid angle for this contribution
-  double solid = protonCharge;
-  if (haveSA) {
-    solid =
-        solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
-  }
-  if (m_diffraction) {
-    // -- calculate integrals for the intersection --
-    // momentum values at intersections
-    auto intersectionsBegin = intersections.begin();
-    // copy momenta to xValues
-    xValues.resize(intersections.size());
-    yValues.resize(intersections.size());
-    auto x = xValues.begin();
-    for (auto it = intersectionsBegin; it != intersections.end(); ++it, ++x) {
-      *x = (*it)[3];
-    }
-    // calculate integrals at momenta from xValues by interpolating between
-    // points in spectrum sp
-    // of workspace integrFlux. The result is stored in yValues
-    calcIntegralsForIntersections(xValues, *integrFlux, wsIdx, yValues);
-  }
+    // Compute final position in HKL
+    // pre-allocate for efficiency and copy non-hkl dim values into place
+    pos.resize(vmdDims + otherValues.size());
+    std::copy(otherValues.begin(), otherValues.end(), pos.begin() + vmdDims);
 
-  // Compute final position in HKL
-  // pre-allocate for efficiency and copy non-hkl dim values into place
-  pos.resize(vmdDims + otherValues.size());
-  std::copy(otherValues.begin(), otherValues.end(), pos.begin() + vmdDims);
-
-  auto intersectionsBegin = intersections.begin();
-  for (auto it = intersectionsBegin + 1; it != intersections.end(); ++it) {
-    const auto &curIntSec = *it;
-    const auto &prevIntSec = *(it - 1);
-    // the full vector isn't used so compute only what is necessary
-    double delta, eps;
-    if (m_diffraction) {
-      delta = curIntSec[3] - prevIntSec[3];
-      eps = 1e-7;
-    } else {
-      delta = (curIntSec[3] * curIntSec[3] - prevIntSec[3] * prevIntSec[3]) /
-              energyToK;
-      eps = 1e-10;
-    }
-    if (delta < eps)
-      continue; // Assume zero contribution if difference is small
-    // Average between two intersections for final position
-    std::transform(curIntSec.data(), curIntSec.data() + vmdDims,
-                   prevIntSec.data(), pos.begin(),
-                   [](const double rhs, const double lhs) {
-                     return static_cast<coord_t>(0.5 * (rhs + lhs));
-                   });
-    signal_t signal;
-    if (m_diffraction) {
-      // index of the current intersection
-      auto k = static_cast<size_t>(std::distance(intersectionsBegin, it));
-      // signal = integral between two consecutive intersections
-      signal = (yValues[k] - yValues[k - 1]) * solid;
-    } else {
-      // transform kf to energy transfer
-      pos[3] = static_cast<coord_t>(m_Ei - pos[3] * pos[3] / energyToK);
-      // signal = energy distance between two consecutive intersections *solid
-      // angle *PC
-      signal = solid * delta;
+    auto intersectionsBegin = intersections.begin();
+    for (auto it = intersectionsBegin + 1; it != intersections.end(); ++it) {
+      const auto &curIntSec = *it;
+      const auto &prevIntSec = *(it - 1);
+      // the full vector isn't used so compute only what is necessary
+      double delta, eps;
+      if (m_diffraction) {
+        delta = curIntSec[3] - prevIntSec[3];
+        eps = 1e-7;
+      } else {
+        delta = (curIntSec[3] * curIntSec[3] - prevIntSec[3] * prevIntSec[3]) /
+                energyToK;
+        eps = 1e-10;
+      }
+      if (delta < eps)
+        continue; // Assume zero contribution if difference is small
+      // Average between two intersections for final position
+      std::transform(curIntSec.data(), curIntSec.data() + vmdDims,
+                     prevIntSec.data(), pos.begin(),
+                     [](const double rhs, const double lhs) {
+                       return static_cast<coord_t>(0.5 * (rhs + lhs));
+                     });
+      signal_t signal;
+      if (m_diffraction) {
+        // index of the current intersection
+        auto k = static_cast<size_t>(std::distance(intersectionsBegin, it));
+        // signal = integral between two consecutive intersections
+        signal = (yValues[k] - yValues[k - 1]) * solid;
+      } else {
+        // transform kf to energy transfer
+        pos[3] = static_cast<coord_t>(m_Ei - pos[3] * pos[3] / energyToK);
+        // signal = energy distance between two consecutive intersections
+        // *solid angle *PC
+        signal = solid * delta;
+      }
+      m_transformation.multiplyPoint(pos, posNew);
+      size_t linIndex = m_normWS->getLinearIndexAtCoord(posNew.data());
+      if (linIndex == size_t(-1))
+        continue;
+      if (normalization) {
+        normalization[linIndex] += signal;
+      } else {
+        PARALLEL_ATOMIC
+        normSignals[linIndex] += signal;
+      }
     }
-    m_transformation.multiplyPoint(pos, posNew);
-    size_t linIndex = m_normWS->getLinearIndexAtCoord(posNew.data());
-    if (linIndex == size_t(-1))
-      continue;
-    Mantid::Kernel::AtomicOp(signalArray[linIndex], signal,
-                             std::plus<signal_t>());
   }
 
   prog->report();
@@ -1306,16 +1394,20 @@ for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_END_INTERUPT_REGION
 }
 PARALLEL_CHECK_INTERUPT_REGION
-if (m_accumulate) {
-  std::transform(
-      signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(),
-      m_normWS->mutableSignalArray(),
-      [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-} else {
-  std::copy(signalArray.cbegin(), signalArray.cend(),
-            m_normWS->mutableSignalArray());
 }
-m_accumulate = true;
+
+/**
+ * Add the normalization summed by the threads to the normalization workspace
+ */
+void MDNorm::addThreadNormalizations() {
+  signal_t *signals = m_normWS->mutableSignalArray();
+  const auto nPoints = static_cast<int64_t>(m_normWS->getNPoints());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nPoints; ++i) {
+    for (const auto &normalization : m_threadNormalization)
+      signals[i] += normalization[i];
+  }
+  m_threadNormalization.clear();
 }
 
 /**
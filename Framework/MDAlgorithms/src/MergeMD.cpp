@@ -200,57 +200,64 @@ inline void copyEvent(const MDEvent<nd> &srcEvent, MDEvent<ond> &newEvent,
 }
 
 //----------------------------------------------------------------------------------------------
-/** Perform the adding.
- * Will do out += ws
+/** Perform the merging.
+ * The events of all the input workspaces are collected first, so that the
+ * box structure of the output is built once for all of them. At the peak
+ * every event is held twice, in the collected vector and in the new boxes.
  *
- * @param ws ::  MDEventWorkspace to clone
+ * @param ws1 ::  the output MDEventWorkspace
  */
 template <typename MDE, size_t nd>
-void MergeMD::doPlus(typename MDEventWorkspace<MDE, nd>::sptr ws2) {
-  // CPUTimer tim;
-  typename MDEventWorkspace<MDE, nd>::sptr ws1 =
-      std::dynamic_pointer_cast<MDEventWorkspace<MDE, nd>>(out);
-  if (!ws1 || !ws2)
-    throw std::runtime_error("Incompatible workspace types passed to MergeMD.");
-
-  MDBoxBase<MDE, nd> *box1 = ws1->getBox();
-  MDBoxBase<MDE, nd> *box2 = ws2->getBox();
-
-  uint16_t runIndexOffset = experimentInfoNo.back();
-  experimentInfoNo.pop_back();
-
-  // How many events you started with
-  size_t initial_numEvents = ws1->getNPoints();
-
-  // Make a leaf-only iterator through all boxes with events in the RHS
-  // workspace
-  std::vector<API::IMDNode *> boxes;
-  box2->getBoxes(boxes, 1000, true);
-  auto numBoxes = int(boxes.size());
-
-  bool fileBasedSource(false);
-  if (ws2->isFileBacked())
-    fileBasedSource = true;
-
-  // Add the boxes in parallel. They should be spread out enough on each
-  // core to avoid stepping on each other.
-  // cppcheck-suppress syntaxError
-    PRAGMA_OMP( parallel for if (!ws2->isFileBacked()) )
-    for (int i = 0; i < numBoxes; i++) {
+void MergeMD::doMerge(typename MDEventWorkspace<MDE, nd>::sptr ws1) {
+  std::vector<MDE> events;
+  double progStep = 0.9 / double(m_workspaces.size());
+  for (size_t i = 0; i < m_workspaces.size(); i++) {
+    auto ws2 =
+        std::dynamic_pointer_cast<MDEventWorkspace<MDE, nd>>(m_workspaces[i]);
+    if (!ws2)
+      throw std::runtime_error(
+          "Incompatible workspace types passed to MergeMD.");
+    g_log.information() << "Adding workspace " << ws2->getName() << '\n';
+    progress(double(i) * progStep, ws2->getName());
+
+    uint16_t runIndexOffset = experimentInfoNo.back();
+    experimentInfoNo.pop_back();
+
+    // Make a leaf-only iterator through all boxes with events in the RHS
+    // workspace
+    std::vector<API::IMDNode *> boxes;
+    ws2->getBox()->getBoxes(boxes, 1000, true);
+    auto numBoxes = int(boxes.size());
+
+    // Find where the events of each box go, so they can be copied in parallel
+    std::vector<size_t> offsets(boxes.size() + 1, events.size());
+    for (size_t j = 0; j < boxes.size(); j++) {
+      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[j]);
+      offsets[j + 1] = offsets[j];
+      if (box && !box->getIsMasked())
+        offsets[j + 1] += box->getNPoints();
+    }
+    events.resize(offsets.back());
+
+    bool fileBasedSource(false);
+    if (ws2->isFileBacked())
+      fileBasedSource = true;
+
+    // cppcheck-suppress syntaxError
+    PRAGMA_OMP( parallel for if (!fileBasedSource) )
+    for (int j = 0; j < numBoxes; j++) {
       PARALLEL_START_INTERUPT_REGION
-      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[i]);
+      auto *box = dynamic_cast<MDBox<MDE, nd> *>(boxes[j]);
       if (box && !box->getIsMasked()) {
-        // Copy the events from WS2 and add them into WS1
-        const std::vector<MDE> &events = box->getConstEvents();
-        // Add events, with bounds checking
-
-        for (auto it = events.cbegin(); it != events.cend(); ++it) {
-          // Create the event
-          MDE newEvent(it->getSignal(), it->getErrorSquared(), it->getCenter());
+        // Copy the events from WS2
+        const std::vector<MDE> &boxEvents = box->getConstEvents();
+        auto newEvent = events.begin() + offsets[j];
+        for (auto it = boxEvents.cbegin(); it != boxEvents.cend();
+             ++it, ++newEvent) {
+          *newEvent = MDE(it->getSignal(), it->getErrorSquared(),
+                          it->getCenter());
           // Copy extra data, if any
-          copyEvent(*it, newEvent, runIndexOffset);
-          // Add it to the workspace
-          box1->addEvent(newEvent);
+          copyEvent(*it, *newEvent, runIndexOffset);
         }
         if (fileBasedSource)
           box->clear();
@@ -260,21 +267,10 @@ void MergeMD::doPlus(typename MDEventWorkspace<MDE, nd>::sptr ws2) {
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
+  }
 
-    // Progress * prog2 = new Progress(this, 0.4, 0.9, 100);
-    Progress *prog2 = nullptr;
-    ThreadScheduler *ts = new ThreadSchedulerFIFO();
-    ThreadPool tp(ts, 0, prog2);
-    ws1->splitAllIfNeeded(ts);
-    // prog2->resetNumSteps( ts->size(), 0.4, 0.6);
-    tp.joinAll();
-
-    // Set a marker that the file-back-end needs updating if the # of events
-    // changed.
-    if (ws1->getNPoints() != initial_numEvents)
-      ws1->setFileNeedsUpdating(true);
-    //
-    // std::cout << tim << " to add workspace " << ws2->name() << '\n';
+  this->progress(0.9, "Building boxes");
+  ws1->buildFromEvents(events);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -307,17 +303,8 @@ void MergeMD::exec() {
   // Create a blank output workspace
   this->createOutputWorkspace(inputs);
 
-  // Run PlusMD on each of the input workspaces, in order.
-  double progStep = 1.0 / double(m_workspaces.size());
-  for (size_t i = 0; i < m_workspaces.size(); i++) {
-    g_log.information() << "Adding workspace " << m_workspaces[i]->getName()
-                        << '\n';
-    progress(double(i) * progStep, m_workspaces[i]->getName());
-    CALL_MDEVENT_FUNCTION(doPlus, m_workspaces[i]);
-  }
-
-  this->progress(0.95, "Refreshing cache");
-  out->refreshCache();
+  // Add the events of each of the input workspaces, in order.
+  CALL_MDEVENT_FUNCTION(doMerge, out);
 
   this->setProperty("OutputWorkspace", out);
 
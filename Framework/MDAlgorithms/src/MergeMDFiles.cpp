@@ -7,10 +7,14 @@
 #include "MantidMDAlgorithms/MergeMDFiles.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/MultipleFileProperty.h"
+#include "MantidDataObjects/BoxControllerMappedIO.h"
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDEventFactory.h"
+#include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/VectorHelper.h"
@@ -18,6 +22,11 @@
 #include <Poco/File.h>
 #include <boost/scoped_ptr.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <thread>
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
@@ -33,7 +42,8 @@ DECLARE_ALGORITHM(MergeMDFiles)
  */
 MergeMDFiles::MergeMDFiles()
     : m_nDims(0), m_MDEventType(), m_fileBasedTargetWS(false), m_Filenames(),
-      m_EventLoader(), m_OutIWS(), m_totalEvents(0), m_totalLoaded(0),
+      m_EventLoader(), m_mappedInput(), m_mappedOutput(false), m_OutIWS(),
+      m_totalEvents(0), m_totalLoaded(0),
       m_fileMutex(), m_statsMutex() {}
 
 //----------------------------------------------------------------------------------------------
@@ -61,7 +71,27 @@ void MergeMDFiles::init() {
 
   declareProperty("Parallel", false,
                   "Run the loading tasks in parallel.\n"
-                  "This can be faster but might use more memory.");
+                  "Boxes are read ahead on several threads while the merged "
+                  "boxes are saved. This can be faster but uses more memory, "
+                  "up to MemoryLimit.");
+
+  auto mustBePositive = std::make_shared<BoundedValidator<int>>();
+  mustBePositive->setLower(1);
+  declareProperty("MemoryLimit", 1600, mustBePositive,
+                  "The memory in MB the events read ahead from the input "
+                  "files and the write buffer of a file-backed output may "
+                  "use. A quarter of it goes to the write buffer.\n"
+                  "A box with more events than fit is still merged, on its "
+                  "own.");
+
+  declareProperty("SeparateEventFile", false,
+                  "Save the output events to a raw event file next to the "
+                  "OutputFilename instead of into it. The event file is "
+                  "memory-mapped, so saving does not wait on reading the "
+                  "input files.");
+  setPropertySettings("SeparateEventFile",
+                      std::make_unique<EnabledWhenProperty>(
+                          "OutputFilename", IS_NOT_DEFAULT));
 
   declareProperty(std::make_unique<WorkspaceProperty<IMDEventWorkspace>>(
                       "OutputWorkspace", "", Direction::Output),
@@ -85,6 +115,7 @@ void MergeMDFiles::loadBoxData() {
 
   m_fileComponentsStructure.resize(m_Filenames.size());
   m_EventLoader.assign(m_Filenames.size(), nullptr);
+  m_mappedInput.assign(m_Filenames.size(), false);
 
   try {
     for (size_t i = 0; i < m_Filenames.size(); i++) {
@@ -120,7 +151,12 @@ void MergeMDFiles::loadBoxData() {
           new API::BoxController(static_cast<size_t>(m_nDims)));
       bc->fromXMLString(m_fileComponentsStructure[i].getBCXMLdescr());
 
-      m_EventLoader[i] = new BoxControllerNeXusIO(bc.get());
+      m_mappedInput[i] = BoxControllerMappedIO::hasEventFile(
+          m_Filenames[i], m_nDims, m_MDEventType);
+      if (m_mappedInput[i])
+        m_EventLoader[i] = new BoxControllerMappedIO(bc.get());
+      else
+        m_EventLoader[i] = new BoxControllerNeXusIO(bc.get());
       m_EventLoader[i]->setDataType(sizeof(coord_t), m_MDEventType);
       m_EventLoader[i]->openFile(m_Filenames[i], "r");
     }
@@ -181,6 +217,10 @@ uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
         m_fileComponentsStructure[iw].getEventIndex()[2 * ID + 0];
     if (numFileEvents[iw] == 0)
       continue;
+    // NeXus files share the HDF5 library, which may not be thread-safe
+    std::unique_lock<std::mutex> lock(m_fileMutex, std::defer_lock);
+    if (!m_mappedInput[iw])
+      lock.lock();
     TargetBox->loadAndAddFrom(m_EventLoader[iw], fileLocation,
                               numFileEvents[iw]);
   }
@@ -188,6 +228,133 @@ uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
   return nBoxEvents;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Save the events merged into a box of a file-backed output workspace and
+ * free the memory they use.
+ *
+ * @param box :: the box holding the merged events
+ */
+void MergeMDFiles::saveBox(API::IMDNode *box) {
+  if (!m_fileBasedTargetWS || box->getDataInMemorySize() == 0)
+    return;
+  // data position has been already pre-calculated
+  std::unique_lock<std::mutex> lock(m_fileMutex, std::defer_lock);
+  if (!m_mappedOutput)
+    lock.lock();
+  box->getISaveable()->save();
+  box->clearDataFromMemory();
+}
+
+//----------------------------------------------------------------------------------------------
+/** Merge the events of all the boxes, in the order of the box IDs, which is
+ * the order of the events in the input and output files.
+ *
+ * Reader threads load the next boxes from all the input files while this
+ * thread saves the boxes already loaded. The readers take the boxes in order
+ * and stop reading ahead while the events loaded but not saved yet would take
+ * more than readAheadBytes, so the memory used stays bounded however large
+ * the files are. A box larger than the budget is loaded once all the boxes
+ * before it have been saved.
+ *
+ * @param nReaders :: number of reader threads. 0 loads and saves the boxes
+ *one after the other on this thread.
+ * @param readAheadBytes :: memory the events read ahead may use
+ */
+void MergeMDFiles::mergeBoxes(size_t nReaders, uint64_t readAheadBytes) {
+  std::vector<API::IMDNode *> boxes;
+  for (auto box : m_BoxStruct.getBoxes())
+    if (box->isBox())
+      boxes.emplace_back(box);
+  const auto &eventIndex = m_BoxStruct.getEventIndex();
+  const uint64_t eventSize = m_OutIWS->sizeofEvent();
+  auto boxBytes = [&](size_t ib) {
+    return eventSize * eventIndex[2 * boxes[ib]->getID() + 1];
+  };
+  m_progress->resetNumSteps(static_cast<int64_t>(boxes.size()), 0.1, 0.9);
+
+  if (nReaders == 0) {
+    for (auto box : boxes) {
+      m_totalLoaded += this->loadEventsFromSubBoxes(box);
+      this->saveBox(box);
+      m_progress->report("Loading and merging box data");
+    }
+    return;
+  }
+
+  std::mutex mutex;
+  std::condition_variable changed;
+  size_t nextToLoad(0);
+  uint64_t bytesInFlight(0);
+  std::vector<char> loaded(boxes.size(), false);
+  std::exception_ptr error;
+  bool abort(false);
+
+  auto read = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!abort && nextToLoad < boxes.size()) {
+      const size_t ib = nextToLoad;
+      const uint64_t bytes = boxBytes(ib);
+      if (bytesInFlight > 0 && bytesInFlight + bytes > readAheadBytes) {
+        changed.wait(lock);
+        continue;
+      }
+      nextToLoad++;
+      bytesInFlight += bytes;
+      lock.unlock();
+      try {
+        this->loadEventsFromSubBoxes(boxes[ib]);
+      } catch (...) {
+        lock.lock();
+        if (!error)
+          error = std::current_exception();
+        abort = true;
+        changed.notify_all();
+        return;
+      }
+      lock.lock();
+      loaded[ib] = true;
+      changed.notify_all();
+    }
+  };
+
+  std::vector<std::thread> readers;
+  auto stopReaders = [&]() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      abort = true;
+    }
+    changed.notify_all();
+    for (auto &reader : readers)
+      reader.join();
+  };
+  try {
+    for (size_t i = 0; i < nReaders; i++)
+      readers.emplace_back(read);
+    for (size_t ib = 0; ib < boxes.size(); ib++) {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&]() { return loaded[ib] || abort; });
+        if (!loaded[ib])
+          break;
+      }
+      this->saveBox(boxes[ib]);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        bytesInFlight -= boxBytes(ib);
+      }
+      changed.notify_all();
+      m_totalLoaded += eventIndex[2 * boxes[ib]->getID() + 1];
+      m_progress->report("Loading and merging box data");
+    }
+  } catch (...) {
+    stopReaders();
+    throw;
+  }
+  stopReaders();
+  if (error)
+    std::rethrow_exception(error);
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform the merging, but clone the initial workspace and use the same
  *splitting
@@ -203,8 +370,11 @@ void MergeMDFiles::doExecByCloning(
   m_OutIWS = ws;
   m_MDEventType = ws->getEventTypeName();
 
-  // Run the tasks in parallel? TODO: enable
-  // bool Parallel = this->getProperty("Parallel");
+  // Run the tasks in parallel?
+  const bool parallel = this->getProperty("Parallel");
+  const int memoryLimit = this->getProperty("MemoryLimit");
+  const uint64_t memoryBytes = static_cast<uint64_t>(memoryLimit) * 1000000;
+  m_mappedOutput = m_fileBasedTargetWS && getProperty("SeparateEventFile");
 
   // Fix the box controller settings in the output workspace so that it splits
   // normally
@@ -215,20 +385,21 @@ void MergeMDFiles::doExecByCloning(
   // Fix the max depth to something bigger.
   bc->setMaxDepth(20);
   bc->setSplitThreshold(5000);
-  auto saver = std::shared_ptr<API::IBoxControllerIO>(
-      new DataObjects::BoxControllerNeXusIO(bc.get()));
+  std::shared_ptr<API::IBoxControllerIO> saver;
+  if (m_mappedOutput)
+    saver = std::make_shared<DataObjects::BoxControllerMappedIO>(bc.get());
+  else
+    saver = std::make_shared<DataObjects::BoxControllerNeXusIO>(bc.get());
   saver->setDataType(sizeof(coord_t), m_MDEventType);
   if (m_fileBasedTargetWS) {
     bc->setFileBacked(saver, outputFile);
     // Complete the file-back-end creation.
-    g_log.notice() << "Setting cache to 400 MB write.\n";
-    bc->getFileIO()->setWriteBufferSize(400000000 / m_OutIWS->sizeofEvent());
+    g_log.notice() << "Setting cache to " << memoryLimit / 4
+                   << " MB write.\n";
+    bc->getFileIO()->setWriteBufferSize(memoryBytes / 4 /
+                                        m_OutIWS->sizeofEvent());
   }
 
-  /*   else
-     {
-         saver->openFile(outputFile,"w");
-     }*/
   // Init box structure used for memory/file space calculations
   m_BoxStruct.initFlatStructure(ws, outputFile);
 
@@ -237,69 +408,29 @@ void MergeMDFiles::doExecByCloning(
   this->loadBoxData();
 
   size_t numBoxes = m_BoxStruct.getNBoxes();
-  // Progress report based on events processed.
+  // Progress report based on boxes merged.
   m_progress = std::make_unique<Progress>(this, 0.1, 0.9, size_t(numBoxes));
   m_progress->setNotifyStep(0.1);
 
-  // For tracking progress
-  // uint64_t m_totalEventsInTasks = 0;
-
-  // Prepare thread pool
   CPUTimer overallTime;
 
-  auto ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-
   Kernel::DiskBuffer *DiskBuf(nullptr);
   if (m_fileBasedTargetWS) {
     DiskBuf = bc->getFileIO();
   }
 
   this->m_totalLoaded = 0;
-  std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
+  // One thread saves the boxes the others read ahead
+  size_t nReaders(0);
+  if (parallel)
+    nReaders = static_cast<size_t>(
+        std::max(1, PARALLEL_GET_MAX_THREADS - 1));
+  this->mergeBoxes(nReaders, memoryBytes - memoryBytes / 4);
 
-  for (size_t ib = 0; ib < numBoxes; ib++) {
-    auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
-    // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(boxes[ib]);
-
-    if (DiskBuf) {
-      if (box->getDataInMemorySize() >
-          0) { // data position has been already pre-calculated
-        box->getISaveable()->save();
-        box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
-      }
-    }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
-  }
   if (DiskBuf) {
     DiskBuf->flushCache();
     bc->getFileIO()->flushData();
   }
-  //// Run any final tasks
-  // tp.joinAll();
   g_log.information() << overallTime << " to do all the adding.\n";
 
   // Close any open file handle
@@ -10,6 +10,7 @@
 #include "MantidAPI/IMDEventWorkspace.h"
 #include "MantidAPI/Progress.h"
 #include "MantidAPI/WorkspaceHistory.h"
+#include "MantidDataObjects/BoxControllerMappedIO.h"
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/MDBox.h"
 #include "MantidDataObjects/MDBoxFlatTree.h"
@@ -82,6 +83,23 @@ void SaveMD::init() {
   setPropertySettings("MakeFileBacked",
                       std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
                                                             IS_EQUAL_TO, "0"));
+
+  declareProperty("SeparateEventFile", false,
+                  "For an MDEventWorkspace that was created in memory:\n"
+                  "Save the events to a raw event file next to the NXS file "
+                  "instead of into it. The event file is memory-mapped when "
+                  "loaded, so many threads can read the events at once.");
+  setPropertySettings("SeparateEventFile",
+                      std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
+                                                            IS_EQUAL_TO, "0"));
+  declareProperty("CompressEvents", false,
+                  "For an MDEventWorkspace that was created in memory:\n"
+                  "Compress the events saved into the NXS file. The events "
+                  "are compressed in blocks, so a file-backed workspace still "
+                  "loads each box on its own.");
+  setPropertySettings("CompressEvents",
+                      std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
+                                                            IS_EQUAL_TO, "0"));
 }
 
 //----------------------------------------------------------------------------------------------
@@ -95,9 +113,14 @@ template <typename MDE, size_t nd>
 void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   bool updateFileBackend = getProperty("UpdateFileBackEnd");
   bool makeFileBackend = getProperty("MakeFileBacked");
+  const bool separateEventFile = getProperty("SeparateEventFile");
+  const bool compressEvents = getProperty("CompressEvents");
   if (updateFileBackend && makeFileBackend)
     throw std::invalid_argument(
         "Please choose either UpdateFileBackEnd or MakeFileBacked, not both.");
+  if (separateEventFile && compressEvents)
+    throw std::invalid_argument(
+        "Please choose either SeparateEventFile or CompressEvents, not both.");
 
   bool wsIsFileBacked = ws->isFileBacked();
   std::string filename = getPropertyValue("Filename");
@@ -154,6 +177,9 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
   {
     prepareUpdate<MDE, nd>(BoxFlatStruct, bc.get(), ws, filename);
   } else if (copyFile) {
+    if (dynamic_cast<BoxControllerMappedIO *>(bc->getFileIO()))
+      throw std::runtime_error("Saving a workspace backed by a separate event "
+                               "file to a new file is not supported.");
     // Update the original file
     if (ws->fileNeedsUpdating()) {
       prepareUpdate<MDE, nd>(BoxFlatStruct, bc.get(), ws, filename);
@@ -165,8 +191,15 @@ void SaveMD::doSaveEvents(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     // the boxes file positions are unknown and we need to calculate it.
     BoxFlatStruct.initFlatStructure(ws, filename);
     // create saver class
-    auto Saver = std::shared_ptr<API::IBoxControllerIO>(
-        new DataObjects::BoxControllerNeXusIO(bc.get()));
+    std::shared_ptr<API::IBoxControllerIO> Saver;
+    if (separateEventFile) {
+      Saver = std::make_shared<DataObjects::BoxControllerMappedIO>(bc.get());
+    } else {
+      auto nexusSaver =
+          std::make_shared<DataObjects::BoxControllerNeXusIO>(bc.get());
+      nexusSaver->setCompressed(compressEvents);
+      Saver = nexusSaver;
+    }
     Saver->setDataType(sizeof(coord_t), MDE::getTypeName());
     if (makeFileBackend) {
       // store saver with box controller
@@ -70,6 +70,22 @@ void SaveMD2::init() {
   setPropertySettings("MakeFileBacked",
                       std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
                                                             IS_EQUAL_TO, "0"));
+  declareProperty("SeparateEventFile", false,
+                  "For an MDEventWorkspace that was created in memory:\n"
+                  "Save the events to a raw event file next to the NXS file "
+                  "instead of into it. The event file is memory-mapped when "
+                  "loaded, so many threads can read the events at once.");
+  setPropertySettings("SeparateEventFile",
+                      std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
+                                                            IS_EQUAL_TO, "0"));
+  declareProperty("CompressEvents", false,
+                  "For an MDEventWorkspace that was created in memory:\n"
+                  "Compress the events saved into the NXS file. The events "
+                  "are compressed in blocks, so a file-backed workspace still "
+                  "loads each box on its own.");
+  setPropertySettings("CompressEvents",
+                      std::make_unique<EnabledWhenProperty>("UpdateFileBackEnd",
+                                                            IS_EQUAL_TO, "0"));
   declareProperty(
       "SaveHistory", true,
       "Option to not save the Mantid history in the file. Only for MDHisto");
@@ -236,6 +252,10 @@ void SaveMD2::exec() {
                                 getProperty("UpdateFileBackEnd"));
     saveMDv1->setProperty<bool>("MakeFileBacked",
                                 getProperty("MakeFileBacked"));
+    saveMDv1->setProperty<bool>("SeparateEventFile",
+                                getProperty("SeparateEventFile"));
+    saveMDv1->setProperty<bool>("CompressEvents",
+                                getProperty("CompressEvents"));
     saveMDv1->execute();
   } else if (histoWS) {
     this->doSaveHisto(histoWS);
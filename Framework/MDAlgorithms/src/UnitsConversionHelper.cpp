@@ -338,6 +338,35 @@ double UnitsConversionHelper::convertUnits(double val) const {
         "updateConversion: unknown type of conversion requested");
   }
 }
+/** convert many values from input to output units in place, as
+convertUnits(double) does for each of them, but calling the units once for all
+the values
+@param   first -- pointer to the first value to convert
+@param   last  -- pointer past the last value to convert
+*/
+void UnitsConversionHelper::convertUnits(double *first, double *last) const {
+  switch (m_UnitCnvrsn) {
+  case (CnvrtToMD::ConvertNo): {
+    return;
+  }
+  case (CnvrtToMD::ConvertFast): {
+    for (; first != last; ++first)
+      *first = m_Factor * std::pow(*first, m_Power);
+    return;
+  }
+  case (CnvrtToMD::ConvertFromTOF): {
+    m_TargetUnit->multipleFromTOF(first, last);
+    return;
+  }
+  case (CnvrtToMD::ConvertByTOF): {
+    m_SourceWSUnit->convertViaTOF(*m_TargetUnit, first, last);
+    return;
+  }
+  default:
+    throw std::runtime_error(
+        "updateConversion: unknown type of conversion requested");
+  }
+}
 // copy constructor;
 UnitsConversionHelper::UnitsConversionHelper(
     const UnitsConversionHelper &another) {
@@ -251,6 +251,62 @@ public:
                      out_ws->getSignalAt(3), 1.0, 1e-5);
   }
 
+  void addEventsForRun(MDEventWorkspace3 &ws, uint16_t runIndex) {
+    for (coord_t x = 0.5; x < 10; x++)
+      for (coord_t y = 0.5; y < 10; y++)
+        for (coord_t z = 0.5; z < 10; z++) {
+          const coord_t center[3] = {x, y, z};
+          ws.addEvent(MDEvent<3>(1.0, 1.0, runIndex, 0, center));
+        }
+    ws.splitAllIfNeeded(nullptr);
+    ws.refreshCache();
+  }
+
+  MDHistoWorkspace_sptr binRuns(int firstRunIndex,
+                                const MDHistoWorkspace_sptr &accumulated) {
+    BinMD alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setPropertyValue("InputWorkspace", "BinMDTest_ws");
+    alg.setPropertyValue("AlignedDim0", "Axis0,0.0,10.0, 5");
+    alg.setPropertyValue("AlignedDim1", "Axis1,0.0,10.0, 5");
+    alg.setPropertyValue("AlignedDim2", "Axis2,0.0,10.0, 5");
+    alg.setProperty("FirstRunIndex", firstRunIndex);
+    if (accumulated)
+      alg.setProperty<IMDHistoWorkspace_sptr>("TemporaryDataWorkspace",
+                                              accumulated);
+    alg.setPropertyValue("OutputWorkspace", "BinMDTest_histo");
+    alg.execute();
+    return AnalysisDataService::Instance().retrieveWS<MDHistoWorkspace>(
+        "BinMDTest_histo");
+  }
+
+  void test_exec_FirstRunIndex_adds_only_the_new_runs() {
+    auto in_ws = MDEventsTestHelper::makeMDEWFull<3>(10, 0.0, 10.0, 0);
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", in_ws);
+    // One event in the centre of each unit cube for run 0
+    addEventsForRun(*in_ws, 0);
+    auto binned = binRuns(0, nullptr);
+    TS_ASSERT_DELTA(binned->getSignalAt(0), 8.0, 1e-5);
+
+    // Append run 1 and only bin its events into the existing histogram
+    addEventsForRun(*in_ws, 1);
+    binned = binRuns(1, binned);
+    TS_ASSERT_DELTA(binned->getSignalAt(0), 16.0, 1e-5);
+    TS_ASSERT_DELTA(binned->getNumEventsAt(124), 16.0, 1e-5);
+
+    // The events of run 1 only
+    auto newRuns = binRuns(1, nullptr);
+    TS_ASSERT_DELTA(newRuns->getSignalAt(0), 8.0, 1e-5);
+
+    // Lean events do not know their run
+    auto lean_ws = MDEventsTestHelper::makeMDEW<3>(10, 0.0, 10.0, 1);
+    AnalysisDataService::Instance().addOrReplace("BinMDTest_ws", lean_ws);
+    TS_ASSERT_THROWS_ANYTHING(binRuns(1, nullptr));
+    AnalysisDataService::Instance().remove("BinMDTest_ws");
+    AnalysisDataService::Instance().remove("BinMDTest_histo");
+  }
+
   void test_exec_3D() {
     do_test_exec("", "Axis0,2.0,8.0, 6", "Axis1,2.0,8.0, 6", "Axis2,2.0,8.0, 6",
                  "", 1.0 /*signal*/, 6 * 6 * 6 /*# of bins*/,
@@ -1150,6 +1206,33 @@ public:
     TS_ASSERT(alg.isExecuted());
   }
 
+  void test_3D_60cube_nonAligned_IterateEvents() {
+    // A rotation about Z, which transforms every event through the matrix
+    const double angle = 0.3;
+    BinMD alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("InputWorkspace", "BinMDTest_ws"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("AxisAligned", false));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue(
+        "BasisVector0",
+        "OutX,m," + VMD(cos(angle), sin(angle), 0.0).toString(",")));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue(
+        "BasisVector1",
+        "OutY,m," + VMD(-sin(angle), cos(angle), 0.0).toString(",")));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("BasisVector2", "OutZ,m,0,0,1"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("BasisVector3", ""));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("OutputBins", "60,60,60"));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setProperty("OutputExtents", "0,10, 0,10, 0,10"));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("IterateEvents", true));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setPropertyValue("OutputWorkspace", "BinMDTest_ws_histo"));
+    TS_ASSERT_THROWS_NOTHING(alg.execute();)
+    TS_ASSERT(alg.isExecuted());
+  }
+
   void test_3D_60cube_IterateEvents() {
     for (size_t i = 0; i < 1; i++)
       do_test("2.0,8.0, 60", true);
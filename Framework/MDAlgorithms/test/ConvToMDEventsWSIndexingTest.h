@@ -8,6 +8,7 @@
 
 #include <cxxtest/TestSuite.h>
 
+#include "MantidDataObjects/MDEventTreeBuilder.h"
 #include "MantidMDAlgorithms/ConvToMDEventsWSIndexing.h"
 #include <ostream>
 #include <stdexcept>
@@ -221,7 +222,7 @@ class ConvToMDEventsWSIndexingTest : public CxxTest::TestSuite {
   using MDEventStore = std::vector<MDEvent>;
   using MDEventIterator = MDEventStore ::iterator;
   using TreeBuilder =
-      Mantid::MDAlgorithms::MDEventTreeBuilder<ND, MDEventTml, MDEventIterator>;
+      Mantid::DataObjects::MDEventTreeBuilder<ND, MDEvent, MDEventIterator>;
 
   const std::array<double, 3> lowerLeft = {{0, 0, 0}};
   const std::array<double, 3> upperRight = {{8, 8, 8}};
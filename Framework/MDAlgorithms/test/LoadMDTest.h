@@ -176,7 +176,9 @@ public:
   //=================================================================================================================
   template <size_t nd>
   void do_test_exec(bool FileBackEnd, bool deleteWorkspace = true,
-                    double memory = 0, bool BoxStructureOnly = false) {
+                    double memory = 0, bool BoxStructureOnly = false,
+                    bool SeparateEventFile = false,
+                    bool CompressEvents = false) {
     using MDE = MDLeanEvent<nd>;
 
     //------ Start by creating the file
@@ -209,6 +211,10 @@ public:
         saver.setProperty("InputWorkspace", "LoadMDTest_ws"));
     TS_ASSERT_THROWS_NOTHING(saver.setPropertyValue(
         "Filename", "LoadMDTest" + Strings::toString(nd) + ".nxs"));
+    TS_ASSERT_THROWS_NOTHING(
+        saver.setProperty("SeparateEventFile", SeparateEventFile));
+    TS_ASSERT_THROWS_NOTHING(
+        saver.setProperty("CompressEvents", CompressEvents));
 
     // Retrieve the full path; delete any pre-existing file
     std::string filename = saver.getPropertyValue("Filename");
@@ -276,6 +282,8 @@ public:
       AnalysisDataService::Instance().remove(outWSName);
       if (Poco::File(filename).exists())
         Poco::File(filename).remove();
+      if (Poco::File(filename + ".events").exists())
+        Poco::File(filename + ".events").remove();
     }
   }
 
@@ -422,6 +430,26 @@ public:
     do_test_UpdateFileBackEnd<3>();
   }
 
+  /// Load directly to memory from a memory-mapped event file
+  void test_exec_3D_with_separate_event_file() {
+    do_test_exec<3>(false, true, 0, false, true);
+  }
+
+  /// Keep the events in a memory-mapped event file and load on demand
+  void test_exec_3D_with_FileBackEnd_and_separate_event_file() {
+    do_test_exec<3>(true, true, 0, false, true);
+  }
+
+  /// Load directly to memory from compressed events
+  void test_exec_3D_with_compressed_events() {
+    do_test_exec<3>(false, true, 0, false, false, true);
+  }
+
+  /// Keep the compressed events on file and load them on demand
+  void test_exec_3D_with_FileBackEnd_and_compressed_events() {
+    do_test_exec<3>(true, true, 1.0, false, false, true);
+  }
+
   /// Only load the box structure, no events
   void test_exec_3D_BoxStructureOnly() {
     do_test_exec<3>(false, true, 0.0, true);
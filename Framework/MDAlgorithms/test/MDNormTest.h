@@ -0,0 +1,244 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/AnalysisDataService.h"
+#include "MantidAPI/IMDHistoWorkspace.h"
+#include "MantidAPI/Run.h"
+#include "MantidDataObjects/MDEventFactory.h"
+#include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidMDAlgorithms/CreateMDWorkspace.h"
+#include "MantidMDAlgorithms/MDNorm.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <numeric>
+
+using Mantid::coord_t;
+using Mantid::MDAlgorithms::MDNorm;
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+
+class MDNormTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDNormTest *createSuite() { return new MDNormTest(); }
+  static void destroySuite(MDNormTest *suite) { delete suite; }
+
+  void tearDown() override { AnalysisDataService::Instance().clear(); }
+
+  void test_Init() {
+    MDNorm alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT(alg.isInitialized())
+  }
+
+  void test_FirstRunIndex_needs_the_temporary_workspaces() {
+    auto ws = createMDWorkspace();
+    addRun(*ws, 0.);
+    addRun(*ws, 30.);
+
+    MDNorm alg;
+    alg.initialize();
+    alg.setProperty<IMDEventWorkspace_sptr>("InputWorkspace", ws);
+    alg.setProperty("FirstRunIndex", 1);
+    IAlgorithm &base = alg;
+    const auto errors = base.validateInputs();
+    TS_ASSERT_EQUALS(errors.count("FirstRunIndex"), 1)
+  }
+
+  void test_FirstRunIndex_must_be_less_than_the_number_of_runs() {
+    auto ws = createMDWorkspace();
+    addRun(*ws, 0.);
+    runMDNorm(ws, 0, "MDNormTest_data", "MDNormTest_norm");
+
+    MDNorm alg;
+    alg.initialize();
+    alg.setProperty<IMDEventWorkspace_sptr>("InputWorkspace", ws);
+    alg.setPropertyValue("TemporaryDataWorkspace", "MDNormTest_data");
+    alg.setPropertyValue("TemporaryNormalizationWorkspace", "MDNormTest_norm");
+    alg.setProperty("FirstRunIndex", 1);
+    IAlgorithm &base = alg;
+    const auto errors = base.validateInputs();
+    TS_ASSERT_EQUALS(errors.count("FirstRunIndex"), 1)
+  }
+
+  void test_FirstRunIndex_adds_only_the_new_runs() {
+    auto ws = createMDWorkspace();
+    addRun(*ws, 0.);
+    runMDNorm(ws, 0, "MDNormTest_data", "MDNormTest_norm");
+    const double firstRunData = sumSignals("MDNormTest_data");
+    const double firstRunNorm = sumSignals("MDNormTest_norm");
+    TS_ASSERT_DELTA(firstRunData, 8., 1e-10)
+    TS_ASSERT(firstRunNorm > 0.)
+
+    // Append a second run and add only that one to the temporary workspaces
+    addRun(*ws, 30.);
+    runMDNorm(ws, 1, "MDNormTest_data", "MDNormTest_norm");
+    // Both runs from scratch
+    runMDNorm(ws, 0, "MDNormTest_allData", "MDNormTest_allNorm");
+
+    TS_ASSERT_DELTA(sumSignals("MDNormTest_data"), 16., 1e-10)
+    TS_ASSERT(sumSignals("MDNormTest_norm") > firstRunNorm)
+    compareSignals("MDNormTest_data", "MDNormTest_allData");
+    compareSignals("MDNormTest_norm", "MDNormTest_allNorm");
+  }
+
+  void test_normalization_does_not_depend_on_the_number_of_threads() {
+    auto ws = createMDWorkspace();
+    addRun(*ws, 0.);
+    addRun(*ws, 30.);
+    runMDNorm(ws, 0, "MDNormTest_data", "MDNormTest_norm");
+
+    const int maxThreads = PARALLEL_GET_MAX_THREADS;
+    PARALLEL_SET_NUM_THREADS(1);
+    runMDNorm(ws, 0, "MDNormTest_data1", "MDNormTest_norm1");
+    PARALLEL_SET_NUM_THREADS(maxThreads);
+
+    TS_ASSERT(sumSignals("MDNormTest_norm") > 0.)
+    compareSignals("MDNormTest_norm", "MDNormTest_norm1");
+  }
+
+  void test_detectors_missing_from_the_SolidAngleWorkspace_are_skipped() {
+    auto ws = createMDWorkspace();
+    addRun(*ws, 0.);
+    auto solidAngles =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(
+            m_nSpectra, 1);
+    auto zeroSolidAngle = solidAngles->clone();
+    zeroSolidAngle->mutableY(3)[0] = 0.;
+    auto missingDetector = solidAngles->clone();
+    missingDetector->getSpectrum(3).clearDetectorIDs();
+
+    // The same algorithm for all, so that nothing may be kept from the
+    // previous execution
+    MDNorm alg;
+    alg.initialize();
+    alg.setProperty<MatrixWorkspace_sptr>("SolidAngleWorkspace", solidAngles);
+    runMDNorm(alg, ws, 0, "MDNormTest_data", "MDNormTest_norm");
+    const double allDetectors = sumSignals("MDNormTest_norm");
+    alg.setProperty<MatrixWorkspace_sptr>("SolidAngleWorkspace",
+                                          std::move(zeroSolidAngle));
+    runMDNorm(alg, ws, 0, "MDNormTest_data", "MDNormTest_norm");
+    const double zeroDetector = sumSignals("MDNormTest_norm");
+    alg.setProperty<MatrixWorkspace_sptr>("SolidAngleWorkspace",
+                                          std::move(missingDetector));
+    runMDNorm(alg, ws, 0, "MDNormTest_data", "MDNormTest_norm");
+
+    TS_ASSERT(zeroDetector > 0.)
+    TS_ASSERT(zeroDetector < allDetectors)
+    TS_ASSERT_DELTA(sumSignals("MDNormTest_norm"), zeroDetector, 1e-10)
+  }
+
+private:
+  /// Number of spectra of the instrument
+  static constexpr int m_nSpectra = 100;
+
+  /// An empty inelastic MDEventWorkspace in Q_sample
+  IMDEventWorkspace_sptr createMDWorkspace() {
+    Mantid::MDAlgorithms::CreateMDWorkspace alg;
+    alg.initialize();
+    alg.setRethrows(true);
+    alg.setProperty("Dimensions", 4);
+    alg.setPropertyValue("EventType", "MDEvent");
+    alg.setPropertyValue("Extents", "-2,2,-2,2,-2,2,-5,5");
+    alg.setPropertyValue("Names", "Q_sample_x,Q_sample_y,Q_sample_z,DeltaE");
+    alg.setPropertyValue("Units", "A^-1,A^-1,A^-1,meV");
+    alg.setPropertyValue("Frames", "QSample,QSample,QSample,General Frame");
+    alg.setPropertyValue("OutputWorkspace", "MDNormTest_ws");
+    alg.execute();
+    return AnalysisDataService::Instance().retrieveWS<IMDEventWorkspace>(
+        "MDNormTest_ws");
+  }
+
+  /**
+   * Append a run with the goniometer rotated by omega around the vertical
+   * axis, and 8 events of weight 1 within the binning of runMDNorm
+   */
+  void addRun(IMDEventWorkspace &ws, double omega) {
+    auto matrixWS =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(
+            m_nSpectra, 1);
+    auto &run = matrixWS->mutableRun();
+    run.addProperty("Ei", 20.);
+    run.addProperty("MDNorm_low", std::vector<double>(m_nSpectra, -5.));
+    run.addProperty("MDNorm_high", std::vector<double>(m_nSpectra, 5.));
+    run.setProtonCharge(1.);
+    Mantid::Geometry::Goniometer goniometer;
+    goniometer.pushAxis("omega", 0., 1., 0., omega);
+    run.setGoniometer(goniometer, false);
+    const auto runIndex = ws.addExperimentInfo(
+        ExperimentInfo_sptr(matrixWS->cloneExperimentInfo()));
+
+    auto &events = dynamic_cast<MDEventWorkspace<MDEvent<4>, 4> &>(ws);
+    for (coord_t x : {-0.5f, 0.5f})
+      for (coord_t z : {-0.5f, 0.5f})
+        for (coord_t deltaE : {-2.5f, 2.5f}) {
+          const coord_t center[4] = {x, 0.1f, z, deltaE};
+          events.addEvent(MDEvent<4>(1.f, 1.f, runIndex, 1, center));
+        }
+    events.splitAllIfNeeded(nullptr);
+    events.refreshCache();
+  }
+
+  /**
+   * Run MDNorm in Q_sample. From a FirstRunIndex above 0 the runs are added
+   * to the data and normalization workspaces of the earlier runs
+   */
+  void runMDNorm(const IMDEventWorkspace_sptr &ws, int firstRunIndex,
+                 const std::string &dataName, const std::string &normName) {
+    MDNorm alg;
+    runMDNorm(alg, ws, firstRunIndex, dataName, normName);
+  }
+
+  void runMDNorm(MDNorm &alg, const IMDEventWorkspace_sptr &ws,
+                 int firstRunIndex, const std::string &dataName,
+                 const std::string &normName) {
+    if (!alg.isInitialized())
+      alg.initialize();
+    alg.setRethrows(true);
+    alg.setProperty<IMDEventWorkspace_sptr>("InputWorkspace", ws);
+    alg.setProperty("RLU", false);
+    alg.setPropertyValue("Dimension0Binning", "-1,0.2,1");
+    alg.setPropertyValue("Dimension1Binning", "-1,1");
+    alg.setPropertyValue("Dimension2Binning", "-1,0.2,1");
+    alg.setPropertyValue("Dimension3Name", "DeltaE");
+    alg.setPropertyValue("Dimension3Binning", "-5,1,5");
+    if (firstRunIndex > 0) {
+      alg.setPropertyValue("TemporaryDataWorkspace", dataName);
+      alg.setPropertyValue("TemporaryNormalizationWorkspace", normName);
+      alg.setProperty("FirstRunIndex", firstRunIndex);
+    }
+    alg.setPropertyValue("OutputWorkspace", "MDNormTest_out");
+    alg.setPropertyValue("OutputDataWorkspace", dataName);
+    alg.setPropertyValue("OutputNormalizationWorkspace", normName);
+    TS_ASSERT_THROWS_NOTHING(alg.execute())
+  }
+
+  static IMDHistoWorkspace_sptr retrieveHisto(const std::string &name) {
+    return AnalysisDataService::Instance().retrieveWS<IMDHistoWorkspace>(
+        name);
+  }
+
+  static double sumSignals(const std::string &name) {
+    const auto ws = retrieveHisto(name);
+    const auto signals = ws->getSignalArray();
+    return std::accumulate(signals, signals + ws->getNPoints(), 0.);
+  }
+
+  static void compareSignals(const std::string &name,
+                             const std::string &expectedName) {
+    const auto ws = retrieveHisto(name);
+    const auto expected = retrieveHisto(expectedName);
+    TS_ASSERT_EQUALS(ws->getNPoints(), expected->getNPoints())
+    for (size_t i = 0; i < ws->getNPoints(); ++i)
+      TS_ASSERT_DELTA(ws->getSignalAt(i), expected->getSignalAt(i), 1e-10)
+  }
+};
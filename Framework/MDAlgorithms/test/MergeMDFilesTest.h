@@ -32,7 +32,15 @@ public:
 
   void test_exec_fileBacked() { do_test_exec("MergeMDFilesTest_OutputWS.nxs"); }
 
-  void do_test_exec(const std::string &OutputFilename) {
+  void test_exec_parallel_with_small_memory_limit() {
+    // the readers share the read-ahead budget with the box being saved
+    do_test_exec("MergeMDFilesTest_OutputWS.nxs", true, 1, true);
+  }
+
+  void test_exec_parallel_inMemory() { do_test_exec("", true); }
+
+  void do_test_exec(const std::string &OutputFilename, bool parallel = false,
+                    int memoryLimit = 1600, bool separateEventFile = false) {
     if (OutputFilename != "") {
       if (Poco::File(OutputFilename).exists())
         Poco::File(OutputFilename).remove();
@@ -68,6 +76,10 @@ public:
         alg.setPropertyValue("OutputFilename", OutputFilename));
     TS_ASSERT_THROWS_NOTHING(
         alg.setPropertyValue("OutputWorkspace", outWSName));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("Parallel", parallel));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("MemoryLimit", memoryLimit));
+    TS_ASSERT_THROWS_NOTHING(
+        alg.setProperty("SeparateEventFile", separateEventFile));
 
     // clean up possible rubbish from previous runs
     std::string fullName = alg.getPropertyValue("OutputFilename");
@@ -102,8 +114,12 @@ public:
     if (!OutputFilename.empty()) {
       TS_ASSERT(ws->isFileBacked());
       TS_ASSERT(Poco::File(actualOutputFilename).exists());
+      const std::string eventFilename = actualOutputFilename + ".events";
+      TS_ASSERT_EQUALS(Poco::File(eventFilename).exists(), separateEventFile);
       ws->clearFileBacked(false);
       Poco::File(actualOutputFilename).remove();
+      if (separateEventFile)
+        Poco::File(eventFilename).remove();
     }
 
     // Cleanup generated input files
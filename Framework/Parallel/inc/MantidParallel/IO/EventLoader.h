@@ -44,7 +44,7 @@ load(const std::string &filename, const std::string &groupName,
      const std::vector<std::string> &bankNames,
      const std::vector<int32_t> &bankOffsets,
      const std::vector<std::vector<Types::Event::TofEvent> *> &eventLists,
-     bool precalcEvents);
+     bool precalcEvents, bool balanced = false);
 
 } // namespace EventLoader
 
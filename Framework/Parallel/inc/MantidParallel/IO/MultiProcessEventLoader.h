@@ -8,6 +8,7 @@
 
 #include <atomic>
 #include <boost/numeric/conversion/cast.hpp>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -17,6 +18,7 @@
 
 #include "MantidParallel/IO/EventLoaderHelpers.h"
 #include "MantidParallel/IO/EventsListsShmemStorage.h"
+#include "MantidParallel/IO/SharedChunkQueue.h"
 
 #include "MantidParallel/DllConfig.h"
 
@@ -38,6 +40,12 @@ namespace IO {
  * 2. Load data from bank -> sort by pixels in local memory
  *      -> copy from local to shared memory: LoadType::producerConsumer
  *      (uses dynamic allocation in local memory that is not so bad).
+ * 3. As 2., but instead of a fixed range of events every process claims
+ *      ranges from a SharedChunkQueue until all are loaded. Banks are
+ *      partitioned by size in bytes and the ranges follow the throughput of
+ *      each process, so processes finishing early help the others; the
+ *      shared memory segment is sized once all events of the process are
+ *      known: LoadType::balancedChunks.
  *
  * There 3 main time consuming parts: reading from file, pushing to shared
  * memory, collecting from shared memory, the cost of sorting is small.
@@ -47,14 +55,26 @@ namespace IO {
 */
 class MANTID_PARALLEL_DLL MultiProcessEventLoader {
 public:
+  enum struct LoadType { preCalcEvents, producerConsumer, balancedChunks };
+
   MultiProcessEventLoader(uint32_t numPixels, uint32_t numProcesses,
                           uint32_t numThreads, const std::string &binary,
                           bool precalc = true);
-  void
-  load(const std::string &filename, const std::string &groupname,
-       const std::vector<std::string> &bankNames,
-       const std::vector<int32_t> &bankOffsets,
-       std::vector<std::vector<Types::Event::TofEvent> *> eventLists) const;
+  MultiProcessEventLoader(uint32_t numPixels, uint32_t numProcesses,
+                          uint32_t numThreads, const std::string &binary,
+                          LoadType loadType);
+  void load(const std::string &filename, const std::string &groupname,
+            const std::vector<std::string> &bankNames,
+            const std::vector<int32_t> &bankOffsets,
+            std::vector<std::vector<Types::Event::TofEvent> *> eventLists);
+
+  /// Work done and time spent in each stage by each process in the last load
+  /// with LoadType::balancedChunks
+  const std::vector<SharedChunkQueue::Statistics> &processStatistics() const {
+    return m_processStatistics;
+  }
+  /// Time spent collecting the events from shared memory in the last load
+  double assembleSeconds() const { return m_assembleSeconds; }
 
   static void fillFromFile(EventsListsShmemStorage &storage,
                            const std::string &filename,
@@ -63,13 +83,34 @@ public:
                            const std::vector<int32_t> &bankOffsets,
                            std::size_t from, std::size_t to, bool precalc);
 
-  enum struct LoadType { preCalcEvents, producerConsumer };
+  static void fillBalanced(const std::string &segmentName,
+                           const std::string &storageName, int procId,
+                           std::size_t numPixels, const std::string &filename,
+                           const std::string &groupname,
+                           const std::vector<std::string> &bankNames,
+                           const std::vector<int32_t> &bankOffsets);
+
+  static std::string queueName(const std::string &storageName);
 
 private:
   static std::vector<std::string> generateSegmentsName(uint32_t procNum);
   static std::string generateStoragename();
   static std::string generateTimeBasedPrefix();
 
+  template <typename T>
+  static void
+  loadBalanced(SharedChunkQueue &queue, int procId,
+               std::vector<std::vector<Types::Event::TofEvent>> &pixels,
+               const H5::Group &instrument,
+               const std::vector<std::string> &bankNames,
+               const std::vector<int32_t> &bankOffsets);
+
+  static void loadBalancedWrapper(
+      const H5::DataType &type, SharedChunkQueue &queue, int procId,
+      std::vector<std::vector<Types::Event::TofEvent>> &pixels,
+      const H5::Group &instrument, const std::vector<std::string> &bankNames,
+      const std::vector<int32_t> &bankOffsets);
+
   template <typename MultiProcessEventLoader::LoadType LT =
                 LoadType::preCalcEvents>
   struct GroupLoader {
@@ -92,15 +133,18 @@ private:
       std::vector<std::vector<Mantid::Types::Event::TofEvent> *> &result) const;
 
   size_t estimateShmemAmount(size_t eventCount) const;
+  static size_t shmemAmount(size_t eventCount, size_t numPixels);
 
 private:
-  bool m_precalculateEvents;
+  LoadType m_loadType;
   uint32_t m_numPixels;
   uint32_t m_numProcesses;
   uint32_t m_numThreads;
   std::string m_binaryToLaunch;
   std::vector<std::string> m_segmentNames;
   std::string m_storageName;
+  std::vector<SharedChunkQueue::Statistics> m_processStatistics;
+  double m_assembleSeconds{0.};
 };
 
 /// Wrapper to avoid manual processing of all cases of 2 template arguments
@@ -369,6 +413,45 @@ void MultiProcessEventLoader::GroupLoader<
   }
 }
 
+/**Loads the ranges of events claimed from the queue into per pixel event
+ * lists in local memory. Implements the 'balanced chunks' strategy*/
+template <typename T>
+void MultiProcessEventLoader::loadBalanced(
+    SharedChunkQueue &queue, const int procId,
+    std::vector<std::vector<TofEvent>> &pixels, const H5::Group &instrument,
+    const std::vector<std::string> &bankNames,
+    const std::vector<int32_t> &bankOffsets) {
+  using Clock = std::chrono::steady_clock;
+  const auto secondsSince = [](const Clock::time_point &start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+  };
+
+  std::vector<int32_t> eventId;
+  std::vector<T> eventTimeOffset;
+  IO::NXEventDataLoader<T> loader(1, instrument, bankNames);
+  for (auto range = queue.claim(procId); range.eventCount > 0;
+       range = queue.claim(procId)) {
+    const auto readStart = Clock::now();
+    auto part = loader.setBankIndex(range.bankIndex);
+    eventTimeOffset.resize(range.eventCount);
+    loader.readEventTimeOffset(eventTimeOffset.data(), range.eventOffset,
+                               range.eventCount);
+    eventId.resize(range.eventCount);
+    loader.readEventID(eventId.data(), range.eventOffset, range.eventCount);
+    const double readSeconds = secondsSince(readStart);
+
+    const auto sortStart = Clock::now();
+    detail::eventIdToGlobalSpectrumIndex(eventId.data(), range.eventCount,
+                                         bankOffsets[range.bankIndex]);
+    part->setEventOffset(range.eventOffset);
+    for (std::size_t i = 0; i < range.eventCount; ++i)
+      pixels.at(eventId[i])
+          .emplace_back(boost::numeric_cast<ToFType>(eventTimeOffset[i]),
+                        part->next());
+    queue.recordChunk(procId, range, readSeconds, secondsSince(sortStart));
+  }
+}
+
 } // namespace IO
 } // namespace Parallel
 } // namespace Mantid
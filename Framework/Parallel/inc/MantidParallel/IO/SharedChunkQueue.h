@@ -0,0 +1,78 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidParallel/DllConfig.h"
+#include "MantidParallel/IO/Chunker.h"
+
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Parallel {
+namespace IO {
+
+/** SharedChunkQueue : queue of event ranges to load, shared in a named shared
+ * memory segment by the processes of MultiProcessEventLoader.
+ *
+ * Banks are first partitioned between the processes by their size in bytes
+ * using Chunker::makeBalancedPartitioning, so each process starts reading
+ * from its own banks. Processes then claim ranges of events one at a time.
+ * The size of a range follows the throughput the claiming process has shown
+ * so far, so every range takes roughly the same time to load, and shrinks as
+ * the remaining work runs out. A process that has finished its own banks
+ * takes ranges from the bank with the most work left, wherever it is. Time
+ * spent in each stage is recorded per process.
+ */
+class MANTID_PARALLEL_DLL SharedChunkQueue {
+public:
+  /// Work done and time spent in each stage by one process
+  struct Statistics {
+    size_t chunks{0};
+    size_t events{0};
+    size_t bytes{0};
+    double readSeconds{0.};
+    double sortSeconds{0.};
+    double copySeconds{0.};
+  };
+
+  SharedChunkQueue(const std::string &name,
+                   const std::vector<size_t> &bankSizes,
+                   const std::vector<size_t> &bytesPerEvent,
+                   const int numProcesses, const size_t minChunkBytes,
+                   const size_t maxChunkBytes, const double secondsPerChunk);
+  explicit SharedChunkQueue(const std::string &name);
+  SharedChunkQueue(const SharedChunkQueue &) = delete;
+  SharedChunkQueue &operator=(const SharedChunkQueue &) = delete;
+  ~SharedChunkQueue();
+
+  Chunker::LoadRange claim(const int process);
+  void recordChunk(const int process, const Chunker::LoadRange &range,
+                   const double readSeconds, const double sortSeconds);
+  void recordCopy(const int process, const double copySeconds);
+  std::vector<Statistics> statistics() const;
+
+private:
+  struct Header;
+  struct Bank;
+  struct Process;
+
+  size_t chunkBytes(const Process &process, const size_t remainingBytes) const;
+
+  const std::string m_name;
+  const bool m_owner;
+  std::unique_ptr<boost::interprocess::managed_shared_memory> m_segment;
+  Header *m_header;
+  Bank *m_banks;
+  Process *m_processes;
+};
+
+} // namespace IO
+} // namespace Parallel
+} // namespace Mantid
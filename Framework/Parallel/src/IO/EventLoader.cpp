@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidParallel/IO/EventLoader.h"
 #include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
 #include "MantidKernel/MantidVersion.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidParallel/IO/EventLoaderHelpers.h"
@@ -56,12 +57,42 @@ void load(
        bankNames, bankOffsets, std::move(eventLists));
 }
 
-/// Load events from given banks into event lists.
+namespace {
+Kernel::Logger g_log("EventLoader");
+
+/// Log the time each process of a multiprocess load spent in each stage
+void logStatistics(const MultiProcessEventLoader &loader) {
+  const auto &statistics = loader.processStatistics();
+  for (size_t i = 0; i < statistics.size(); ++i) {
+    const auto &stats = statistics[i];
+    g_log.information() << "Process " << i << " loaded " << stats.events
+                        << " events (" << stats.bytes / (1024 * 1024)
+                        << " MB) in " << stats.chunks << " chunks: read "
+                        << stats.readSeconds << " s, sort "
+                        << stats.sortSeconds << " s, copy to shared memory "
+                        << stats.copySeconds << " s\n";
+  }
+  g_log.information() << "Collected events from shared memory in "
+                      << loader.assembleSeconds() << " s\n";
+}
+} // namespace
+
+/** Load events from given banks into event lists using several processes.
+ * @param filename :: the NeXus file
+ * @param groupname :: the group holding the banks
+ * @param bankNames :: names of the banks to load
+ * @param bankOffsets :: offsets from event ID to global spectrum index
+ * @param eventLists :: the event lists to fill
+ * @param precalcEvents :: count the events of each pixel before copying them
+ * to shared memory
+ * @param balanced :: let processes claim ranges of events sized by their
+ * throughput, instead of a fixed share of the events each
+ */
 void load(const std::string &filename, const std::string &groupname,
           const std::vector<std::string> &bankNames,
           const std::vector<int32_t> &bankOffsets,
           const std::vector<std::vector<Types::Event::TofEvent> *> &eventLists,
-          bool precalcEvents) {
+          bool precalcEvents, bool balanced) {
   auto concurencyNumber = PARALLEL_GET_MAX_THREADS;
   auto numThreads = std::max<int>(concurencyNumber / 2, 1);
   auto numProceses = std::max<int>(concurencyNumber / 2, 1);
@@ -69,10 +100,16 @@ void load(const std::string &filename, const std::string &groupname,
       Kernel::ConfigService::Instance().getPropertiesDir() +
       "/MantidNexusParallelLoader";
 
+  using LoadType = MultiProcessEventLoader::LoadType;
+  const auto loadType =
+      balanced ? LoadType::balancedChunks
+               : precalcEvents ? LoadType::preCalcEvents
+                               : LoadType::producerConsumer;
   MultiProcessEventLoader loader(static_cast<unsigned>(eventLists.size()),
                                  numProceses, numThreads, executableName,
-                                 precalcEvents);
+                                 loadType);
   loader.load(filename, groupname, bankNames, bankOffsets, eventLists);
+  logStatistics(loader);
 }
 
 } // namespace EventLoader
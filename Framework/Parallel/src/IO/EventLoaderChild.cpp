@@ -14,14 +14,15 @@ using namespace Mantid::Types;
 int main(int argc, char **argv) {
   const std::string segmentName(argv[1]);
   const std::string storageName(argv[2]);
-  //  unsigned procId = std::atoi(argv[3]);
+  const int procId = std::atoi(argv[3]);
   unsigned firstEvent = std::atoi(argv[4]);
   unsigned upperEvent = std::atoi(argv[5]);
   unsigned numPixels = std::atoi(argv[6]);
   std::size_t size = std::atoll(argv[7]);
   const std::string fileName(argv[8]);
   const std::string groupName(argv[9]);
-  const bool precalcEvents = std::atoi(argv[10]);
+  // 0: producer-consumer, 1: pre-calculated events, 2: balanced chunks
+  const int loadType = std::atoi(argv[10]);
 
   std::vector<std::string> bankNames;
   std::vector<int32_t> bankOffsets;
@@ -30,11 +31,19 @@ int main(int argc, char **argv) {
     bankOffsets.emplace_back(std::atoi(argv[i + 1]));
   }
 
-  EventsListsShmemStorage storage(segmentName, storageName, size, 1, numPixels);
   try {
+    if (loadType == 2) {
+      // The storage is created once the number of events is known
+      MultiProcessEventLoader::fillBalanced(segmentName, storageName, procId,
+                                            numPixels, fileName, groupName,
+                                            bankNames, bankOffsets);
+      return 0;
+    }
+    EventsListsShmemStorage storage(segmentName, storageName, size, 1,
+                                    numPixels);
     MultiProcessEventLoader::fillFromFile(storage, fileName, groupName,
                                           bankNames, bankOffsets, firstEvent,
-                                          upperEvent, precalcEvents);
+                                          upperEvent, loadType == 1);
   } catch (...) {
     return 1;
   }
@@ -29,7 +29,17 @@ MultiProcessEventLoader::MultiProcessEventLoader(uint32_t numPixels,
                                                  uint32_t numThreads,
                                                  const std::string &binary,
                                                  bool precalc)
-    : m_precalculateEvents(precalc), m_numPixels(numPixels),
+    : MultiProcessEventLoader(numPixels, numProcesses, numThreads, binary,
+                              precalc ? LoadType::preCalcEvents
+                                      : LoadType::producerConsumer) {}
+
+/// Constructor
+MultiProcessEventLoader::MultiProcessEventLoader(uint32_t numPixels,
+                                                 uint32_t numProcesses,
+                                                 uint32_t numThreads,
+                                                 const std::string &binary,
+                                                 LoadType loadType)
+    : m_loadType(loadType), m_numPixels(numPixels),
       m_numProcesses(numProcesses), m_numThreads(numThreads),
       m_binaryToLaunch(binary),
       m_segmentNames(generateSegmentsName(numProcesses)),
@@ -52,6 +62,11 @@ std::string MultiProcessEventLoader::generateStoragename() {
   return generateTimeBasedPrefix() + "_mantid_multiprocess_NXloader_storage";
 }
 
+/// Name of the shared memory segment holding the queue of event ranges
+std::string MultiProcessEventLoader::queueName(const std::string &storageName) {
+  return storageName + "_queue";
+}
+
 /// Generates "unique" prefix for shared memory stuff
 std::string MultiProcessEventLoader::generateTimeBasedPrefix() {
   auto now = std::chrono::system_clock::now();
@@ -62,13 +77,50 @@ std::string MultiProcessEventLoader::generateTimeBasedPrefix() {
   return ss.str();
 }
 
+namespace {
+/// Smallest range of events handed out with LoadType::balancedChunks
+constexpr std::size_t MIN_CHUNK_BYTES = 1024 * 1024;
+/// Largest range of events handed out with LoadType::balancedChunks
+constexpr std::size_t MAX_CHUNK_BYTES = 256 * 1024 * 1024;
+/// Time a process should take to load one range with LoadType::balancedChunks
+constexpr double SECONDS_PER_CHUNK = 0.5;
+
+/// Bytes read from the file for each event of the given banks
+std::vector<std::size_t>
+readBytesPerEvent(const H5::Group &instrument,
+                  const std::vector<std::string> &bankNames) {
+  std::vector<std::size_t> bytes;
+  for (const auto &bankName : bankNames) {
+    const auto idType =
+        instrument.openDataSet(bankName + "/event_id").getDataType();
+    const auto tofType =
+        instrument.openDataSet(bankName + "/event_time_offset").getDataType();
+    bytes.emplace_back(idType.getSize() + tofType.getSize());
+  }
+  return bytes;
+}
+
+/// Argument telling the child process which variant of loading to use
+std::string loadTypeArgument(const MultiProcessEventLoader::LoadType type) {
+  switch (type) {
+  case MultiProcessEventLoader::LoadType::preCalcEvents:
+    return "1";
+  case MultiProcessEventLoader::LoadType::producerConsumer:
+    return "0";
+  case MultiProcessEventLoader::LoadType::balancedChunks:
+    return "2";
+  }
+  throw std::invalid_argument("Unknown MultiProcessEventLoader::LoadType");
+}
+} // namespace
+
 /**Main API function for loading data from given file, group list of banks,
  * launches child processes for hdf5 parallel reading*/
 void MultiProcessEventLoader::load(
     const std::string &filename, const std::string &groupname,
     const std::vector<std::string> &bankNames,
     const std::vector<int32_t> &bankOffsets,
-    std::vector<std::vector<Types::Event::TofEvent> *> eventLists) const {
+    std::vector<std::vector<Types::Event::TofEvent> *> eventLists) {
 
   try {
     H5::H5File file(filename.c_str(), H5F_ACC_RDONLY);
@@ -77,7 +129,16 @@ void MultiProcessEventLoader::load(
     auto bkSz = EventLoader::readBankSizes(instrument, bankNames);
     auto numEvents = std::accumulate(bkSz.begin(), bkSz.end(), std::size_t{0});
 
-    std::size_t storageSize = estimateShmemAmount(numEvents);
+    // With balanced chunks every process sizes its own segment once it knows
+    // how many events it has loaded
+    const bool balanced = m_loadType == LoadType::balancedChunks;
+    std::size_t storageSize = balanced ? 0 : estimateShmemAmount(numEvents);
+    std::unique_ptr<SharedChunkQueue> queue;
+    if (balanced)
+      queue = std::make_unique<SharedChunkQueue>(
+          queueName(m_storageName), bkSz,
+          readBytesPerEvent(instrument, bankNames), m_numProcesses,
+          MIN_CHUNK_BYTES, MAX_CHUNK_BYTES, SECONDS_PER_CHUNK);
 
     std::size_t evPerPr = numEvents / m_numProcesses;
 
@@ -148,8 +209,7 @@ void MultiProcessEventLoader::load(
       processArgs.emplace_back(filename);                    // nexus file name
       processArgs.emplace_back(groupname); // instrument group name
       processArgs.emplace_back(
-          m_precalculateEvents ? "1 "
-                               : "0 "); // variant of algorithm used for loading
+          loadTypeArgument(m_loadType)); // variant of algorithm used for loading
       for (unsigned j = 0; j < bankNames.size(); ++j) {
         processArgs.emplace_back(bankNames[j]);                   // bank name
         processArgs.emplace_back(std::to_string(bankOffsets[j])); // bank size
@@ -184,8 +244,15 @@ void MultiProcessEventLoader::load(
         throw std::runtime_error(
             "Error while waiting processes in  multiprocess loading.");
 
+    if (queue)
+      m_processStatistics = queue->statistics();
+
     // Assemble multiprocess data from shared memory
+    const auto assembleStart = std::chrono::steady_clock::now();
     assembleFromShared(eventLists);
+    m_assembleSeconds = std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - assembleStart)
+                            .count();
   } catch (...) {
     std::throw_with_nested(std::runtime_error("Something wrong in "
                                               "MultiprocessLoader."));
@@ -258,15 +325,90 @@ void MultiProcessEventLoader::fillFromFile(
         type, storage, instrument, bankNames, bankOffsets, from, to);
 }
 
+/**Loads the events claimed by this process from the queue of a load with
+ * LoadType::balancedChunks, then creates a shared memory segment just large
+ * enough for them and copies them there*/
+void MultiProcessEventLoader::fillBalanced(
+    const std::string &segmentName, const std::string &storageName,
+    const int procId, const std::size_t numPixels, const std::string &filename,
+    const std::string &groupname, const std::vector<std::string> &bankNames,
+    const std::vector<int32_t> &bankOffsets) {
+  H5::H5File file(filename.c_str(), H5F_ACC_RDONLY);
+  auto instrument = file.openGroup(groupname);
+  auto type =
+      EventLoader::readDataType(instrument, bankNames, "event_time_offset");
+
+  SharedChunkQueue queue(queueName(storageName));
+  std::vector<std::vector<TofEvent>> pixels(numPixels);
+  loadBalancedWrapper(type, queue, procId, pixels, instrument, bankNames,
+                      bankOffsets);
+
+  const auto copyStart = std::chrono::steady_clock::now();
+  const auto numEvents = std::accumulate(
+      pixels.cbegin(), pixels.cend(), std::size_t{0},
+      [](const std::size_t sum, const std::vector<TofEvent> &events) {
+        return sum + events.size();
+      });
+  EventsListsShmemStorage storage(segmentName, storageName,
+                                  shmemAmount(numEvents, numPixels), 1,
+                                  numPixels);
+  for (std::size_t pixel = 0; pixel < numPixels; ++pixel) {
+    auto &events = pixels[pixel];
+    if (events.empty())
+      continue;
+    storage.reserve(0, pixel, events.size());
+    storage.appendEvent(0, pixel, events.cbegin(), events.cend());
+    std::vector<TofEvent>().swap(events);
+  }
+  queue.recordCopy(procId,
+                   std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - copyStart)
+                       .count());
+}
+
+/// Wrapper to avoid manual processing of all cases of the template argument
+void MultiProcessEventLoader::loadBalancedWrapper(
+    const H5::DataType &type, SharedChunkQueue &queue, const int procId,
+    std::vector<std::vector<TofEvent>> &pixels, const H5::Group &instrument,
+    const std::vector<std::string> &bankNames,
+    const std::vector<int32_t> &bankOffsets) {
+  if (type == H5::PredType::NATIVE_INT32)
+    return loadBalanced<int32_t>(queue, procId, pixels, instrument, bankNames,
+                                 bankOffsets);
+  if (type == H5::PredType::NATIVE_INT64)
+    return loadBalanced<int64_t>(queue, procId, pixels, instrument, bankNames,
+                                 bankOffsets);
+  if (type == H5::PredType::NATIVE_UINT32)
+    return loadBalanced<uint32_t>(queue, procId, pixels, instrument, bankNames,
+                                  bankOffsets);
+  if (type == H5::PredType::NATIVE_UINT64)
+    return loadBalanced<uint64_t>(queue, procId, pixels, instrument, bankNames,
+                                  bankOffsets);
+  if (type == H5::PredType::NATIVE_FLOAT)
+    return loadBalanced<float>(queue, procId, pixels, instrument, bankNames,
+                               bankOffsets);
+  if (type == H5::PredType::NATIVE_DOUBLE)
+    return loadBalanced<double>(queue, procId, pixels, instrument, bankNames,
+                                bankOffsets);
+  throw std::runtime_error(
+      "Unsupported H5::DataType for event_time_offset in NXevent_data");
+}
+
 // Estimates the memory amount for shared memory segments
+size_t MultiProcessEventLoader::estimateShmemAmount(size_t eventCount) const {
+  return shmemAmount(eventCount / m_numProcesses + eventCount % m_numProcesses,
+                     m_numPixels);
+}
+
+// Memory amount for a shared memory segment holding the given number of events
 // vector representing each pixel allocated only once, so we have allocationFee
 // bytes extra overhead
-size_t MultiProcessEventLoader::estimateShmemAmount(size_t eventCount) const {
+size_t MultiProcessEventLoader::shmemAmount(size_t eventCount,
+                                            size_t numPixels) {
   // 8 bytes pointer to allocator + 8 bytes pointer to metadata
   auto allocationFee = 8 + 8 + generateStoragename().length();
-  std::size_t len{(eventCount / m_numProcesses + eventCount % m_numProcesses) *
-                      sizeof(TofEvent) +
-                  m_numPixels * (sizeof(EventLists) + allocationFee) +
+  std::size_t len{eventCount * sizeof(TofEvent) +
+                  numPixels * (sizeof(EventLists) + allocationFee) +
                   sizeof(Chunks) + allocationFee};
   return len;
 }
@@ -0,0 +1,235 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidParallel/IO/SharedChunkQueue.h"
+
+#include <boost/interprocess/sync/interprocess_mutex.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace ip = boost::interprocess;
+
+namespace Mantid {
+namespace Parallel {
+namespace IO {
+
+struct SharedChunkQueue::Header {
+  ip::interprocess_mutex mutex;
+  size_t numBanks;
+  int numProcesses;
+  size_t minChunkBytes;
+  size_t maxChunkBytes;
+  double secondsPerChunk;
+};
+
+struct SharedChunkQueue::Bank {
+  size_t size;
+  size_t next;
+  size_t bytesPerEvent;
+  size_t partition;
+  size_t remainingBytes() const { return (size - next) * bytesPerEvent; }
+};
+
+struct SharedChunkQueue::Process {
+  size_t partition;
+  Statistics statistics;
+};
+
+namespace {
+using Lock = ip::scoped_lock<ip::interprocess_mutex>;
+
+/// Names of the objects in the shared memory segment
+constexpr const char *HEADER_NAME = "Header";
+constexpr const char *BANKS_NAME = "Banks";
+constexpr const char *PROCESSES_NAME = "Processes";
+
+template <class T>
+T *findInSegment(ip::managed_shared_memory &segment, const char *name) {
+  auto *object = segment.find<T>(name).first;
+  if (!object)
+    throw std::runtime_error(std::string("SharedChunkQueue: ") + name +
+                             " not found in shared memory.");
+  return object;
+}
+} // namespace
+
+/** Create the queue in a new shared memory segment. The process creating the
+ * queue owns the segment and removes it when the queue is destroyed.
+ * @param name :: name of the shared memory segment
+ * @param bankSizes :: number of events in each bank
+ * @param bytesPerEvent :: bytes read from the file for each event of a bank
+ * @param numProcesses :: number of processes loading
+ * @param minChunkBytes :: smallest range to hand out, in bytes
+ * @param maxChunkBytes :: largest range to hand out, in bytes
+ * @param secondsPerChunk :: time a process should take to load one range
+ */
+SharedChunkQueue::SharedChunkQueue(const std::string &name,
+                                   const std::vector<size_t> &bankSizes,
+                                   const std::vector<size_t> &bytesPerEvent,
+                                   const int numProcesses,
+                                   const size_t minChunkBytes,
+                                   const size_t maxChunkBytes,
+                                   const double secondsPerChunk)
+    : m_name(name), m_owner(true) {
+  if (bankSizes.size() != bytesPerEvent.size())
+    throw std::invalid_argument(
+        "SharedChunkQueue: need the bytes per event of every bank.");
+  if (numProcesses < 1)
+    throw std::invalid_argument("SharedChunkQueue: need at least 1 process.");
+
+  const size_t segmentSize = 64 * 1024 + sizeof(Header) +
+                             bankSizes.size() * sizeof(Bank) +
+                             numProcesses * sizeof(Process);
+  ip::permissions perm;
+  perm.set_unrestricted();
+  m_segment = std::make_unique<ip::managed_shared_memory>(
+      ip::create_only, m_name.c_str(), segmentSize, nullptr, perm);
+
+  m_header = m_segment->construct<Header>(HEADER_NAME)();
+  m_header->numBanks = bankSizes.size();
+  m_header->numProcesses = numProcesses;
+  m_header->minChunkBytes = std::max(minChunkBytes, size_t(1));
+  m_header->maxChunkBytes = std::max(maxChunkBytes, m_header->minChunkBytes);
+  m_header->secondsPerChunk = secondsPerChunk;
+
+  // Give every process a group of banks of roughly equal size in bytes
+  std::vector<size_t> bankBytes(bankSizes.size());
+  for (size_t i = 0; i < bankSizes.size(); ++i)
+    bankBytes[i] = bankSizes[i] * bytesPerEvent[i];
+  const auto partitioning =
+      Chunker::makeBalancedPartitioning(numProcesses, bankBytes);
+
+  m_banks = m_segment->construct<Bank>(BANKS_NAME)[bankSizes.size()]();
+  m_processes = m_segment->construct<Process>(PROCESSES_NAME)[numProcesses]();
+  int process = 0;
+  for (size_t partition = 0; partition < partitioning.size(); ++partition) {
+    for (const auto bank : partitioning[partition].second)
+      m_banks[bank] = Bank{bankSizes[bank], 0, bytesPerEvent[bank], partition};
+    for (int i = 0; i < partitioning[partition].first && process < numProcesses;
+         ++i)
+      m_processes[process++].partition = partition;
+  }
+}
+
+/** Open a queue created by another process
+ * @param name :: name of the shared memory segment
+ */
+SharedChunkQueue::SharedChunkQueue(const std::string &name)
+    : m_name(name), m_owner(false),
+      m_segment(std::make_unique<ip::managed_shared_memory>(ip::open_only,
+                                                            name.c_str())),
+      m_header(findInSegment<Header>(*m_segment, HEADER_NAME)),
+      m_banks(findInSegment<Bank>(*m_segment, BANKS_NAME)),
+      m_processes(findInSegment<Process>(*m_segment, PROCESSES_NAME)) {}
+
+SharedChunkQueue::~SharedChunkQueue() {
+  m_segment.reset();
+  if (m_owner)
+    ip::shared_memory_object::remove(m_name.c_str());
+}
+
+/** Claim the next range of events to load.
+ * @param process :: index of the claiming process
+ * @return the range to load, with an eventCount of 0 once all are claimed
+ */
+Chunker::LoadRange SharedChunkQueue::claim(const int process) {
+  Lock lock(m_header->mutex);
+  const auto &proc = m_processes[process];
+  size_t remainingBytes = 0;
+  Bank *bank = nullptr;
+  Bank *largest = nullptr;
+  for (size_t i = 0; i < m_header->numBanks; ++i) {
+    auto &candidate = m_banks[i];
+    const size_t bytes = candidate.remainingBytes();
+    if (bytes == 0)
+      continue;
+    remainingBytes += bytes;
+    // The banks of our own partition come first, in order
+    if (!bank && candidate.partition == proc.partition)
+      bank = &candidate;
+    if (!largest || bytes > largest->remainingBytes())
+      largest = &candidate;
+  }
+  if (remainingBytes == 0)
+    return {0, 0, 0};
+  if (!bank)
+    bank = largest;
+
+  const size_t bytes = chunkBytes(proc, remainingBytes);
+  const size_t count =
+      std::min(bank->size - bank->next,
+               std::max(size_t(1), bytes / std::max(bank->bytesPerEvent,
+                                                    size_t(1))));
+  const Chunker::LoadRange range{static_cast<size_t>(bank - m_banks),
+                                 bank->next, count};
+  bank->next += count;
+  return range;
+}
+
+/** Size of the next range for a process. It is what the process can load in
+ * the time given per range at the throughput observed so far, but no more
+ * than an even share of the work left so the last ranges are spread over
+ * all processes.
+ * @param process :: the claiming process
+ * @param remainingBytes :: bytes not claimed by any process yet
+ * @return the size in bytes
+ */
+size_t SharedChunkQueue::chunkBytes(const Process &process,
+                                    const size_t remainingBytes) const {
+  const auto &stats = process.statistics;
+  const double seconds = stats.readSeconds + stats.sortSeconds;
+  size_t bytes = m_header->minChunkBytes;
+  if (seconds > 0.)
+    bytes = static_cast<size_t>(static_cast<double>(stats.bytes) / seconds *
+                                m_header->secondsPerChunk);
+  bytes = std::min(bytes, remainingBytes / m_header->numProcesses);
+  return std::min(std::max(bytes, m_header->minChunkBytes),
+                  m_header->maxChunkBytes);
+}
+
+/** Record the time a process took to load a range
+ * @param process :: index of the process
+ * @param range :: the range that was loaded
+ * @param readSeconds :: time spent reading the range from file
+ * @param sortSeconds :: time spent sorting the events by pixel
+ */
+void SharedChunkQueue::recordChunk(const int process,
+                                   const Chunker::LoadRange &range,
+                                   const double readSeconds,
+                                   const double sortSeconds) {
+  Lock lock(m_header->mutex);
+  auto &stats = m_processes[process].statistics;
+  ++stats.chunks;
+  stats.events += range.eventCount;
+  stats.bytes += range.eventCount * m_banks[range.bankIndex].bytesPerEvent;
+  stats.readSeconds += readSeconds;
+  stats.sortSeconds += sortSeconds;
+}
+
+/** Record the time a process took to copy its events to shared memory
+ * @param process :: index of the process
+ * @param copySeconds :: the time taken
+ */
+void SharedChunkQueue::recordCopy(const int process, const double copySeconds) {
+  Lock lock(m_header->mutex);
+  m_processes[process].statistics.copySeconds += copySeconds;
+}
+
+/// @return the statistics of every process
+std::vector<SharedChunkQueue::Statistics>
+SharedChunkQueue::statistics() const {
+  Lock lock(m_header->mutex);
+  std::vector<Statistics> result;
+  for (int i = 0; i < m_header->numProcesses; ++i)
+    result.emplace_back(m_processes[i].statistics);
+  return result;
+}
+
+} // namespace IO
+} // namespace Parallel
+} // namespace Mantid
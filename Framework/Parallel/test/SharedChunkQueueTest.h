@@ -0,0 +1,100 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2020 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidParallel/IO/SharedChunkQueue.h"
+
+using namespace Mantid::Parallel::IO;
+
+class SharedChunkQueueTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SharedChunkQueueTest *createSuite() {
+    return new SharedChunkQueueTest();
+  }
+  static void destroySuite(SharedChunkQueueTest *suite) { delete suite; }
+
+  void test_every_event_is_claimed_once() {
+    const std::vector<size_t> bankSizes{1000, 10, 0, 250, 37};
+    SharedChunkQueue queue("SharedChunkQueueTest_claim", bankSizes,
+                           {8, 8, 8, 12, 8}, 3, 64, 1024, 1.0);
+    std::vector<size_t> claimed(bankSizes.size(), 0);
+    for (int process = 0;; process = (process + 1) % 3) {
+      const auto range = queue.claim(process);
+      if (range.eventCount == 0)
+        break;
+      TS_ASSERT_EQUALS(range.eventOffset, claimed[range.bankIndex]);
+      claimed[range.bankIndex] += range.eventCount;
+      queue.recordChunk(process, range, 0.0, 0.0);
+    }
+    TS_ASSERT_EQUALS(claimed, bankSizes);
+    size_t events = 0;
+    for (const auto &stats : queue.statistics())
+      events += stats.events;
+    TS_ASSERT_EQUALS(events, 1297);
+  }
+
+  void test_processes_start_on_different_banks() {
+    SharedChunkQueue queue("SharedChunkQueueTest_partition", {100, 100},
+                           {8, 8}, 2, 80, 800, 1.0);
+    TS_ASSERT_DIFFERS(queue.claim(0).bankIndex, queue.claim(1).bankIndex);
+  }
+
+  void test_chunk_size_follows_throughput() {
+    SharedChunkQueue queue("SharedChunkQueueTest_throughput", {1000000}, {1},
+                           1, 100, 1000000, 0.5);
+    // Nothing is known yet, so the first chunk is the smallest
+    auto range = queue.claim(0);
+    TS_ASSERT_EQUALS(range.eventCount, 100);
+    // 100 bytes in 1/64 s is 6400 bytes/s, i.e. 3200 bytes in 0.5 s
+    queue.recordChunk(0, range, 1. / 128., 1. / 128.);
+    range = queue.claim(0);
+    TS_ASSERT_EQUALS(range.eventCount, 3200);
+    // Slower reads lead to smaller chunks: 3300 bytes in 2 s
+    queue.recordChunk(0, range, 1.5, 0.484375);
+    range = queue.claim(0);
+    TS_ASSERT_EQUALS(range.eventCount, 825);
+  }
+
+  void test_chunks_shrink_when_work_runs_out() {
+    SharedChunkQueue queue("SharedChunkQueueTest_shrink", {1000}, {1}, 4, 10,
+                           1000, 1.0);
+    auto range = queue.claim(0);
+    queue.recordChunk(0, range, 0.001, 0.0);
+    // Would be 10000 bytes from the throughput, but only a quarter of the
+    // remaining 990 bytes are handed out to leave work for the others
+    TS_ASSERT_EQUALS(queue.claim(0).eventCount, 247);
+  }
+
+  void test_statistics() {
+    SharedChunkQueue queue("SharedChunkQueueTest_statistics", {100}, {6}, 2,
+                           600, 600, 1.0);
+    const auto range = queue.claim(1);
+    queue.recordChunk(1, range, 1.5, 0.5);
+    queue.recordCopy(1, 0.25);
+    const auto statistics = queue.statistics();
+    TS_ASSERT_EQUALS(statistics.size(), 2);
+    TS_ASSERT_EQUALS(statistics[0].chunks, 0);
+    TS_ASSERT_EQUALS(statistics[1].chunks, 1);
+    TS_ASSERT_EQUALS(statistics[1].events, 100);
+    TS_ASSERT_EQUALS(statistics[1].bytes, 600);
+    TS_ASSERT_EQUALS(statistics[1].readSeconds, 1.5);
+    TS_ASSERT_EQUALS(statistics[1].sortSeconds, 0.5);
+    TS_ASSERT_EQUALS(statistics[1].copySeconds, 0.25);
+  }
+
+  void test_open_existing_queue() {
+    SharedChunkQueue owner("SharedChunkQueueTest_open", {100}, {8}, 1, 80, 80,
+                           1.0);
+    SharedChunkQueue client("SharedChunkQueueTest_open");
+    TS_ASSERT_EQUALS(client.claim(0).eventCount, 10);
+    TS_ASSERT_EQUALS(owner.claim(0).eventOffset, 10);
+  }
+};